@@ -0,0 +1,55 @@
+#ifndef EMULATOR_ARDUINO_H
+#define EMULATOR_ARDUINO_H
+
+/**
+ * @brief Host stand-in for the parts of Arduino.h the display code uses
+ *
+ * Only for the native display emulator (pio run -e native). Time is
+ * simulated: millis()/micros() only move when the emulator advances them,
+ * so scene toggles and animation frames are reproducible.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PROGMEM
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+void emulatorAdvanceMicros(unsigned long us);
+void emulatorAdvanceMillis(unsigned long ms);
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t print(const char* text) { return fputs(text, stdout) >= 0 ? strlen(text) : 0; }
+    size_t println(const char* text = "") { return print(text) + print("\n"); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t println(long value) { return print(value) + print("\n"); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+    IPAddress() : bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    uint8_t operator[](int index) const { return bytes[index]; }
+
+private:
+    uint8_t bytes[4];
+};
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+bool ledcFade(uint8_t pin, uint32_t startDuty, uint32_t targetDuty, int maxFadeTimeMs);
+uint32_t ledcRead(uint8_t pin);
+
+#endif
@@ -0,0 +1,273 @@
+#ifndef EMULATOR_LOVYANGFX_HPP
+#define EMULATOR_LOVYANGFX_HPP
+
+/**
+ * @brief In-memory stand-in for the LovyanGFX API used by display.cpp
+ *
+ * Only for the native display emulator (pio run -e native). Implements the
+ * subset of LGFXBase/LGFX_Device/LGFX_Sprite the firmware calls, drawing
+ * into RGB565 framebuffers instead of a panel:
+ *
+ * - LGFX_Device keeps a host-order RGB565 framebuffer sized from the panel
+ *   config and rotation; "SPI" calls such as startWrite() and waitDMA() are
+ *   no-ops.
+ * - 16 bpp sprites store byte-swapped RGB565 like the real library, so the
+ *   firmware can write decoded pixels straight into getBuffer(). Palette
+ *   sprites pack their indices like LovyanGFX: rows padded to whole bytes,
+ *   leftmost pixel in the most significant bits.
+ * - Colours are RGB565 on 16 bpp targets and palette indices on palette
+ *   sprites, as in LovyanGFX. uint16_t image data is byte-swapped RGB565.
+ * - Fonts 2 and 4 are drawn from a scaled 5x7 bitmap font and font 7 as
+ *   procedural 7-segment digits. Cell sizes follow the real fonts closely
+ *   enough for layout; glyph shapes are not pixel-identical to the device.
+ *
+ * Every target counts the pixels written to it (pixelsWritten()), which for
+ * the device equals what a panel would receive over SPI.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace lgfx {
+
+struct swap565_t {
+    uint16_t raw;
+};
+
+enum textdatum_t : uint8_t {
+    top_left = 0,
+    top_center = 1,
+    top_right = 2,
+    middle_left = 4,
+    middle_center = 5,
+    middle_right = 6,
+    bottom_left = 8,
+    bottom_center = 9,
+    bottom_right = 10
+};
+
+class LGFXBase {
+public:
+    LGFXBase();
+    virtual ~LGFXBase() {}
+
+    int32_t width() const { return _width; }
+    int32_t height() const { return _height; }
+
+    void setClipRect(int32_t x, int32_t y, int32_t w, int32_t h);
+    void clearClipRect();
+
+    void startWrite(bool transaction = true) { (void)transaction; }
+    void endWrite() {}
+    void waitDMA() {}
+
+    void fillScreen(uint32_t color);
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t* data);
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) { pushImage(x, y, w, h, data); }
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t* data) { pushImage(x, y, w, h, data); }
+
+    void setTextColor(uint32_t color) { _textColor = color; _textFillBackground = false; }
+    void setTextColor(uint32_t color, uint32_t background);
+    void setTextDatum(uint8_t datum) { _textDatum = datum; }
+    void setTextSize(int size) { _textSize = size > 0 ? size : 1; }
+    int32_t drawString(const char* text, int32_t x, int32_t y, uint8_t font);
+    int32_t textWidth(const char* text, uint8_t font) const;
+    int32_t fontHeight(uint8_t font) const;
+
+    // Emulator only
+    uint16_t readPixel565(int32_t x, int32_t y) const;
+    unsigned long pixelsWritten() const { return _pixelsWritten; }
+    void resetPixelsWritten() { _pixelsWritten = 0; }
+
+    // Write one RGB565 pixel, converted to the target's format
+    void writeColor565(int32_t x, int32_t y, uint16_t rgb565);
+
+protected:
+    int32_t _width;
+    int32_t _height;
+
+    virtual void storePixel(int32_t x, int32_t y, uint32_t color) = 0;
+    virtual uint16_t loadPixel565(int32_t x, int32_t y) const = 0;
+    virtual uint32_t fromColor565(uint16_t rgb565) const { return rgb565; }
+
+    void plot(int32_t x, int32_t y, uint32_t color);
+    void hline(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void resetClip();
+
+private:
+    int32_t _clipLeft;
+    int32_t _clipTop;
+    int32_t _clipRight;    // Exclusive
+    int32_t _clipBottom;   // Exclusive
+    bool _clipped;
+    uint32_t _textColor;
+    uint32_t _textBackground;
+    bool _textFillBackground;
+    uint8_t _textDatum;
+    int _textSize;
+    unsigned long _pixelsWritten;
+
+    int32_t drawGlyph(char c, int32_t x, int32_t y, uint8_t font);
+};
+
+class LovyanGFX : public LGFXBase {
+};
+
+class Bus_SPI {
+public:
+    struct config_t {
+        int spi_host;
+        int spi_mode;
+        uint32_t freq_write;
+        uint32_t freq_read;
+        bool spi_3wire;
+        bool use_lock;
+        int dma_channel;
+        int pin_sclk;
+        int pin_mosi;
+        int pin_miso;
+        int pin_dc;
+    };
+    config_t config() const { return _config; }
+    void config(const config_t& config) { _config = config; }
+
+private:
+    config_t _config = {};
+};
+
+class Panel_Device {
+public:
+    struct config_t {
+        int pin_cs;
+        int pin_rst;
+        int pin_busy;
+        int panel_width;
+        int panel_height;
+        int offset_x;
+        int offset_y;
+        int offset_rotation;
+        int dummy_read_pixel;
+        int dummy_read_bits;
+        bool readable;
+        bool invert;
+        bool rgb_order;
+        bool dlen_16bit;
+        bool bus_shared;
+    };
+    config_t config() const { return _config; }
+    void config(const config_t& config) { _config = config; }
+    void setBus(Bus_SPI* bus) { (void)bus; }
+
+private:
+    config_t _config = {};
+};
+
+class Panel_ST7789 : public Panel_Device {
+};
+
+/**
+ * @brief The "panel": a framebuffer the emulator can dump to PNG
+ */
+class LGFX_Device : public LovyanGFX {
+public:
+    void setPanel(Panel_Device* panel) { _panel = panel; }
+    bool init();
+    void setRotation(uint8_t rotation);
+    void setBrightness(uint8_t brightness) { _brightness = brightness; }
+    uint8_t getBrightness() const { return _brightness; }
+    void sleep() { _sleeping = true; }
+    void wakeup() { _sleeping = false; }
+    bool isSleeping() const { return _sleeping; }   // Emulator only
+    const uint16_t* framebuffer() const { return _frame.data(); }
+
+protected:
+    void storePixel(int32_t x, int32_t y, uint32_t color) override;
+    uint16_t loadPixel565(int32_t x, int32_t y) const override;
+
+private:
+    Panel_Device* _panel = nullptr;
+    uint8_t _rotation = 0;
+    uint8_t _brightness = 255;
+    bool _sleeping = false;
+    std::vector<uint16_t> _frame;
+    void resize();
+};
+
+class LGFX_Sprite : public LovyanGFX {
+public:
+    LGFX_Sprite() {}
+    explicit LGFX_Sprite(LovyanGFX* parent) { (void)parent; }
+
+    void setColorDepth(int bits) { _depth = bits; }
+    void setPsram(bool enabled) { (void)enabled; }
+    void* createSprite(int32_t w, int32_t h);
+    void deleteSprite();
+    void setBuffer(void* buffer, int32_t w, int32_t h, uint8_t bits = 16);
+    void* getBuffer() const { return _pixels16 != nullptr ? (void*)_pixels16 : (void*)_indices.data(); }
+
+    bool createPalette();
+    void setPaletteColor(size_t index, uint32_t rgb565);
+    void fillSprite(uint32_t color) { fillScreen(color); }
+
+    void pushSprite(LovyanGFX* dst, int32_t x, int32_t y);
+    void pushSprite(LovyanGFX* dst, int32_t x, int32_t y, uint32_t transparent);
+
+protected:
+    void storePixel(int32_t x, int32_t y, uint32_t color) override;
+    uint16_t loadPixel565(int32_t x, int32_t y) const override;
+    uint32_t fromColor565(uint16_t rgb565) const override;
+
+private:
+    int _depth = 16;
+    std::vector<uint16_t> _owned;     // 16 bpp storage from createSprite()
+    uint16_t* _pixels16 = nullptr;    // Byte-swapped RGB565, owned or external
+    std::vector<uint8_t> _indices;    // Palette sprites, packed rows
+    std::vector<uint16_t> _palette;   // RGB565 per index
+
+    bool hasPalette() const { return _pixels16 == nullptr; }
+    size_t indexStride() const { return ((size_t)_width * _depth + 7) / 8; }
+    uint8_t readIndex(int32_t x, int32_t y) const;
+    void writeIndex(int32_t x, int32_t y, uint8_t index);
+    void push(LovyanGFX* dst, int32_t x, int32_t y, bool useTransparent, uint32_t transparent);
+};
+
+}  // namespace lgfx
+
+using lgfx::LGFX_Sprite;
+using lgfx::LovyanGFX;
+
+// TFT_eSPI style names the firmware uses
+static const uint8_t TL_DATUM = lgfx::top_left;
+static const uint8_t TC_DATUM = lgfx::top_center;
+static const uint8_t TR_DATUM = lgfx::top_right;
+static const uint8_t MC_DATUM = lgfx::middle_center;
+static const uint8_t BC_DATUM = lgfx::bottom_center;
+static const uint8_t BR_DATUM = lgfx::bottom_right;
+
+static const uint16_t TFT_BLACK = 0x0000;
+static const uint16_t TFT_NAVY = 0x000F;
+static const uint16_t TFT_DARKGREEN = 0x03E0;
+static const uint16_t TFT_DARKGREY = 0x7BEF;
+static const uint16_t TFT_BLUE = 0x001F;
+static const uint16_t TFT_GREEN = 0x07E0;
+static const uint16_t TFT_CYAN = 0x07FF;
+static const uint16_t TFT_RED = 0xF800;
+static const uint16_t TFT_YELLOW = 0xFFE0;
+static const uint16_t TFT_WHITE = 0xFFFF;
+static const uint16_t TFT_ORANGE = 0xFDA0;
+
+static const int SPI2_HOST = 1;
+static const int SPI_DMA_CH_AUTO = 3;
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef EMULATOR_PREFERENCES_H
+#define EMULATOR_PREFERENCES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+/**
+ * @brief In-memory stand-in for the ESP32 Preferences (NVS) library
+ *
+ * Lets ConfigManager run in the host tests; the display emulator only
+ * uses config.h's types. Namespaces live for the whole process, so a test
+ * can write keys as older firmware left them and read back what load()
+ * stored. Like NVS, values are typed (a get of another type returns the
+ * default) and getString() into a buffer copies nothing and returns 0 if
+ * the value plus terminator does not fit.
+ */
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) {
+        (void)readOnly;
+        values = &storage()[name];
+        return true;
+    }
+    void end() { values = nullptr; }
+
+    bool clear() { values->clear(); return true; }
+    bool remove(const char* key) { return values->erase(key) > 0; }
+    bool isKey(const char* key) { return values->count(key) > 0; }
+
+    size_t putUChar(const char* key, uint8_t value) { return put(key, 'u', &value, sizeof(value)); }
+    size_t putInt(const char* key, int32_t value) { return put(key, 'i', &value, sizeof(value)); }
+    size_t putBool(const char* key, bool value) { return putUChar(key, value ? 1 : 0); }
+    size_t putFloat(const char* key, float value) { return put(key, 'f', &value, sizeof(value)); }
+    size_t putString(const char* key, const char* value) { return put(key, 's', value, strlen(value) + 1); }
+
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { return get(key, 'u', defaultValue); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return get(key, 'i', defaultValue); }
+    bool getBool(const char* key, bool defaultValue = false) { return getUChar(key, defaultValue ? 1 : 0) != 0; }
+    float getFloat(const char* key, float defaultValue = 0) { return get(key, 'f', defaultValue); }
+
+    /**
+     * @return Length including the terminator, 0 if missing or too long for maxLen
+     */
+    size_t getString(const char* key, char* value, size_t maxLen) {
+        auto it = values->find(key);
+        if (value == nullptr || it == values->end() || it->second.type != 's' || it->second.bytes.size() > maxLen) {
+            return 0;
+        }
+        memcpy(value, it->second.bytes.data(), it->second.bytes.size());
+        return it->second.bytes.size();
+    }
+
+private:
+    struct Value {
+        char type;
+        std::string bytes;
+    };
+    std::map<std::string, Value>* values = nullptr;
+
+    static std::map<std::string, std::map<std::string, Value>>& storage() {
+        static std::map<std::string, std::map<std::string, Value>> namespaces;
+        return namespaces;
+    }
+
+    size_t put(const char* key, char type, const void* data, size_t length) {
+        (*values)[key] = Value{ type, std::string((const char*)data, length) };
+        return length;
+    }
+
+    template <typename T>
+    T get(const char* key, char type, T defaultValue) {
+        auto it = values->find(key);
+        if (it == values->end() || it->second.type != type || it->second.bytes.size() != sizeof(T)) {
+            return defaultValue;
+        }
+        T value;
+        memcpy(&value, it->second.bytes.data(), sizeof(T));
+        return value;
+    }
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef EMULATOR_H
+#define EMULATOR_H
+
+#include <LovyanGFX.hpp>
+
+/**
+ * @brief Emulator-only helpers around the in-memory panel
+ */
+
+/**
+ * @brief The most recently initialised LGFX_Device (the firmware's tft)
+ */
+lgfx::LGFX_Device* emulatorPanel();
+
+/**
+ * @brief Write a target's pixels to an RGB PNG file
+ *
+ * Uses stored (uncompressed) deflate blocks, so no zlib is needed.
+ * @return false if the file could not be written
+ */
+bool emulatorSavePng(const lgfx::LGFXBase& target, const char* path);
+
+#endif
@@ -0,0 +1,60 @@
+#include <Arduino.h>
+#include <stdarg.h>
+
+HardwareSerial Serial;
+
+static unsigned long long nowUs = 0;
+
+unsigned long millis() {
+    return (unsigned long)(nowUs / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)nowUs;
+}
+
+void delay(unsigned long ms) {
+    emulatorAdvanceMillis(ms);
+}
+
+void emulatorAdvanceMicros(unsigned long us) {
+    nowUs += us;
+}
+
+void emulatorAdvanceMillis(unsigned long ms) {
+    nowUs += (unsigned long long)ms * 1000;
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n > 0 ? n : 0;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+    (void)pin;
+    (void)freq;
+    (void)resolution;
+    return true;
+}
+
+// Duty per pin; fades complete instantly on simulated time
+static uint32_t ledcDuty[64];
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+    ledcDuty[pin & 63] = duty;
+    return true;
+}
+
+bool ledcFade(uint8_t pin, uint32_t startDuty, uint32_t targetDuty, int maxFadeTimeMs) {
+    (void)startDuty;
+    (void)maxFadeTimeMs;
+    ledcDuty[pin & 63] = targetDuty;
+    return true;
+}
+
+uint32_t ledcRead(uint8_t pin) {
+    return ledcDuty[pin & 63];
+}
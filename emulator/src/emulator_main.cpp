@@ -0,0 +1,171 @@
+/**
+ * @brief Host-side display emulator
+ *
+ * Drives DisplayManager through the firmware's scenes on simulated time,
+ * with the in-memory panel from emulator/include/LovyanGFX.hpp. After every
+ * step it prints what the panel received and how long the step took on the
+ * host, and with an output directory it also saves the panel as PNG:
+ *
+ *     pio run -e native && .pio/build/native/program out/
+ *
+ * tools/compare_frames.py checks those PNGs against emulator/reference/.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include "display.h"
+#include "emulator.h"
+#include "render_profile.h"
+
+static DisplayManager display;
+static const char* outputDir = nullptr;
+static int step = 0;
+static unsigned long capturedFrames = 0;    // RenderStats::frames at the last capture
+static const uint8_t BACKLIGHT_PIN = 22;   // TFT_BL in display.cpp
+
+/**
+ * @brief Report (and save) the panel after one step of the scenario
+ *
+ * Rects and bytes come from the last refresh, so they are 0 for steps
+ * without one (nothing to send, asleep, or a page painted outside refresh()).
+ */
+static void capture(const char* name, double hostUs) {
+    lgfx::LGFX_Device* panel = emulatorPanel();
+    const RenderStats& stats = display.getRenderStats();
+    bool refreshed = stats.frames != capturedFrames;
+    capturedFrames = stats.frames;
+    printf("%2d %-14s %6lu px  %2u rects  %6lu bytes  %8.1f us\n",
+           step, name, panel->pixelsWritten(), refreshed ? stats.lastRects : 0,
+           refreshed ? stats.lastBytes : 0, hostUs);
+    
+    if (outputDir != nullptr) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%02d_%s.png", outputDir, step, name);
+        if (!emulatorSavePng(*panel, path)) {
+            printf("   could not write %s\n", path);
+        }
+    }
+    panel->resetPixelsWritten();
+    step++;
+}
+
+/**
+ * @brief refresh() plus a few animation frames, timed on the host
+ */
+static void render(const char* name, int animationFrames = 0) {
+    auto start = std::chrono::steady_clock::now();
+    display.refresh();
+    for (int i = 0; i < animationFrames; i++) {
+        emulatorAdvanceMillis(40);
+        display.animate();
+    }
+    auto end = std::chrono::steady_clock::now();
+    capture(name, std::chrono::duration<double, std::micro>(end - start).count());
+}
+
+/**
+ * @brief Print the display power state and the backlight duty
+ */
+static void printPower() {
+    const DisplayPower& power = display.getPower();
+    printf("   display %s, backlight %u, panel %s\n",
+           DisplayPower::stateName(power.getState()), (unsigned)ledcRead(BACKLIGHT_PIN),
+           emulatorPanel()->isSleeping() ? "sleeping" : "awake");
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        outputDir = argv[1];
+    }
+    
+    display.begin(200);
+    emulatorPanel()->resetPixelsWritten();
+    printf("step scene          panel px  dirty    spi bytes   host time\n");
+    
+    display.showStartupScreen(IPAddress(192, 168, 1, 42));
+    capture("startup", 0);
+    
+    emulatorAdvanceMillis(3000);
+    render("room_waiting");
+    
+    // Past the boot-time activity window, so the room temperature shows
+    emulatorAdvanceMillis(120000);
+    
+    display.updateTemperature(ROLE_ROOM, 2150);
+    render("room");
+    
+    display.updateTemperature(ROLE_ROOM, 2162);
+    render("room_update");
+    
+    display.updateHeatingStatus(true);
+    render("heating", 5);
+    
+    // Hot water drawn: tank and out pipe readings switch to the bath status
+    display.updateTemperature(ROLE_TANK, 4500);
+    display.updateTemperature(ROLE_OUT_PIPE, 3000);
+    render("stop", 5);
+    
+    display.updateHeatingStatus(false);
+    display.updateBathStatus(true);
+    render("bath_image");
+    
+    emulatorAdvanceMillis(4100);
+    render("bath_room");
+    
+    display.updateLinkStatus(CircuitBreaker::OPEN);
+    render("link_open");
+    
+    emulatorAdvanceMillis(2100);
+    render("bath_image_2");
+    
+    // Idle: dim after 10 minutes, panel asleep after an hour, hot water wakes it
+    display.setPowerTimeouts(600000, 3600000);
+    emulatorAdvanceMillis(660000);
+    render("dimmed");
+    printPower();
+    
+    emulatorAdvanceMillis(3000000);
+    render("asleep");
+    emulatorAdvanceMillis(2000);
+    display.updateTemperature(ROLE_ROOM, 2210);
+    render("asleep_room");
+    printPower();
+    
+    display.updateTemperature(ROLE_OUT_PIPE, 3400);
+    render("woken");
+    printPower();
+    
+    // Six hours of history: the tank reheats, the out pipe spikes on a draw-off
+    for (int i = 0; i < TREND_SAMPLES + 40; i++) {
+        TempCenti values[TREND_SERIES];
+        values[TREND_TANK] = 4500 + (i % 120) * 8;
+        values[TREND_OUT_PIPE] = (i > 200 && i < 230) ? 4200 : 2400 + (i % 50) * 4;
+        values[TREND_HEATING_IN] = i < 100 ? TEMP_INVALID : 3500 + (i % 60) * 10;
+        display.addTrendSample(values);
+    }
+    // Ready again: bath image, room temperature, then the trend page
+    display.updateTemperature(ROLE_OUT_PIPE, 4000);
+    display.updateBathStatus(true);
+    render("bath_image_3");
+    emulatorAdvanceMillis(4100);
+    render("bath_room_2");
+    emulatorAdvanceMillis(2100);
+    render("trend");
+    
+    // One more sample shifts the chart by a column; only the chart is pushed
+    TempCenti next[TREND_SERIES] = { 5400, 2600, 4000 };
+    display.addTrendSample(next);
+    render("trend_sample");
+    
+    display.showConfigMode();
+    capture("config", 0);
+    
+    const AnimationStats& anim = display.getAnimationStats();
+    const RenderStats& stats = display.getRenderStats();
+    printf("refreshes %lu (full %lu), avg %lu bytes; animation frames %lu, avg %lu us\n",
+           stats.frames, stats.fullFrames, stats.avgBytes, anim.frames, anim.avgRenderUs);
+#ifdef RENDER_PROFILER
+    renderProfilePrint();
+#endif
+    return 0;
+}
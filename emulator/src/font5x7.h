@@ -0,0 +1,89 @@
+#ifndef EMULATOR_FONT5X7_H
+#define EMULATOR_FONT5X7_H
+
+/**
+ * @brief 5x7 bitmap glyphs for the emulated fonts 2 and 4
+ *
+ * Each row is 5 characters, '#' for a set pixel. Characters without an
+ * entry are drawn as an empty box.
+ */
+struct Glyph5x7 {
+    char c;
+    const char* rows[7];
+};
+
+static const Glyph5x7 FONT_5X7[] = {
+    { ' ', { ".....", ".....", ".....", ".....", ".....", ".....", "....." } },
+    { '!', { "..#..", "..#..", "..#..", "..#..", "..#..", ".....", "..#.." } },
+    { '(', { "...#.", "..#..", ".#...", ".#...", ".#...", "..#..", "...#." } },
+    { ')', { ".#...", "..#..", "...#.", "...#.", "...#.", "..#..", ".#..." } },
+    { ',', { ".....", ".....", ".....", ".....", "..##.", "...#.", "..#.." } },
+    { '-', { ".....", ".....", ".....", "#####", ".....", ".....", "....." } },
+    { '.', { ".....", ".....", ".....", ".....", ".....", ".##..", ".##.." } },
+    { '/', { "....#", "...#.", "...#.", "..#..", ".#...", ".#...", "#...." } },
+    { ':', { ".....", ".##..", ".##..", ".....", ".##..", ".##..", "....." } },
+    { '0', { ".###.", "#...#", "#..##", "#.#.#", "##..#", "#...#", ".###." } },
+    { '1', { "..#..", ".##..", "..#..", "..#..", "..#..", "..#..", ".###." } },
+    { '2', { ".###.", "#...#", "....#", "...#.", "..#..", ".#...", "#####" } },
+    { '3', { "#####", "...#.", "..#..", "...#.", "....#", "#...#", ".###." } },
+    { '4', { "...#.", "..##.", ".#.#.", "#..#.", "#####", "...#.", "...#." } },
+    { '5', { "#####", "#....", "####.", "....#", "....#", "#...#", ".###." } },
+    { '6', { "..##.", ".#...", "#....", "####.", "#...#", "#...#", ".###." } },
+    { '7', { "#####", "....#", "...#.", "..#..", ".#...", ".#...", ".#..." } },
+    { '8', { ".###.", "#...#", "#...#", ".###.", "#...#", "#...#", ".###." } },
+    { '9', { ".###.", "#...#", "#...#", ".####", "....#", "...#.", ".##.." } },
+    { 'A', { ".###.", "#...#", "#...#", "#####", "#...#", "#...#", "#...#" } },
+    { 'B', { "####.", "#...#", "#...#", "####.", "#...#", "#...#", "####." } },
+    { 'C', { ".###.", "#...#", "#....", "#....", "#....", "#...#", ".###." } },
+    { 'D', { "###..", "#..#.", "#...#", "#...#", "#...#", "#..#.", "###.." } },
+    { 'E', { "#####", "#....", "#....", "####.", "#....", "#....", "#####" } },
+    { 'F', { "#####", "#....", "#....", "####.", "#....", "#....", "#...." } },
+    { 'G', { ".###.", "#...#", "#....", "#.###", "#...#", "#...#", ".####" } },
+    { 'H', { "#...#", "#...#", "#...#", "#####", "#...#", "#...#", "#...#" } },
+    { 'I', { ".###.", "..#..", "..#..", "..#..", "..#..", "..#..", ".###." } },
+    { 'J', { "..###", "...#.", "...#.", "...#.", "...#.", "#..#.", ".##.." } },
+    { 'K', { "#...#", "#..#.", "#.#..", "##...", "#.#..", "#..#.", "#...#" } },
+    { 'L', { "#....", "#....", "#....", "#....", "#....", "#....", "#####" } },
+    { 'M', { "#...#", "##.##", "#.#.#", "#.#.#", "#...#", "#...#", "#...#" } },
+    { 'N', { "#...#", "#...#", "##..#", "#.#.#", "#..##", "#...#", "#...#" } },
+    { 'O', { ".###.", "#...#", "#...#", "#...#", "#...#", "#...#", ".###." } },
+    { 'P', { "####.", "#...#", "#...#", "####.", "#....", "#....", "#...." } },
+    { 'Q', { ".###.", "#...#", "#...#", "#...#", "#.#.#", "#..#.", ".##.#" } },
+    { 'R', { "####.", "#...#", "#...#", "####.", "#.#..", "#..#.", "#...#" } },
+    { 'S', { ".####", "#....", "#....", ".###.", "....#", "....#", "####." } },
+    { 'T', { "#####", "..#..", "..#..", "..#..", "..#..", "..#..", "..#.." } },
+    { 'U', { "#...#", "#...#", "#...#", "#...#", "#...#", "#...#", ".###." } },
+    { 'V', { "#...#", "#...#", "#...#", "#...#", "#...#", ".#.#.", "..#.." } },
+    { 'W', { "#...#", "#...#", "#...#", "#.#.#", "#.#.#", "#.#.#", ".#.#." } },
+    { 'X', { "#...#", "#...#", ".#.#.", "..#..", ".#.#.", "#...#", "#...#" } },
+    { 'Y', { "#...#", "#...#", ".#.#.", "..#..", "..#..", "..#..", "..#.." } },
+    { 'Z', { "#####", "....#", "...#.", "..#..", ".#...", "#....", "#####" } },
+    { 'a', { ".....", ".....", ".###.", "....#", ".####", "#...#", ".####" } },
+    { 'b', { "#....", "#....", "#.##.", "##..#", "#...#", "#...#", "####." } },
+    { 'c', { ".....", ".....", ".###.", "#....", "#....", "#...#", ".###." } },
+    { 'd', { "....#", "....#", ".##.#", "#..##", "#...#", "#...#", ".####" } },
+    { 'e', { ".....", ".....", ".###.", "#...#", "#####", "#....", ".###." } },
+    { 'f', { "..##.", ".#..#", ".#...", "###..", ".#...", ".#...", ".#..." } },
+    { 'g', { ".....", ".####", "#...#", "#...#", ".####", "....#", ".###." } },
+    { 'h', { "#....", "#....", "#.##.", "##..#", "#...#", "#...#", "#...#" } },
+    { 'i', { "..#..", ".....", ".##..", "..#..", "..#..", "..#..", ".###." } },
+    { 'j', { "...#.", ".....", "..##.", "...#.", "...#.", "#..#.", ".##.." } },
+    { 'k', { "#....", "#....", "#..#.", "#.#..", "##...", "#.#..", "#..#." } },
+    { 'l', { ".##..", "..#..", "..#..", "..#..", "..#..", "..#..", ".###." } },
+    { 'm', { ".....", ".....", "##.#.", "#.#.#", "#.#.#", "#...#", "#...#" } },
+    { 'n', { ".....", ".....", "#.##.", "##..#", "#...#", "#...#", "#...#" } },
+    { 'o', { ".....", ".....", ".###.", "#...#", "#...#", "#...#", ".###." } },
+    { 'p', { ".....", ".....", "####.", "#...#", "####.", "#....", "#...." } },
+    { 'q', { ".....", ".....", ".##.#", "#..##", ".####", "....#", "....#" } },
+    { 'r', { ".....", ".....", "#.##.", "##..#", "#....", "#....", "#...." } },
+    { 's', { ".....", ".....", ".###.", "#....", ".###.", "....#", "####." } },
+    { 't', { ".#...", ".#...", "###..", ".#...", ".#...", ".#..#", "..##." } },
+    { 'u', { ".....", ".....", "#...#", "#...#", "#...#", "#..##", ".##.#" } },
+    { 'v', { ".....", ".....", "#...#", "#...#", "#...#", ".#.#.", "..#.." } },
+    { 'w', { ".....", ".....", "#...#", "#...#", "#.#.#", "#.#.#", ".#.#." } },
+    { 'x', { ".....", ".....", "#...#", ".#.#.", "..#..", ".#.#.", "#...#" } },
+    { 'y', { ".....", ".....", "#...#", "#...#", ".####", "....#", ".###." } },
+    { 'z', { ".....", ".....", "#####", "...#.", "..#..", ".#...", "#####" } },
+};
+
+#endif
@@ -0,0 +1,516 @@
+#include "emulator.h"
+#include <math.h>
+#include "font5x7.h"
+
+static lgfx::LGFX_Device* lastPanel = nullptr;
+
+lgfx::LGFX_Device* emulatorPanel() {
+    return lastPanel;
+}
+
+namespace lgfx {
+
+static uint16_t swapBytes(uint16_t value) {
+    return (uint16_t)((value << 8) | (value >> 8));
+}
+
+// ---- Fonts ----
+
+struct FontMetrics {
+    int height;
+    int scaleX;     // 5x7 glyph scale (bitmap fonts)
+    int scaleY;
+    int offsetY;    // Glyph top inside the cell
+};
+
+static FontMetrics fontMetrics(uint8_t font) {
+    switch (font) {
+        case 4: return { 26, 2, 3, 2 };
+        case 7: return { 48, 0, 0, 0 };    // 7-segment, see below
+        default: return { 16, 1, 2, 1 };   // Font 2 and anything else
+    }
+}
+
+static const Glyph5x7* findGlyph(char c) {
+    for (size_t i = 0; i < sizeof(FONT_5X7) / sizeof(FONT_5X7[0]); i++) {
+        if (FONT_5X7[i].c == c) {
+            return &FONT_5X7[i];
+        }
+    }
+    return nullptr;
+}
+
+// Used columns of a 5x7 glyph, for proportional spacing
+static void glyphColumns(const Glyph5x7* glyph, int* first, int* last) {
+    *first = 5;
+    *last = -1;
+    for (int row = 0; row < 7; row++) {
+        for (int col = 0; col < 5; col++) {
+            if (glyph->rows[row][col] == '#') {
+                if (col < *first) *first = col;
+                if (col > *last) *last = col;
+            }
+        }
+    }
+}
+
+// 7-segment layout of font 7 in a 32 x 48 cell: segments a-g as rectangles
+struct Segment {
+    int x, y, w, h;
+};
+
+static const Segment SEGMENTS[7] = {
+    { 6, 2, 20, 5 },    // a
+    { 25, 5, 5, 18 },   // b
+    { 25, 26, 5, 18 },  // c
+    { 6, 41, 20, 5 },   // d
+    { 2, 26, 5, 18 },   // e
+    { 2, 5, 5, 18 },    // f
+    { 6, 22, 20, 5 },   // g
+};
+
+// Bit 0 = segment a ... bit 6 = g
+static const uint8_t DIGIT_SEGMENTS[10] = {
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+static int font7Advance(char c) {
+    if ((c >= '0' && c <= '9') || c == '-' || c == ' ') return 32;
+    if (c == '.' || c == ':') return 12;
+    return 0;  // Not in the font
+}
+
+static int glyphAdvance(char c, uint8_t font) {
+    if (font == 7) {
+        return font7Advance(c);
+    }
+    FontMetrics metrics = fontMetrics(font);
+    const Glyph5x7* glyph = findGlyph(c);
+    if (c == ' ') {
+        return 4 * metrics.scaleX;
+    }
+    if (glyph == nullptr) {
+        return 6 * metrics.scaleX;
+    }
+    int first, last;
+    glyphColumns(glyph, &first, &last);
+    return (last - first + 1) * metrics.scaleX + 2 * metrics.scaleX;
+}
+
+// ---- LGFXBase ----
+
+LGFXBase::LGFXBase()
+    : _width(0), _height(0), _clipLeft(0), _clipTop(0), _clipRight(0), _clipBottom(0), _clipped(false),
+      _textColor(0xFFFF), _textBackground(0), _textFillBackground(false), _textDatum(top_left), _textSize(1),
+      _pixelsWritten(0) {
+}
+
+void LGFXBase::resetClip() {
+    _clipped = false;
+    _clipLeft = 0;
+    _clipTop = 0;
+    _clipRight = _width;
+    _clipBottom = _height;
+}
+
+void LGFXBase::setClipRect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    _clipped = true;
+    _clipLeft = x < 0 ? 0 : x;
+    _clipTop = y < 0 ? 0 : y;
+    _clipRight = x + w > _width ? _width : x + w;
+    _clipBottom = y + h > _height ? _height : y + h;
+}
+
+void LGFXBase::clearClipRect() {
+    resetClip();
+}
+
+void LGFXBase::plot(int32_t x, int32_t y, uint32_t color) {
+    int32_t right = _clipped ? _clipRight : _width;
+    int32_t bottom = _clipped ? _clipBottom : _height;
+    int32_t left = _clipped ? _clipLeft : 0;
+    int32_t top = _clipped ? _clipTop : 0;
+    if (x < left || y < top || x >= right || y >= bottom) {
+        return;
+    }
+    storePixel(x, y, color);
+    _pixelsWritten++;
+}
+
+void LGFXBase::hline(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    for (int32_t i = 0; i < w; i++) {
+        plot(x + i, y, color);
+    }
+}
+
+void LGFXBase::writeColor565(int32_t x, int32_t y, uint16_t rgb565) {
+    plot(x, y, fromColor565(rgb565));
+}
+
+uint16_t LGFXBase::readPixel565(int32_t x, int32_t y) const {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return 0;
+    }
+    return loadPixel565(x, y);
+}
+
+void LGFXBase::fillScreen(uint32_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void LGFXBase::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    plot(x, y, color);
+}
+
+void LGFXBase::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    for (int32_t row = 0; row < h; row++) {
+        hline(x, y + row, w, color);
+    }
+}
+
+void LGFXBase::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    hline(x, y, w, color);
+    hline(x, y + h - 1, w, color);
+    for (int32_t row = 1; row < h - 1; row++) {
+        plot(x, y + row, color);
+        plot(x + w - 1, y + row, color);
+    }
+}
+
+void LGFXBase::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int32_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int32_t sx = x0 < x1 ? 1 : -1;
+    int32_t sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+    while (true) {
+        plot(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void LGFXBase::drawCircle(int32_t cx, int32_t cy, int32_t r, uint32_t color) {
+    int32_t x = r;
+    int32_t y = 0;
+    int32_t err = 1 - r;
+    while (x >= y) {
+        plot(cx + x, cy + y, color);
+        plot(cx - x, cy + y, color);
+        plot(cx + x, cy - y, color);
+        plot(cx - x, cy - y, color);
+        if (x != y) {
+            plot(cx + y, cy + x, color);
+            plot(cx - y, cy + x, color);
+            plot(cx + y, cy - x, color);
+            plot(cx - y, cy - x, color);
+        }
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+}
+
+void LGFXBase::fillCircle(int32_t cx, int32_t cy, int32_t r, uint32_t color) {
+    for (int32_t dy = -r; dy <= r; dy++) {
+        int32_t dx = (int32_t)sqrt((double)(r * r - dy * dy) + r * 0.5);
+        if (dx > r) dx = r;
+        hline(cx - dx, cy + dy, 2 * dx + 1, color);
+    }
+}
+
+void LGFXBase::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    if (r * 2 > w) r = w / 2;
+    if (r * 2 > h) r = h / 2;
+    for (int32_t row = 0; row < h; row++) {
+        int32_t inset = 0;
+        int32_t dy = row < r ? r - row : (row >= h - r ? row - (h - r - 1) : 0);
+        if (dy > 0) {
+            inset = r - (int32_t)sqrt((double)(r * r - (dy - 0.5) * (dy - 0.5)));
+        }
+        hline(x + inset, y + row, w - 2 * inset, color);
+    }
+}
+
+void LGFXBase::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+    int32_t xs[3] = { x0, x1, x2 };
+    int32_t ys[3] = { y0, y1, y2 };
+    int32_t top = y0 < y1 ? (y0 < y2 ? y0 : y2) : (y1 < y2 ? y1 : y2);
+    int32_t bottom = y0 > y1 ? (y0 > y2 ? y0 : y2) : (y1 > y2 ? y1 : y2);
+    for (int32_t y = top; y <= bottom; y++) {
+        double left = 1e9;
+        double right = -1e9;
+        for (int edge = 0; edge < 3; edge++) {
+            int32_t ax = xs[edge], ay = ys[edge];
+            int32_t bx = xs[(edge + 1) % 3], by = ys[(edge + 1) % 3];
+            if ((y < ay && y < by) || (y > ay && y > by)) continue;
+            double x = ay == by ? ax : ax + (double)(y - ay) * (bx - ax) / (by - ay);
+            if (ay == by) {
+                left = fmin(left, fmin(ax, bx));
+                right = fmax(right, fmax(ax, bx));
+            } else {
+                left = fmin(left, x);
+                right = fmax(right, x);
+            }
+        }
+        if (left <= right) {
+            int32_t start = (int32_t)lround(left);
+            hline(start, y, (int32_t)lround(right) - start + 1, color);
+        }
+    }
+}
+
+void LGFXBase::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    pushImage(x, y, w, h, (const swap565_t*)data);
+}
+
+void LGFXBase::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t* data) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            writeColor565(x + col, y + row, swapBytes(data[row * w + col].raw));
+        }
+    }
+}
+
+void LGFXBase::setTextColor(uint32_t color, uint32_t background) {
+    _textColor = color;
+    _textBackground = background;
+    _textFillBackground = color != background;
+}
+
+int32_t LGFXBase::fontHeight(uint8_t font) const {
+    return fontMetrics(font).height * _textSize;
+}
+
+int32_t LGFXBase::textWidth(const char* text, uint8_t font) const {
+    int32_t width = 0;
+    for (const char* p = text; *p; p++) {
+        width += glyphAdvance(*p, font) * _textSize;
+    }
+    return width;
+}
+
+int32_t LGFXBase::drawGlyph(char c, int32_t x, int32_t y, uint8_t font) {
+    int size = _textSize;
+    int advance = glyphAdvance(c, font) * size;
+    int height = fontHeight(font);
+    if (advance == 0) {
+        return 0;
+    }
+    if (_textFillBackground) {
+        fillRect(x, y, advance, height, _textBackground);
+    }
+
+    if (font == 7) {
+        uint8_t segments = 0;
+        if (c >= '0' && c <= '9') segments = DIGIT_SEGMENTS[c - '0'];
+        if (c == '-') segments = 0x40;
+        for (int i = 0; i < 7; i++) {
+            if (segments & (1 << i)) {
+                const Segment& s = SEGMENTS[i];
+                fillRect(x + s.x * size, y + s.y * size, s.w * size, s.h * size, _textColor);
+            }
+        }
+        if (c == '.') {
+            fillRect(x + 3 * size, y + 41 * size, 5 * size, 5 * size, _textColor);
+        } else if (c == ':') {
+            fillRect(x + 3 * size, y + 12 * size, 5 * size, 5 * size, _textColor);
+            fillRect(x + 3 * size, y + 31 * size, 5 * size, 5 * size, _textColor);
+        }
+        return advance;
+    }
+
+    FontMetrics metrics = fontMetrics(font);
+    const Glyph5x7* glyph = findGlyph(c);
+    int px = metrics.scaleX * size;
+    int py = metrics.scaleY * size;
+    int top = y + metrics.offsetY * size;
+    if (glyph == nullptr) {
+        drawRect(x + px, top, 4 * px, 7 * py, _textColor);
+        return advance;
+    }
+    int first, last;
+    glyphColumns(glyph, &first, &last);
+    for (int row = 0; row < 7; row++) {
+        for (int col = first; col <= last; col++) {
+            if (glyph->rows[row][col] == '#') {
+                fillRect(x + px + (col - first) * px, top + row * py, px, py, _textColor);
+            }
+        }
+    }
+    return advance;
+}
+
+int32_t LGFXBase::drawString(const char* text, int32_t x, int32_t y, uint8_t font) {
+    int32_t width = textWidth(text, font);
+    int32_t height = fontHeight(font);
+    int horizontal = _textDatum & 3;    // 0 left, 1 center, 2 right
+    int vertical = _textDatum >> 2;     // 0 top, 1 middle, 2 bottom
+    if (horizontal == 1) x -= width / 2;
+    if (horizontal == 2) x -= width;
+    if (vertical == 1) y -= height / 2;
+    if (vertical == 2) y -= height;
+
+    for (const char* p = text; *p; p++) {
+        x += drawGlyph(*p, x, y, font);
+    }
+    return width;
+}
+
+// ---- LGFX_Device ----
+
+bool LGFX_Device::init() {
+    resize();
+    lastPanel = this;
+    return true;
+}
+
+void LGFX_Device::setRotation(uint8_t rotation) {
+    _rotation = rotation & 3;
+    resize();
+}
+
+void LGFX_Device::resize() {
+    int w = 320;
+    int h = 172;
+    if (_panel != nullptr) {
+        w = _panel->config().panel_width;
+        h = _panel->config().panel_height;
+    }
+    if (_rotation & 1) {
+        int t = w;
+        w = h;
+        h = t;
+    }
+    _width = w;
+    _height = h;
+    _frame.assign((size_t)w * h, 0);
+    resetClip();
+}
+
+void LGFX_Device::storePixel(int32_t x, int32_t y, uint32_t color) {
+    _frame[(size_t)y * _width + x] = (uint16_t)color;
+}
+
+uint16_t LGFX_Device::loadPixel565(int32_t x, int32_t y) const {
+    return _frame[(size_t)y * _width + x];
+}
+
+// ---- LGFX_Sprite ----
+
+void* LGFX_Sprite::createSprite(int32_t w, int32_t h) {
+    deleteSprite();
+    _width = w;
+    _height = h;
+    if (_depth == 16) {
+        _owned.assign((size_t)w * h, 0);
+        _pixels16 = _owned.data();
+    } else {
+        _indices.assign(indexStride() * h, 0);
+        createPalette();
+    }
+    resetClip();
+    return getBuffer();
+}
+
+void LGFX_Sprite::deleteSprite() {
+    _owned.clear();
+    _indices.clear();
+    _pixels16 = nullptr;
+    _width = 0;
+    _height = 0;
+    resetClip();
+}
+
+void LGFX_Sprite::setBuffer(void* buffer, int32_t w, int32_t h, uint8_t bits) {
+    _depth = bits != 0 ? bits : 16;
+    _pixels16 = (uint16_t*)buffer;
+    _width = w;
+    _height = h;
+    resetClip();
+}
+
+bool LGFX_Sprite::createPalette() {
+    int colors = 1 << (_depth < 8 ? _depth : 8);
+    _palette.assign(colors, 0);
+    _palette[colors - 1] = 0xFFFF;
+    return true;
+}
+
+void LGFX_Sprite::setPaletteColor(size_t index, uint32_t rgb565) {
+    if (index < _palette.size()) {
+        _palette[index] = (uint16_t)rgb565;
+    }
+}
+
+uint8_t LGFX_Sprite::readIndex(int32_t x, int32_t y) const {
+    size_t bit = (size_t)x * _depth;
+    int shift = 8 - _depth - (int)(bit & 7);
+    return (_indices[y * indexStride() + bit / 8] >> shift) & ((1 << _depth) - 1);
+}
+
+void LGFX_Sprite::writeIndex(int32_t x, int32_t y, uint8_t index) {
+    size_t bit = (size_t)x * _depth;
+    int shift = 8 - _depth - (int)(bit & 7);
+    uint8_t mask = ((1 << _depth) - 1) << shift;
+    uint8_t& byte = _indices[y * indexStride() + bit / 8];
+    byte = (byte & ~mask) | ((index << shift) & mask);
+}
+
+void LGFX_Sprite::storePixel(int32_t x, int32_t y, uint32_t color) {
+    if (hasPalette()) {
+        writeIndex(x, y, (uint8_t)color);
+    } else {
+        _pixels16[(size_t)y * _width + x] = swapBytes((uint16_t)color);
+    }
+}
+
+uint16_t LGFX_Sprite::loadPixel565(int32_t x, int32_t y) const {
+    if (hasPalette()) {
+        uint8_t index = readIndex(x, y);
+        return index < _palette.size() ? _palette[index] : 0;
+    }
+    return swapBytes(_pixels16[(size_t)y * _width + x]);
+}
+
+uint32_t LGFX_Sprite::fromColor565(uint16_t rgb565) const {
+    if (!hasPalette()) {
+        return rgb565;
+    }
+    for (size_t i = 0; i < _palette.size(); i++) {
+        if (_palette[i] == rgb565) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+void LGFX_Sprite::pushSprite(LovyanGFX* dst, int32_t x, int32_t y) {
+    push(dst, x, y, false, 0);
+}
+
+void LGFX_Sprite::pushSprite(LovyanGFX* dst, int32_t x, int32_t y, uint32_t transparent) {
+    push(dst, x, y, true, transparent);
+}
+
+void LGFX_Sprite::push(LovyanGFX* dst, int32_t x, int32_t y, bool useTransparent, uint32_t transparent) {
+    for (int32_t row = 0; row < _height; row++) {
+        for (int32_t col = 0; col < _width; col++) {
+            if (useTransparent) {
+                uint32_t raw = hasPalette() ? readIndex(col, row) : swapBytes(_pixels16[(size_t)row * _width + col]);
+                if (raw == transparent) {
+                    continue;
+                }
+            }
+            dst->writeColor565(x + col, y + row, loadPixel565(col, row));
+        }
+    }
+}
+
+}  // namespace lgfx
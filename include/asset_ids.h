@@ -0,0 +1,13 @@
+// Generated by tools/build_assets.py from data/*.png - do not edit
+
+#ifndef ASSET_IDS_H
+#define ASSET_IDS_H
+
+#include <stdint.h>
+
+enum AssetId : uint8_t {
+    ASSET_BABY_BATH_172 = 0,
+    ASSET_COUNT = 1
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <Arduino.h>
+#include "asset_ids.h"
+#include "rle_image.h"
+
+/**
+ * @brief Encoding of an asset in assetData
+ */
+enum AssetFormat : uint8_t {
+    ASSET_FORMAT_NONE = 0,
+    ASSET_FORMAT_RGB565_RLE = 1    // RleImage rows (tools/rle_image.py)
+};
+
+/**
+ * @brief Manifest entry of one flash resource
+ *
+ * Images in data/ are encoded at build time by tools/build_assets.py into
+ * one PROGMEM blob (assetData) and this manifest, both in the generated
+ * src/asset_data.cpp; the AssetId enum comes from the generated
+ * asset_ids.h. Look assets up by ID, or by file name for names that come
+ * from configuration.
+ */
+struct AssetInfo {
+    const char* name;      // File name without extension, e.g. "baby-bath_172"
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;        // AssetFormat
+    uint32_t offset;       // Into assetData
+    uint32_t size;         // Encoded bytes
+    uint32_t checksum;     // FNV-1a of the decoded pixels
+};
+
+extern const uint8_t assetData[];
+extern const AssetInfo assetManifest[];
+
+const AssetInfo* assetInfo(AssetId id);
+int assetFind(const char* name);
+bool assetImage(AssetId id, RleImage* image);
+
+#endif
@@ -1,2482 +0,0 @@
-// Auto-generated from data/baby-bath_172.png
-// Image size: 172x172
-// RGB565 format with byte swap for LovyanGFX
-
-#ifndef BABY_BATH_IMAGE_H
-#define BABY_BATH_IMAGE_H
-
-#include <Arduino.h>
-
-const uint16_t baby_bath_image_width = 172;
-const uint16_t baby_bath_image_height = 172;
-
-const uint16_t baby_bath_image[] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x6110, 0xC218, 0xA218, 
-    0xA218, 0xC220, 0x4008, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x6529, 0x4529, 0x8210, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA218, 0x0329, 0xC220, 
-    0x6110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8118, 0x8110, 0x0000, 0x0000, 0xE220, 0xE320, 
-    0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0xA310, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xA310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8218, 0x0329, 
-    0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x475A, 0x8862, 0xA96A, 0x675A, 0x0000, 0x0000, 
-    0x8118, 0x0000, 0x0000, 0x0000, 0x4110, 0xE320, 0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4108, 0x0000, 0x0000, 0xEF7B, 0x55A5, 0xD394, 0xA210, 0x0000, 0xA210, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0xE320, 0x2008, 0x0000, 0x0000, 0xE649, 0xCD93, 0xF0C4, 0xB3DD, 0x34EE, 0x55F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x93DD, 0x2752, 0x0000, 0x0000, 0xCD93, 0x0A73, 0x0000, 0x0000, 0x0000, 0xE220, 
-    0x8110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x8208, 0x6108, 0x0000, 0xF8BD, 0xDFF7, 0xDFF7, 0xDFF7, 0xFCDE, 0x4942, 
-    0x0000, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xA220, 0xA218, 0x0000, 0x0000, 0xAC8B, 0x72D5, 0x55F6, 0xB6FE, 0xD7FE, 
-    0xB6FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xB6FE, 0x34EE, 0xC541, 0x0000, 0xD0BC, 0xB6FE, 
-    0xD3E5, 0x8FAC, 0xC641, 0x0000, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0421, 0x0421, 
-    0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x0000, 0x928C, 0xDFF7, 0x9EEF, 
-    0x7EE7, 0x7DE7, 0xFFF7, 0x79C6, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE220, 0x0000, 0x0000, 0xAC93, 0xD3E5, 0x96FE, 
-    0xB6FE, 0x96FE, 0x55F6, 0xB3DD, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 
-    0xD0BC, 0x0000, 0xA86A, 0x75FE, 0xB6FE, 0x96FE, 0x55F6, 0xD0BC, 0x4431, 0x0000, 0xA218, 0x6110, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0421, 0xA210, 0x0000, 0x0000, 0x0000, 0x0419, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4521, 
-    0x0000, 0x38BE, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0xBEEF, 0x3DDF, 0x6529, 0x0000, 0x2421, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0xE220, 0x0000, 0x2752, 
-    0x92D5, 0x96FE, 0x96FE, 0x75FE, 0x55F6, 0x96FE, 0xF0BC, 0x0000, 0xAFB4, 0x96FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x92D5, 0x0000, 0x2752, 0x55F6, 0x75FE, 0x55F6, 0x96FE, 0xB6FE, 
-    0x35EE, 0xED9B, 0x0000, 0x0000, 0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x0000, 0x694A, 0xEB52, 0xE739, 0x0000, 0x0000, 0xC318, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4521, 0x0000, 0xF7B5, 0xDFF7, 0x7DE7, 0x9EEF, 0x7EEF, 0xBEEF, 0x3CDF, 
-    0x4108, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 
-    0x8118, 0x0000, 0xCD93, 0x55F6, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x6EAC, 0x0000, 
-    0x6B83, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x72D5, 0x0000, 0x2752, 0x55F6, 
-    0x76FE, 0x75FE, 0x75FE, 0x55F6, 0x96FE, 0x96FE, 0x51CD, 0x0000, 0x0000, 0xC220, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC310, 0x0000, 0x107C, 0xDBD6, 0x7DE7, 0x9EEF, 
-    0x5DE7, 0x38BE, 0x694A, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0x0000, 0x8E6B, 0xBEEF, 0xDFF7, 
-    0x9EEF, 0x9EEF, 0xFFF7, 0xB6B5, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x8110, 0x4008, 0x0000, 0xAFB4, 0x96FE, 0x96FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 
-    0x75F6, 0xB6FE, 0x31CD, 0x0000, 0xC549, 0x35F6, 0x96FE, 0x55F6, 0x75F6, 0x75FE, 0x55F6, 0xB6FE, 
-    0x2EA4, 0x0000, 0x2A7B, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xB6FE, 0xF4E5, 
-    0xE649, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x149D, 
-    0xDFF7, 0xDFF7, 0x9EEF, 0x9EEF, 0xBEEF, 0xDFF7, 0x5DE7, 0xEB5A, 0x0000, 0xE318, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xC318, 0x0000, 0x928C, 0x5DE7, 0x9EEF, 0x9EEF, 0x18BE, 0x0000, 0x0000, 0x8208, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x8118, 0x0000, 0x11C5, 0xB6FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x35F6, 0x6439, 0x0000, 0xCD93, 0x96FE, 0xB6FE, 
-    0x96FE, 0x96FE, 0xB6FE, 0x72D5, 0x0000, 0x0000, 0x11C5, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x34EE, 0x2752, 0x0000, 0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xE418, 0x0000, 0x6D63, 0xBEEF, 0xBEEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 0xDFF7, 0xFBD6, 
-    0x0000, 0x0000, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x0000, 0x0421, 0x6E6B, 0x694A, 0x0000, 0x0000, 
-    0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x2419, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0xD0BC, 
-    0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 0x10C5, 
-    0x0000, 0x0000, 0x4B83, 0x92D5, 0x14EE, 0xF3E5, 0x8FB4, 0xE220, 0x0000, 0xE972, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x14EE, 0x8539, 0x0000, 
-    0xA220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x38C6, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x7EE7, 0xDFEF, 0x718C, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 
-    0x0000, 0x0000, 0xE318, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x8210, 0x2421, 0xA210, 0xC310, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xE220, 0x0000, 0x0DA4, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x8FB4, 0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0x0000, 0x0000, 
-    0xA96A, 0x35F6, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x55F6, 0xB6FE, 0xB3DD, 0x0000, 0x2000, 0x4008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x2000, 0x0000, 0xFCD6, 0xBEEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0xD7B5, 0x0000, 0x2521, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xA210, 0x4521, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8208, 0x2000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0xA86A, 0x75FE, 0x76FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x92D5, 0x4B83, 0x6439, 
-    0x0000, 0x6110, 0x6862, 0xAFB4, 0x55F6, 0x96FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0xF0BC, 0x0000, 0xE220, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2419, 
-    0x0000, 0x0000, 0xFCD6, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 
-    0xF8BD, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0x2000, 0x96AD, 0xDBD6, 0xBACE, 
-    0xF394, 0x0000, 0x2000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 0x2008, 0x0000, 0xD3E5, 0x96FE, 0x75F6, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x96FE, 0x96FE, 0x34EE, 0xF3E5, 0x14EE, 0x75F6, 0xB6FE, 0x76FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 
-    0x2A7B, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x9ACE, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0xF39C, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x6108, 0x0000, 
-    0x79CE, 0xFFF7, 0xBFEF, 0xDFF7, 0xFFF7, 0x96AD, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE220, 0x0000, 
-    0x4EA4, 0xB6FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0x96FE, 0x76FE, 0x75F6, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xD3E5, 0x0000, 0x4010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x0000, 0x5184, 0xDFF7, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 0xBFEF, 0x5DE7, 0xE739, 0x0000, 0xE318, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x2421, 0x0000, 0x107C, 0xDFF7, 0x9EEF, 0x9EEF, 0x7EE7, 0xBEEF, 0x7EE7, 0x694A, 0x0000, 
-    0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x6110, 0x0000, 0xC220, 0x34EE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x55F6, 0x75F6, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75F6, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x75F6, 0x55F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 0xED9B, 0x0000, 0xE320, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0xC318, 0x0000, 0x18BE, 0xDFF7, 0xBEEF, 0x9EEF, 0x7EE7, 0x9EEF, 0xDFEF, 0xDFF7, 0x718C, 
-    0x0000, 0xE418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x55A5, 0xDFEF, 0x7EE7, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0xBEEF, 0x107C, 0x0000, 0x8629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE328, 0x0000, 0x4EA4, 0xB6FE, 0x75F6, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB6FE, 0x96FE, 0x96FE, 0xB6FE, 0x76FE, 0x55F6, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 
-    0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x75FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x96FE, 0xF3E5, 0x0000, 0x2008, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x0000, 0x0000, 0x76AD, 0x7DE7, 0xBFEF, 0xDFF7, 
-    0xBEEF, 0x1CDF, 0x3084, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x0000, 0x307C, 
-    0xDFF7, 0x9EEF, 0x7EE7, 0x7EE7, 0xBEEF, 0x7EEF, 0x694A, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC220, 0x2000, 0x0000, 0xD3E5, 
-    0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0x14EE, 0x72D5, 0x11C5, 
-    0x31CD, 0xB3DD, 0x55F6, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75F6, 0x96FE, 0x96FE, 0xF4E5, 0x52D5, 0x11C5, 0x31CD, 0xD3E5, 0x76FE, 0xB6FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x6B83, 0x0000, 0x0329, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x2000, 
-    0x0000, 0x2842, 0x928C, 0xF39C, 0x107C, 0x0000, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x6108, 0x6108, 0x0000, 0x7ACE, 0xFFF7, 0xBFEF, 0xDFF7, 0xFFF7, 0x96AD, 0x0000, 0xE318, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xE220, 0x0000, 0x0A7B, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x34F6, 
-    0x0D9C, 0x0329, 0x0000, 0x0000, 0x0000, 0x0000, 0x275A, 0xF0C4, 0x96FE, 0x96FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xD3E5, 0x6B83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xC96A, 0x72D5, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x11C5, 0x0000, 
-    0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x6108, 0x0419, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0419, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x0000, 0xA210, 0x96AD, 0xDBD6, 0xBACE, 
-    0xF39C, 0x0000, 0x2000, 0x4100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x4110, 0x2329, 0x0329, 0x6439, 0x0000, 0xAFB4, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 
-    0x75F6, 0x96FE, 0xF3E5, 0xC649, 0x0000, 0x0000, 0xA541, 0xEA72, 0xA96A, 0x2008, 0x0000, 0x0000, 
-    0xCC93, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x72D5, 0x0000, 0x0000, 0x0000, 
-    0x2752, 0x0A7B, 0x6862, 0x0000, 0x0000, 0x0000, 0xAFB4, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x96FE, 0x14EE, 0x6110, 0xC220, 0x0329, 0x2329, 0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 0x6529, 0x8629, 
-    0x4521, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3DD, 0x96FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x8FB4, 0x0000, 0xC649, 0x11C5, 0x35F6, 0x75FE, 
-    0x75FE, 0x14EE, 0x2EA4, 0x0000, 0x0000, 0xF4ED, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 
-    0x6B83, 0x0000, 0xC96A, 0x92D5, 0x55F6, 0x76FE, 0x55FE, 0xD3E5, 0x6B8B, 0x0000, 0x6431, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xC972, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xC220, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x0421, 0xA210, 0xC318, 0x0421, 0x6108, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA118, 0x0000, 0x0000, 0xAC8B, 0x6EAC, 
-    0x4EA4, 0x31CD, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x76FE, 0x35F6, 0xD0BC, 
-    0xF4E5, 0xB6FE, 0x96FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0x51CD, 0x51CD, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xF4E5, 0xD0BC, 0x35F6, 0xB6FE, 0x76FE, 0x75FE, 0x75FE, 0xB6FE, 
-    0x75FE, 0xF0C4, 0xB3DD, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xF3E5, 
-    0x4EAC, 0x6FAC, 0x0D9C, 0x475A, 0x0000, 0x6110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA218, 0x0000, 
-    0x8862, 0xF4E5, 0x96FE, 0x96FE, 0xB6FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x76FE, 0xB6FE, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 
-    0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB6FE, 0x96FE, 0x55F6, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xB6FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB6FE, 0x96FE, 0x96FE, 0x75FE, 0x8FAC, 0x0000, 0x8118, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x8118, 0x0000, 0x6439, 0x34EE, 0xB6FE, 0x55F6, 0x75F6, 0x75FE, 0x75F6, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x75F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x75FE, 0x55F6, 0x76FE, 
-    0xB6FE, 0x2EA4, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE328, 0x0000, 0xAFB4, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 0x14EE, 0x8110, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0419, 0x2421, 0x0419, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0xA218, 0x0000, 0x92D5, 
-    0x96FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xA96A, 0x0000, 
-    0x2331, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xE318, 0x2421, 0xA210, 0x0000, 0x0000, 0x0000, 0x8210, 0x2521, 0xE318, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0221, 0xA218, 0x0000, 0x72D5, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0xA862, 0x0000, 0x2431, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x2421, 0xC731, 0x2421, 
-    0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x0000, 0x6EAC, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x96FE, 0x14EE, 0x0000, 0x0000, 0xA218, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xE318, 0x0000, 0x083A, 0x55A5, 
-    0xDBD6, 0x3CDF, 0x5DE7, 0x3DDF, 0xDBD6, 0x75AD, 0x4942, 0x0000, 0xC310, 0x6108, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6110, 0x0000, 0x4008, 
-    0xF4E5, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0xAC8B, 0x0000, 0xC220, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xA210, 
-    0x0000, 0xD394, 0x5DE7, 0xDFF7, 0xBFEF, 0xBEEF, 0xBEEF, 0xBEEF, 0xBFEF, 0xDFF7, 0x7DE7, 0x149D, 
-    0x0000, 0x4108, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x8118, 0x0000, 0xC649, 0x93DD, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x35EE, 
-    0xCD93, 0x0000, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xC318, 0x0000, 0x96AD, 0xDFF7, 0xBEEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x7DE7, 0xBEEF, 0xDFF7, 0xF7B5, 0x0000, 0xC310, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8118, 0x0000, 0x0000, 0xC96A, 0xCC93, 
-    0xAC8B, 0xB0BC, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB3DD, 
-    0xAC93, 0xCD93, 0x4B83, 0x2329, 0x0000, 0xA118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2421, 
-    0x6629, 0x4529, 0x8208, 0x0000, 0x0000, 0x0421, 0x0000, 0xF394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0x349D, 0x0000, 0x0421, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xA218, 0x8110, 0x0000, 0x0000, 0x0000, 0x0000, 0x93DD, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x76FE, 0x96FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 
-    0x96FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x96FE, 0x6862, 0x0000, 0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x6108, 0x2421, 0xA210, 0x0000, 0x0000, 0x0000, 0x8208, 0x2421, 0xE318, 0x0000, 0x2842, 0x7DE7, 
-    0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0xBEEF, 0x9EE7, 0xAA52, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xE220, 0xE328, 0x4431, 0x0000, 0x8FB4, 0xB6FE, 
-    0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 
-    0x72D5, 0x2752, 0x31CD, 0xB6FE, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x55F6, 0x75FE, 0xB6FE, 0xB3DD, 0x685A, 0xD0BC, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xF4ED, 0x0000, 0xE220, 0xE328, 0x0329, 0x8118, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xC318, 0x2000, 0x0000, 0x0000, 0xE739, 0xEB5A, 0x2842, 0x0000, 0x0000, 
-    0xC318, 0x0000, 0x75A5, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0xD7B5, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xC220, 0x0000, 0xC96A, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x4EAC, 0x0000, 0x0000, 0x6EAC, 0x55F6, 0xB6FE, 0x96FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB6FE, 0x76FE, 0xF0C4, 0xE220, 0x0000, 0x0A7B, 0x96FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0xF0C4, 0x0000, 
-    0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x0000, 0xF394, 0xDBD6, 0x5DE7, 
-    0x9EEF, 0x5DE7, 0xDBD6, 0x55A5, 0xE318, 0x0000, 0x1CDF, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0xFBD6, 0x0000, 
-    0x4108, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xE318, 0x2421, 
-    0x2521, 0x2421, 0x2421, 0xC318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC220, 0x6110, 0x0000, 0xB3DD, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xAC93, 0x0000, 0x0000, 
-    0x475A, 0xF0BC, 0x14EE, 0x75FE, 0x96FE, 0x96FE, 0x75FE, 0x14EE, 0x31CD, 0xEA72, 0x0000, 0x0000, 
-    0xA86A, 0x14EE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x96FE, 0x0A73, 0x0000, 0x0329, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x2842, 
-    0xDBD6, 0xDFF7, 0xBFEF, 0xBEEF, 0xBEEF, 0xBEEF, 0xBFEF, 0xDFF7, 0x1CDF, 0xFBD6, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0xBEEF, 0x7DE7, 0x494A, 0x0000, 0x6529, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0419, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xE318, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x0000, 0x0D9C, 
-    0x96FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x96FE, 0x96FE, 0xB0B4, 0xC218, 0x0000, 0x0000, 0x0000, 0xA96A, 0x4B83, 0x4B83, 0xE972, 0x0329, 
-    0x0000, 0x0000, 0x0000, 0x2DA4, 0x55F6, 0x96FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB3DD, 0x0000, 0x8110, 0x8118, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xA210, 0x0000, 0x6529, 0x1CDF, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 
-    0xBEEF, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x107C, 0x0000, 0x0000, 0xA210, 0xA210, 
-    0x0000, 0x0000, 0x0000, 0x0419, 0x0000, 0x0000, 0xA631, 0x8E6B, 0x3084, 0x1084, 0x6D6B, 0x6108, 
-    0x0000, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x4008, 0x0000, 0x0000, 0xF4ED, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xB6FE, 0x14EE, 0x4EAC, 0x2752, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA541, 0xED9B, 0xD3E5, 0x96FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x8C8B, 0x0000, 0xE320, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x18BE, 0xDFF7, 0x7DE7, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x5DE7, 
-    0x59C6, 0x5184, 0x0000, 0x0000, 0xA210, 0x0000, 0x0419, 0x0000, 0xCB52, 0x18BE, 0x5DE7, 0xBEEF, 
-    0xBEEF, 0xBEEF, 0x9EEF, 0x3CDF, 0x96AD, 0x8629, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE220, 0x0000, 0xCC93, 0x96FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 
-    0x96FE, 0x55F6, 0xB3DD, 0x11C5, 0xD0BC, 0xD0BC, 0xF0C4, 0xB3DD, 0x35F6, 0x96FE, 0x96FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 
-    0x92DD, 0x0000, 0xA118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2521, 0x0000, 0xCB5A, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0xDFF7, 0xDFF7, 0x59C6, 0x0000, 0x0000, 0x8631, 0x0000, 0xD394, 
-    0x9EEF, 0xDFF7, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0xDFF7, 0x5DE7, 0xCF73, 0x0000, 
-    0x0419, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0xA118, 
-    0x0000, 0x92D5, 0xB6FE, 0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 0x96FE, 0xB6FE, 0xB6FE, 0xB6FE, 0xB6FE, 0x96FE, 
-    0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x76FE, 0x75FE, 0xA86A, 0x0000, 0xC220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x8631, 
-    0x0000, 0x149D, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x9EEF, 0xFFF7, 0x9ACE, 
-    0x0000, 0x0000, 0x149D, 0xDFF7, 0xBEEF, 0x7DE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7DE7, 0xBFEF, 0xBEEF, 0xEF7B, 0x0000, 0x0419, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xA218, 0x0000, 0xE649, 0x55F6, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x55F6, 
-    0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x6EAC, 0x0000, 0xE220, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0421, 0x0421, 0x0000, 0x0000, 0x0000, 0xB6AD, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x59C6, 0x96AD, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xBFEF, 0x7DE7, 0x4942, 0x0000, 0xC318, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE220, 0x0000, 0x6B83, 0x96FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x52D5, 0x0000, 
-    0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xA310, 0xE318, 0x0000, 0x0000, 0x0000, 0x8A4A, 0x4D63, 0x1CDF, 0xBEEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFEF, 0xDFF7, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 
-    0x18BE, 0x0000, 0xE418, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0xE220, 0x0000, 0x4EA4, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 
-    0xB6FE, 0xD3E5, 0x0000, 0x0000, 0x8118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 0x0000, 0x0000, 0xAE73, 0x38BE, 0x1CDF, 0x7DE7, 
-    0x9EEF, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EE7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x7DE7, 0x494A, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0329, 0x0000, 0x6FAC, 0xB6FE, 0x76FE, 0x75F6, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0xD3E5, 0x0329, 0x0000, 0x8118, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 0x0000, 0xC318, 0x38BE, 
-    0xBEEF, 0xDFF7, 0xBEEF, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x9EEF, 0xDFF7, 
-    0xDFEF, 0xBFEF, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0x718C, 0x0000, 0x4521, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8118, 0x0000, 0x0000, 
-    0x0000, 0x0D9C, 0x96FE, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0xB6FE, 0x92D5, 0x0329, 0x0000, 0x0000, 0xA118, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC310, 
-    0x0000, 0x8529, 0xFBD6, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0xDFF7, 0x7DE7, 0x38C6, 0xD394, 0xF07B, 0x59C6, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x7EE7, 0x7EE7, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 
-    0xDFEF, 0x55A5, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xA218, 0x0000, 0x0652, 0xAC93, 0x0000, 0x0000, 0x0A7B, 0x14EE, 0xB6FE, 0x75FE, 0x75F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x96FE, 0x96FE, 0xB0B4, 0x0000, 
-    0x0000, 0x8862, 0x8C8B, 0x0000, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x4108, 0xA210, 0x0000, 0x9ACE, 0xDFF7, 0x7DE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0x79C6, 0x8A4A, 0x0000, 0x0000, 0x0000, 0xAA52, 0xBEEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0xDFF7, 
-    0xDFF7, 0xDFF7, 0xBEEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x96AD, 0x0000, 0x2421, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x6110, 0x0000, 0x0000, 0xB3DD, 0xB6FE, 0x8FB4, 0x0000, 0x0000, 0x4431, 
-    0x11C5, 0x75FE, 0xB6FE, 0x75FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x75FE, 0x96FE, 0xB6FE, 
-    0xF3E5, 0x4A83, 0x0000, 0x0000, 0xC96A, 0x35EE, 0x96FE, 0x2A7B, 0x0000, 0xC220, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x0000, 0xB294, 0xDFF7, 0x7EE7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFEF, 0x18BE, 0x0000, 0x0000, 0x0000, 
-    0x6D6B, 0x928C, 0x9ACE, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x5DE7, 0x55A5, 0x76AD, 0x59C6, 0x5DE7, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0xF394, 0x0000, 0x2421, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0x31C5, 0xB6FE, 0x75FE, 
-    0x96FE, 0x72D5, 0xC541, 0x0000, 0x0000, 0xE972, 0x72D5, 0x75FE, 0xB6FE, 0x96FE, 0x75FE, 0x75F6, 
-    0x75F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x55F6, 0x75FE, 0x96FE, 
-    0xB6FE, 0x96FE, 0x14EE, 0x2EA4, 0x0000, 0x0000, 0x0000, 0x2EA4, 0x75FE, 0x96FE, 0x96FE, 0x55F6, 
-    0xE649, 0x0000, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x8210, 0x0000, 
-    0xDBD6, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0xDBD6, 
-    0x0000, 0x0000, 0xAB52, 0xBACE, 0x9EEF, 0xBFEF, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x75A5, 0x0000, 0x0000, 0x0000, 0x2842, 0xB6B5, 
-    0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0xDFF7, 0xCF73, 0x0000, 0x6629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE220, 0x0000, 
-    0xED9B, 0x96FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x35F6, 0x0D9C, 0x0000, 0x0000, 0x0000, 0xE972, 
-    0xF0C4, 0x14EE, 0x96FE, 0xB6FE, 0xB6FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 
-    0xB6FE, 0x96FE, 0x96FE, 0x55F6, 0x92D5, 0xED9B, 0xC220, 0x0000, 0x0000, 0x8862, 0x92D5, 0x96FE, 
-    0x76FE, 0x75FE, 0x75F6, 0xB6FE, 0xB3DD, 0x0000, 0x8118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x6529, 0x0000, 0x2C63, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0xBEEF, 0x5184, 0x0000, 0x083A, 0x3CDF, 0xFFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0xFBD6, 0xAE73, 
-    0xEB5A, 0x0000, 0x0000, 0x0000, 0x5184, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x9ACE, 0xC731, 0x0000, 0xE318, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x8110, 0x0000, 0x6431, 0x35F6, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x96FE, 0x96FE, 
-    0xB3DD, 0x8C8B, 0x0000, 0x0000, 0x0000, 0xE320, 0x4A83, 0x8FB4, 0x52D5, 0xF3E5, 0x34EE, 0x35F6, 
-    0x55F6, 0x55F6, 0x35F6, 0x14EE, 0x92DD, 0xF0C4, 0xCD93, 0x2752, 0x0000, 0x0000, 0x0000, 0x475A, 
-    0xF0BC, 0x75FE, 0xB6FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0xB6FE, 0x2DA4, 0x0000, 0xE220, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x5184, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x3DE7, 0xC739, 0x0000, 0xB6AD, 0xDFF7, 0x7DE7, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0xBEEF, 0xBEEF, 0x9EEF, 0xDBD6, 0x107C, 0x0000, 0x0000, 0x149D, 0xBFEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0x5DE7, 0x107C, 
-    0x0000, 0x0421, 0x0000, 0x0000, 0x0000, 0xC220, 0x0000, 0xF0C4, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0xD3E5, 0x2EA4, 0x0752, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x4431, 0xA541, 0xE649, 0xC641, 0x6439, 0xA218, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x8118, 0x6B83, 0x31CD, 0x55F6, 0xB6FE, 0x76FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x96FE, 0x35F6, 0x4431, 0x0000, 0xC218, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0x0000, 0xB394, 
-    0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x9ACE, 0x0000, 
-    0x0000, 0xBBCE, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0xBEEF, 0x928C, 
-    0x0000, 0x0000, 0xDBD6, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0xBEEF, 0xBEEF, 0x107C, 0x0000, 0xE318, 0x0000, 0xC220, 0x0000, 0x2752, 0x55F6, 
-    0x76FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0xB6FE, 
-    0x55F6, 0x92D5, 0x6FAC, 0x4B83, 0x2752, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xA541, 0xA96A, 0x0D9C, 0x31C5, 0x14EE, 0x96FE, 0xB6FE, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x96FE, 0x8FB4, 0x0000, 0xE220, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x6529, 0x0000, 0x7184, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0xDFF7, 0xDBD6, 0x0000, 0x4521, 0x5DE7, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x7DE7, 0xBEEF, 0x7EE7, 0x694A, 0x0000, 0xD394, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xBFEF, 0x5DE7, 0x2842, 0x0000, 0xC310, 
-    0xE320, 0x0000, 0xD0BC, 0xB6FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x96FE, 0xB6FE, 0x96FE, 0x55F6, 0x14EE, 0xB3DD, 0x92DD, 
-    0x72D5, 0x92D5, 0x92DD, 0xD3E5, 0x35F6, 0x75FE, 0x96FE, 0xB6FE, 0x96FE, 0x75FE, 0x55F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x14EE, 0xA218, 
-    0x0000, 0x4110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x4D63, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x79C6, 0xBACE, 0xBEEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 0xDFF7, 0x55A5, 0x0000, 0x6D6B, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 
-    0xDFF7, 0xF7B5, 0x0000, 0x0421, 0x0000, 0x6110, 0x14EE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0x75FE, 
-    0x76FE, 0x96FE, 0xB6FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0xB6FE, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x96FE, 0xCC93, 0x0000, 0x0329, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0x6108, 0x0000, 
-    0xFBD6, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 
-    0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 
-    0xF7BD, 0x0000, 0x4942, 0x7DE7, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x5DE7, 0x6529, 0x2010, 0x0000, 0x6B83, 0x96FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x55F6, 0xB6FE, 0x52CD, 0x0000, 0xC220, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x2421, 0x0000, 0xF39C, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x1CDF, 0x2842, 0x928C, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x107C, 0x0000, 
-    0x0000, 0xF0BC, 0x96FE, 0x55F6, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x34EE, 
-    0x2431, 0x0000, 0x0329, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6108, 0x6108, 0x0000, 0xBACE, 0xDFF7, 0x7DE7, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EE7, 0xDFF7, 0xD394, 0x0000, 0x0100, 0xB3DD, 0x96FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 0x75FE, 
-    0x75FE, 0x75FE, 0x75FE, 0x96FE, 0x0A7B, 0x0000, 0x0329, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC318, 
-    0x0000, 0xC739, 0x1CDF, 0xDFF7, 0x9EEF, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 
-    0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 
-    0x7DE7, 0x9EEF, 0x9EEF, 0x7DE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 
-    0x7EE7, 0x7EE7, 0x7EE7, 0x7EE7, 0x7DE7, 0xBFEF, 0xF394, 0x0000, 0xC641, 0x14EE, 0x75FE, 0x55F6, 
-    0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 
-    0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 
-    0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 
-    0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x55F6, 0x96FE, 0x2EA4, 0x0000, 0x0329, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x6529, 0x79CE, 0xDFEF, 0xDFF7, 0xDFF7, 0xDFF7, 
-    0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 
-    0xBFEF, 0x9EEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0x9EEF, 0xBFEF, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 
-    0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 
-    0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xDFF7, 0xFFF7, 0x3084, 0x0000, 
-    0xC96A, 0x96FE, 0xB6FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 
-    0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 
-    0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 
-    0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0x96FE, 0xD7FE, 
-    0x10C5, 0x0000, 0xE328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE318, 0x0000, 0x0000, 
-    0x5184, 0x38C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 
-    0x59C6, 0x59C6, 0x59C6, 0x79C6, 0xFCDE, 0xBEEF, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFEF, 0xBEEF, 0x1CDF, 
-    0x79C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 
-    0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 
-    0x59C6, 0x38BE, 0xE741, 0x0000, 0xA96A, 0x72D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 
-    0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 
-    0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 
-    0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 0x52D5, 
-    0x52D5, 0x52D5, 0x52CD, 0x92D5, 0x4EAC, 0x0000, 0xA220, 0x6220, 0x8220, 0x8220, 0x8220, 0x8220, 
-    0x8220, 0x8220, 0x8220, 0x6220, 0x6220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x2008, 0x4120, 0x8210, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF73, 0xBACE, 0xDFF7, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0xDFF7, 0xDBD6, 0xCF7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2010, 0x6220, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2118, 0x0000, 0x0000, 0x4649, 0xC759, 0xC859, 0xC759, 0xC759, 
-    0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0x8649, 
-    0x0000, 0x0000, 0x0000, 0xF7B5, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0xF7B5, 0x0000, 0x0000, 0x0000, 0x8649, 0xA759, 0xC759, 0xC759, 
-    0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 
-    0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0xC759, 0x6659, 0x6651, 
-    0x6659, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 
-    0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 
-    0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 
-    0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 0xA759, 
-    0x8759, 0x6651, 0x6659, 0x6659, 0x6659, 0x6659, 0x6659, 0x6659, 0x6659, 0x6659, 0x6659, 0x6651, 
-    0x2549, 0x0000, 0x0000, 0x4118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2110, 0x0000, 0xACA2, 0x12EC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x33FC, 0xD1DB, 0x297A, 0x0000, 0x0000, 0x79C6, 0xDFF7, 0x7EE7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xDFF7, 0x7ACE, 0x0000, 0x0000, 0x2972, 0xB1DB, 
-    0x33FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x33FC, 0xF2EB, 0x6B92, 0x0000, 0x2110, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6220, 0x0000, 
-    0x0EB3, 0x94FC, 0x74FC, 0x54FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x54FC, 0x74FC, 0x54FC, 0x4A82, 0x0000, 
-    0x8A52, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xCB5A, 
-    0x0000, 0x4A7A, 0x54FC, 0x94FC, 0x54FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x54FC, 0x74FC, 0x74FC, 0xEDB2, 
-    0x0000, 0x6220, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x8220, 0x0000, 0x8761, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x53FC, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x53FC, 0x54FC, 
-    0x53FC, 0x74FC, 0x12EC, 0x0409, 0x0000, 0x59C6, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EE7, 0xDFF7, 0x7AC6, 0x0000, 0xC200, 0xF2EB, 0x74FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x53FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 
-    0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x53FC, 0x53FC, 0x54FC, 0x53FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x53FC, 0x54FC, 0x53FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 
-    0x54FC, 0x53FC, 0x74FC, 0x54FC, 0xA761, 0x0000, 0x8228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA328, 0x0000, 0xEDB2, 0x74FC, 0x53FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x74FC, 0x6B8A, 0x0000, 0x34A5, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x55AD, 0x0000, 0x4A82, 0x74FC, 0x53FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x74FC, 0x0EB3, 0x0000, 0xA328, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8228, 0x0000, 0x2FC3, 
-    0x74FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x74FC, 0xCDA2, 
-    0x0000, 0xB294, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x14A5, 0x0000, 
-    0xAC92, 0x74FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x53FC, 0x74FC, 
-    0x4FC3, 0x0000, 0x8228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x8328, 0x0000, 0xACA2, 0x74FC, 0x53FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x53FC, 0x74FC, 0xEDA2, 0x0000, 0xB294, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EE7, 0xDFF7, 0x14A5, 0x0000, 0xAC92, 0x74FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 0x54FC, 
-    0x54FC, 0x54FC, 0x53FC, 0x74FC, 0xACA2, 0x0000, 0xA328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4118, 0x0000, 0x6220, 0x12F4, 0x74FC, 0x53FC, 0x54FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x74FC, 0xCDA2, 0x0000, 0xB294, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x14A5, 0x0000, 0xAC92, 0x74FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x53FC, 
-    0x53FC, 0x53FC, 0x53FC, 0x53FC, 0x54FC, 0x53FC, 0x74FC, 0x13F4, 0x8220, 0x0000, 0x6118, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4118, 0x0000, 
-    0xE871, 0x33F4, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x95FC, 0xEDAA, 
-    0x0000, 0xB294, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x34A5, 0x0000, 
-    0xCC9A, 0x95FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 
-    0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x74FC, 0x33F4, 0xE979, 
-    0x0000, 0x6120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x4118, 0x0000, 0x0441, 0x0EB3, 0xB1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xF2E3, 0x8B8A, 0x0000, 0xB294, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EEF, 0xDFF7, 0x14A5, 0x0000, 0x6A82, 0xF2E3, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 0xD1DB, 
-    0xB1DB, 0x0EB3, 0x0441, 0x0000, 0x4118, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4118, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8100, 0x0000, 0xB28C, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x149D, 0x0000, 0xC200, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4118, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x4118, 0x8228, 0x4218, 0x4118, 0x0018, 0x2521, 0xA729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0xA729, 0x6621, 
-    0x0000, 0xB294, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x149D, 0x0000, 
-    0x4529, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 0x8729, 
-    0x8729, 0x8729, 0x8729, 0x8729, 0xA729, 0x2521, 0x0018, 0x4118, 0x4118, 0x8228, 0x4118, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 0xB55C, 0x9E86, 
-    0x5D7E, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x5D7E, 0x9E86, 0x1254, 0x0000, 0xB394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xB14B, 0x9E86, 0x5D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 
-    0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x7D86, 0x5D7E, 0x9E86, 0x955C, 0x0000, 0x0511, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0511, 0x0000, 0xD14B, 0xDF8E, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBE86, 0xFF8E, 0x535C, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xDF8E, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 0xBF86, 
-    0xDF8E, 0xD14B, 0x0000, 0x0411, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xC408, 0x0000, 0x2A2A, 0x7E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 
-    0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 
-    0xF253, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x7E86, 0x2A2A, 0x0000, 0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6200, 0x2100, 0x0000, 0x1C7E, 
-    0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 
-    0xDF8E, 0x9E86, 0x5D86, 0x7E86, 0xBF86, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x1C7E, 0x0000, 0x2100, 0x6200, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xA200, 0xC408, 0x0000, 0x586D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF86, 0x7D86, 0x955C, 0x0E43, 0x092A, 0x8B3A, 0xB14B, 0xBA75, 0xBF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0x586D, 0x0000, 0xC408, 0xA200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 0x7454, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 
-    0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 
-    0xF253, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x1C7E, 0x2A2A, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x955C, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x7454, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x2E3B, 
-    0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 0xBE86, 0x7E86, 0x4A2A, 0x0000, 
-    0xA400, 0x149D, 0x59C6, 0xF7B5, 0x6E6B, 0x0000, 0x0000, 0x3765, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x0E3B, 0x0000, 0x2511, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0511, 0x0000, 0x6719, 0x5D86, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 
-    0xDF8E, 0xD664, 0x0000, 0x0200, 0x79C6, 0xDFF7, 0xDFF7, 0xDFF7, 0xBEEF, 0x3184, 0x0000, 0xE929, 
-    0x7D86, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x5D86, 
-    0x6619, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8208, 0x8300, 0x0000, 0xDB75, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 
-    0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EEF, 0xDFF7, 0x349D, 0x0000, 
-    0xF253, 0xBF86, 0x9E86, 0x9E86, 0xBE86, 0x4F43, 0x0000, 0xD394, 0xDFF7, 0x7EE7, 0x9EEF, 0x7DE7, 
-    0xDFF7, 0x1CDF, 0x0000, 0x0000, 0xBA75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xBF86, 0xDF8E, 0xDF8E, 0xDF8E, 0xBF86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0xDA75, 0x0000, 0xA308, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 
-    0xF764, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0xD394, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7EEF, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x2E43, 0x0000, 0xF7B5, 
-    0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 0xAA4A, 0x0000, 0x376D, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0xDF8E, 0x9E86, 0x1C7E, 
-    0x9975, 0x786D, 0xBA75, 0x3C7E, 0x9E86, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xF764, 0x0000, 0x0511, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0511, 0x0000, 0xF24B, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x5354, 0x0000, 0xB394, 0xDFF7, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x349D, 0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 
-    0xBE86, 0x0E43, 0x0000, 0x55A5, 0xDFF7, 0x7DE7, 0x9EEF, 0x7DE7, 0xBEEF, 0x5DE7, 0x4521, 0x0000, 
-    0x996D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0x3C7E, 0x745C, 0x6A32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0xED42, 0xF664, 0x7D86, 0xDF8E, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xD24B, 
-    0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC408, 0x0000, 0x6B2A, 0x9E86, 0xBE86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 
-    0x0000, 0xB394, 0xBFEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0x349D, 0x0000, 
-    0xF253, 0xBF86, 0x9E86, 0x9E86, 0xDF8E, 0x5454, 0x0000, 0x293A, 0x5DE7, 0xFFF7, 0xBEEF, 0xBFEF, 
-    0xFFF7, 0x55A5, 0x0000, 0xE318, 0x5D7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xBE86, 0xBF86, 0xF664, 0xA020, 0x0000, 0x0000, 0x0100, 0x6352, 0xC462, 0x0342, 0x0000, 
-    0x0000, 0x0000, 0x0832, 0x9A6D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xBE86, 0x9E86, 0x6B2A, 0x0000, 0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8300, 0x0000, 
-    0x0000, 0x1C7E, 0xBF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0x745C, 0x0000, 0x7284, 0xBFEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0xDFF7, 0xF494, 0x0000, 0x3354, 0xDF8E, 0x9E86, 0x9E86, 0xBF86, 0x3C7E, 0x0008, 0x0000, 
-    0x0C5B, 0x7ACE, 0x3CDF, 0x1CDF, 0x349D, 0x0000, 0x0000, 0x5454, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xF24B, 0x0000, 0x0000, 0x8452, 0x63BD, 0x61E6, 
-    0xE0F6, 0x00FF, 0xC0F6, 0x41E6, 0xE3AC, 0x6429, 0x0000, 0x0000, 0xF764, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x1C7E, 0x0000, 0x0000, 0x6200, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0xC308, 0x0000, 0x796D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x586D, 0x0000, 0x283A, 0x7DE7, 0xBEEF, 
-    0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x0C5B, 0x0000, 0xF664, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0xDF8E, 0x796D, 0x0000, 0x0000, 0x0000, 0x2521, 0x0000, 0x0000, 0x0000, 0x2F3B, 0x9E86, 
-    0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x5354, 0x0000, 0x0500, 
-    0xA2A4, 0xE0F6, 0x41FF, 0x41FF, 0x21FF, 0x01FF, 0x21FF, 0x21FF, 0x41FF, 0xA0EE, 0x837B, 0x0300, 
-    0x0000, 0x586D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x796D, 0x0000, 
-    0xC308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 0x955C, 0xDF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x5D7E, 
-    0x6621, 0x0000, 0x55A5, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xFFF7, 0xD7B5, 0x0000, 0x0008, 
-    0x1C7E, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xDA75, 0x0E43, 0x0008, 0x0000, 0x0000, 
-    0xC829, 0x955C, 0x9E86, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0x996D, 0x0000, 0x0400, 0x01B5, 0x41FF, 0x21FF, 0x21FF, 0xE1F6, 0x21FF, 0x21FF, 0x01F7, 0x01FF, 
-    0xE1F6, 0x21FF, 0x20FF, 0xA283, 0x0000, 0xE020, 0x3C7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xDF8E, 0x745C, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 
-    0x0000, 0x4F3B, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xB55C, 0x0000, 0x0000, 0x76AD, 0x9EEF, 0xBFEF, 0xBEEF, 0x9EEF, 
-    0xD7B5, 0x0200, 0x0000, 0x3354, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0xBE86, 0x1C7E, 0xFB75, 0xFB75, 0x5D86, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xAC3A, 0x0000, 0x038C, 0x20FF, 0x21FF, 0xE1F6, 0x609C, 0x4052, 
-    0xC083, 0xA1EE, 0x21FF, 0x01FF, 0x01FF, 0xE1F6, 0x21FF, 0xE0F6, 0x644A, 0x0000, 0x3354, 0xDF8E, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x2F3B, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 0xA819, 0x7D86, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9043, 0x0000, 0x0000, 
-    0xEB52, 0x928C, 0x928C, 0x0C5B, 0x0000, 0x0000, 0xED3A, 0x7E86, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xDF8E, 0xDF8E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xBA75, 0x0000, 0x0400, 0x80E6, 0x21FF, 
-    0x21FF, 0xA0A4, 0x0000, 0x2000, 0x0000, 0x807B, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x41FF, 
-    0xA2CD, 0x0000, 0x6429, 0x5D7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x7D86, 0xA719, 0x0000, 
-    0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA208, 0x8200, 0x0000, 0xFB75, 0xDF8E, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xBE86, 0x9E86, 0x745C, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x3354, 0x7E86, 0xBF86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x745C, 
-    0x0000, 0xC483, 0x20FF, 0x01FF, 0x01FF, 0xE062, 0x0000, 0x2029, 0x0021, 0xE020, 0xC1F6, 0x21FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x21FF, 0xE1F6, 0x0442, 0x0000, 0x786D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xDF8E, 0xDB75, 0x0000, 0x8200, 0xA208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0511, 0x0000, 0x1765, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xDF8E, 0x3C7E, 0xF664, 0x745C, 0x745C, 0x1765, 
-    0x1C7E, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF86, 0x8F4B, 0x0000, 0x23B5, 0x41FF, 0xE1F6, 0x41FF, 0x80A4, 0x0000, 0x6010, 
-    0x0000, 0x607B, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0xE483, 0x0000, 0xB564, 
-    0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x1765, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0xF24B, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 
-    0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x9E86, 0xAB3A, 0x0000, 0xC3CD, 0x21FF, 0xE1F6, 
-    0x21FF, 0xE1F6, 0x409C, 0x004A, 0xA083, 0xA1EE, 0x21FF, 0x01F7, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x40FF, 0xA4A4, 0x0000, 0x1254, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xF24B, 0x0000, 0x0511, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0000, 0x8C32, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xED42, 
-    0x0000, 0xC3CD, 0x61FF, 0xE1F6, 0x01FF, 0x21FF, 0x21FF, 0xE1F6, 0x21FF, 0x21FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01F7, 0x40FF, 0xC4AC, 0x0000, 0xF153, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x8B32, 0x0000, 0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x8208, 0x0000, 0x0000, 0x3C7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xDF8E, 0x9E86, 0xEC3A, 0x0000, 0xA383, 0xE1F6, 0x41FF, 0x01FF, 0xE1F6, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 0x40FF, 0xC4A4, 0x0000, 0xF153, 
-    0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x3C7E, 0x0000, 0x0000, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC308, 0x0000, 0x996D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xDF8E, 0xDB75, 0xCC3A, 0x0000, 0x0200, 0x0000, 0x004A, 0xC0CD, 
-    0x21FF, 0x21FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 
-    0x40FF, 0xC4AC, 0x0000, 0xF153, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x996D, 0x0000, 0xC308, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0000, 0x955C, 
-    0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x7E86, 0x5454, 0x0000, 0x0000, 0x0200, 
-    0x409C, 0xE049, 0x0000, 0x0000, 0x008C, 0xA1EE, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01F7, 0x40FF, 0xC4AC, 0x0000, 0xF153, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0x955C, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x2511, 0x0000, 0x6F43, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0xDB75, 0xE921, 
-    0x0000, 0x0200, 0x637B, 0x40DE, 0x41FF, 0x81EE, 0x008C, 0x8010, 0x0000, 0xA018, 0xC0CD, 0x21FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 0x40FF, 0xC4AC, 0x0000, 0xF153, 
-    0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x6F43, 0x0000, 0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0xE821, 0x7D86, 0xBE86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0xDF8E, 0xBF8E, 0xBF86, 0xDF8E, 0xDF8E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xDF8E, 0x2E3B, 0x0000, 0xC800, 0xA083, 0x20FF, 0x61FF, 0x21FF, 0x61FF, 0x40FF, 0x609C, 
-    0x0000, 0x0000, 0x4029, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 
-    0x40FF, 0xC4A4, 0x0000, 0xF153, 0xBF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x7D86, 0xC821, 0x0000, 0x2511, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA308, 0x6200, 0x0000, 
-    0xFB75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xBF86, 0xBF86, 0xDA75, 0x945C, 0xF253, 0xD14B, 0x3354, 0x1765, 0x5D7E, 0xDF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0xDB75, 0x0511, 0x0000, 0x0319, 0x246B, 0x849C, 
-    0x04B5, 0xA4A4, 0x6473, 0x4129, 0x0000, 0x0000, 0xC0CD, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x20FF, 0xC4AC, 0x0000, 0x1254, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xFB75, 
-    0x0000, 0x6200, 0xA308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xE408, 0x0000, 0x3865, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x5D7E, 0x9043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x4521, 0xD664, 0xBE86, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3C7E, 
-    0x9043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x20DE, 0x41FF, 0xE1F6, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x21FF, 0x81FF, 0xC4AC, 0x0000, 0xB053, 
-    0x9E86, 0xBE86, 0xDF8E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0x3765, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x1354, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x1C7E, 0xA721, 0x0000, 0x0000, 
-    0x4D63, 0xF494, 0x349D, 0x928C, 0xA731, 0x0000, 0x0000, 0xF24B, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xBF86, 0xBF86, 0xFB75, 0xB564, 0xF153, 0x8F4B, 0xF153, 0xB564, 0xA721, 
-    0x0000, 0x82A4, 0x21FF, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0xA1EE, 
-    0xE0B4, 0x6052, 0x0000, 0xC218, 0xC729, 0x4E43, 0x1765, 0x7D86, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x1354, 0x0000, 0x2511, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC408, 0x0000, 
-    0xAC32, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x9E86, 
-    0x6B32, 0x0000, 0xE500, 0x18BE, 0xBEEF, 0xDFF7, 0xBFEF, 0xDFF7, 0x5DE7, 0x928C, 0x0000, 0x0000, 
-    0xD65C, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xDF8E, 0xDF86, 
-    0xBF86, 0xBF86, 0xFF8E, 0x3765, 0x0000, 0x0300, 0xC083, 0xA1EE, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x21FF, 0x21FF, 0x40BD, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE731, 
-    0x1765, 0xBE86, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xAC32, 
-    0x0000, 0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x8308, 0x0000, 0x8308, 0x3C7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0xD65C, 0x0000, 0x0000, 0x7ACE, 0xFFF7, 0x9EEF, 0x7EE7, 0x7EEF, 0x9EEF, 
-    0xBFEF, 0xDFF7, 0xB294, 0x0000, 0x8018, 0x3C7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xBF86, 0x4F43, 0x2028, 0x0300, 0xA039, 
-    0xE1F6, 0x01FF, 0x01F7, 0x21FF, 0x01FF, 0x0094, 0x0000, 0x0000, 0xA062, 0x40BD, 0x20DE, 0x61E6, 
-    0x02D6, 0xC3A4, 0xA431, 0x0000, 0x0000, 0x2E43, 0xFB7D, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xBF86, 0x3C7E, 0x8200, 0x0000, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC308, 0x0000, 0x9A75, 0xDF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x8B3A, 0x0000, 0x149D, 0xDFF7, 0x7EE7, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xBEEF, 0x5DE7, 0x293A, 0x0000, 0xD65C, 0xDF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xDF8E, 0xBA75, 0x4E43, 
-    0xC210, 0x0000, 0x0000, 0x2094, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xA083, 0x0000, 0x0000, 0xC0AC, 
-    0x01FF, 0x41FF, 0x41FF, 0x21FF, 0x41FF, 0x40FF, 0xA0EE, 0x83A4, 0x0400, 0x0000, 0x0020, 0xB55C, 
-    0x9E86, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 
-    0xDF8E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x9A75, 0x0000, 0xC308, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0411, 
-    0x0000, 0xB55C, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x1B7E, 0x0008, 
-    0x0000, 0xDBD6, 0xDFF7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7EE7, 0xDFF7, 0xF49C, 
-    0x0000, 0xB04B, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF8E, 
-    0x7E86, 0x1254, 0x0008, 0x0000, 0x0000, 0xE08B, 0x20DE, 0x21FF, 0x01FF, 0x01FF, 0x21FF, 0x609C, 
-    0x0000, 0x0000, 0x60C5, 0x41FF, 0x21FF, 0xE1F6, 0x01FF, 0x01FF, 0x01F7, 0x01F7, 0x21FF, 0x41FF, 
-    0x20DE, 0xE462, 0x0000, 0x0000, 0x8A3A, 0x586D, 0x9E86, 0xDF8E, 0xDF8E, 0xDF8E, 0xBF86, 0xDF8E, 
-    0xDF8E, 0xDF8E, 0xBF86, 0xDB75, 0x3354, 0xBA75, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xB55C, 0x0000, 
-    0x0511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x9043, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xDF8E, 0xBA75, 0x0000, 0xC731, 0x5DE7, 0xBEEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x9EEF, 0x7EEF, 0xDFF7, 0xB6AD, 0x0000, 0x4F43, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF8E, 0x3C7E, 0x4A32, 0x0000, 0x0300, 0x847B, 0x41DE, 0x21FF, 0x41FF, 0x01FF, 
-    0xE1F6, 0x41FF, 0x60C5, 0x0000, 0x0000, 0x40BD, 0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x00FF, 0x02B5, 0x0400, 0x0000, 0x0000, 0x6A3A, 0x745C, 
-    0x9975, 0x1B7E, 0x3C7E, 0x1C7E, 0xBA75, 0xF664, 0x2E43, 0x0000, 0x0000, 0xED3A, 0xBF86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0xBF86, 0x9043, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x0922, 0x7D86, 0xBE86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xDA75, 0x0000, 0x2519, 0x3CDF, 0xBEEF, 0x9EEF, 
-    0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x7DE7, 0xDFF7, 0x96AD, 0x0000, 0x6F4B, 0xBE86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x5D7E, 0xC829, 0x0000, 0xC500, 0x80C5, 0x21FF, 
-    0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x81E6, 0x6010, 0x0000, 0x609C, 0x41FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x80E6, 
-    0x2294, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x2519, 
-    0x0000, 0xB55C, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x7D86, 0xE921, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC408, 
-    0x4100, 0x0000, 0xFB75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x3D7E, 0x6621, 
-    0x0000, 0x59C6, 0xDFF7, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0x9EEF, 0xBFEF, 0x307C, 
-    0x0000, 0xF253, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x6F43, 0x0000, 
-    0xE539, 0x60E6, 0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x807B, 0x0000, 0xA062, 
-    0x01FF, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0xE1F6, 0x21FF, 0x20FF, 0x80E6, 0x23B5, 0x847B, 0xC339, 0xA208, 0x0000, 0x0100, 
-    0x2321, 0x647B, 0x6473, 0x0200, 0x0000, 0x1C7E, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xFB75, 0x0000, 0x4100, 
-    0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0000, 0x386D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF86, 0x7043, 0x0000, 0x8E6B, 0xBEEF, 0xBEEF, 0x7EE7, 0x9EEF, 0x9EEF, 0x9EEF, 
-    0x7DE7, 0xFFF7, 0xBACE, 0x0000, 0x0000, 0x596D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xDF8E, 0xBA75, 0x0000, 0x0400, 0x00D6, 0x41FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0xE08B, 0x0000, 0x40DE, 0x41FF, 0x01F7, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x21FF, 0x01FF, 0x21FF, 0x41FF, 0x21FF, 
-    0xC0F6, 0x81EE, 0x61E6, 0x81EE, 0xA0EE, 0x20FF, 0x048C, 0x0000, 0xB04B, 0xBF86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xDF8E, 0x3865, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x3354, 0xDF8E, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xBA75, 0x0000, 0x0000, 0xD394, 0xBFEF, 
-    0xDFF7, 0xBEEF, 0x9EEF, 0xBEEF, 0xDFF7, 0x1CDF, 0x6A42, 0x0000, 0x8C32, 0x9E86, 0xBE86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x535C, 0x0000, 0xC483, 0x20FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0xC1EE, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE0AC, 0x80C5, 
-    0x21FF, 0xE1F6, 0xE1F6, 0x01FF, 0x21FF, 0x21FF, 0x21FF, 0x21FF, 0x61FF, 0x21DE, 0x0300, 0x0000, 
-    0xBA75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x3354, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xE410, 0x0000, 0xCD32, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF86, 
-    0x5354, 0x0000, 0x0000, 0xCF73, 0x9ACE, 0x5DE7, 0x7DE7, 0x1CDF, 0xD7B5, 0xA729, 0x0000, 0x0000, 
-    0xFB75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x6F4B, 0x0000, 0x23B5, 
-    0x41FF, 0x01F7, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 
-    0x41FF, 0xE0CD, 0x0000, 0xA039, 0xE1F6, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x21FF, 0x847B, 0x0000, 0x6F4B, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xCD32, 0x0000, 0xE408, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xA308, 0x0000, 0xE410, 0x5D7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x3354, 0x0000, 0x0000, 0x0000, 0x083A, 0xCB52, 0x6200, 
-    0x0000, 0x0000, 0x0419, 0xBA75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 
-    0xBE86, 0x0D43, 0x0000, 0x83C5, 0x41FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01F7, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x4073, 0x0000, 0x4094, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0xE1F6, 0x41FF, 0xA0CD, 0x0300, 0x0010, 0xDA75, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 
-    0x5D7E, 0xE408, 0x0000, 0xA308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC308, 0x0000, 0xBA75, 
-    0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x996D, 0x0E3B, 
-    0x8110, 0x0000, 0x0000, 0x0000, 0xC729, 0x1354, 0x3C7E, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x6F4B, 0x0000, 0x23B5, 0x41FF, 0xE1F6, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x21FF, 0x21FF, 0x01FF, 
-    0x01F7, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 0x01FF, 0x41FF, 0x20B5, 0x0000, 0x0000, 0x40E6, 
-    0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0xC0F6, 0xE439, 0x0000, 0x1254, 0xDF8E, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xBA75, 0x0000, 0xC308, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0xE410, 0x0000, 0xD65C, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xDF8E, 0xBE86, 0x1C7E, 0x796D, 0x586D, 0xBA75, 0x5D7E, 0xDF8E, 0xBF86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x535C, 0x0000, 0xE48B, 
-    0x20FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 
-    0xA1EE, 0x8083, 0x20B5, 0x41FF, 0x41FF, 0x21FF, 0x01FF, 0x01FF, 0x21FF, 0x41FF, 0x41FF, 0x40BD, 
-    0x0000, 0x0000, 0xC0AC, 0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x038C, 
-    0x0000, 0xA629, 0x5D7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xD65C, 0x0000, 0xE410, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2511, 0x0000, 0x7043, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0xDF8E, 0xDF8E, 0xDF8E, 
-    0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xDF8E, 0x996D, 0x0000, 0x0400, 0x80E6, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0xE1F6, 0x41FF, 0x00D6, 0x0000, 0x0000, 0x008C, 0x20DE, 0xC1F6, 0x01FF, 0x01FF, 
-    0xA1EE, 0x00D6, 0xC083, 0x0000, 0x0000, 0xA083, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0xE1F6, 0x41FF, 0x20BD, 0x0400, 0x0000, 0x796D, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 
-    0x7043, 0x0000, 0x2511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0000, 0x6200, 
-    0x3C7E, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x9E86, 0x8A3A, 0x0000, 0x0394, 0x40FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x80A4, 0x0000, 0x0000, 
-    0x0000, 0xC039, 0xE06A, 0xE06A, 0x8031, 0x0000, 0x0000, 0x0000, 0x609C, 0x01FF, 0x21FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x41FF, 0xE0D5, 0x0500, 0x0000, 0x5354, 0xDF8E, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF86, 0x3C7E, 0x4100, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0411, 0x0000, 0xB55C, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0x796D, 0x0000, 
-    0x0400, 0x60BD, 0x41FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x21FF, 0xE0D5, 0xA083, 0x2029, 0x0000, 0x0000, 0x0000, 0x0000, 0x4031, 0xA083, 0xE0D5, 
-    0x21FF, 0x21FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x41FF, 0x20DE, 0x0500, 0x0000, 0x2E43, 
-    0xBE86, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xB55C, 0x0000, 0xE410, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6200, 0x0000, 0xE408, 0x5D7E, 0xBF86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0xBF86, 0xF24B, 0x0000, 0x0500, 0xA0CD, 0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x21FF, 0xA1EE, 0x21DE, 0xC0CD, 0xC0CD, 
-    0x20DE, 0xA1EE, 0x21FF, 0x41FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x00D6, 
-    0x0500, 0x0000, 0x6A32, 0x7D86, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF8E, 0x5D7E, 0xA308, 
-    0x0000, 0x6200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 
-    0x0000, 0x9043, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBE86, 0x9E86, 0x2E43, 0x0000, 0x0500, 0x20BD, 
-    0x41FF, 0x21FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x21FF, 0x41FF, 0x41FF, 0x41FF, 0x41FF, 0x21FF, 0x01FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01F7, 
-    0x21FF, 0x41FF, 0xA0CD, 0x0500, 0x0000, 0x4A32, 0x5D7E, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0xBE86, 0xBF86, 0x7043, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0000, 0x745C, 0xDF8E, 0xBE86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 
-    0x9E86, 0x2E43, 0x0000, 0x0400, 0x038C, 0xA0EE, 0x41FF, 0x21FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0xE1F6, 0xE1F6, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0x41FF, 0x00FF, 0x82A4, 0x0400, 0x0000, 0xCC3A, 0x5D7E, 0xDF8E, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0xBE86, 0xDF8E, 0x745C, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC308, 0x0000, 0x5454, 
-    0xBE86, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x9E86, 0x5354, 0x0000, 0x0000, 0x8429, 0x42BD, 0xE1F6, 
-    0x41FF, 0x21FF, 0x01FF, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 0x01FF, 
-    0x01FF, 0x01FF, 0x01FF, 0xE1F6, 0x01FF, 0x41FF, 0x21FF, 0x00DE, 0xC462, 0x0000, 0x0000, 0xD24B, 
-    0x9E86, 0xBF86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xBF86, 0x5454, 0x0000, 0xC408, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0xC408, 0x0000, 0x2E3B, 0x1C7E, 0xDF8E, 0xDF8E, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xBF86, 0x796D, 
-    0x0832, 0x0000, 0x0000, 0x204A, 0x20B5, 0xA0EE, 0x21FF, 0x41FF, 0x21FF, 0x21FF, 0x01FF, 0x01FF, 
-    0x01F7, 0xE1F6, 0xE1F6, 0x01FF, 0x01FF, 0x01FF, 0x21FF, 0x41FF, 0x21FF, 0x20DE, 0xE08B, 0x0000, 
-    0x0000, 0x0018, 0xF764, 0xBF86, 0x9E86, 0x7E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 
-    0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0x9E86, 0xDF8E, 0xDF8E, 0x1B7E, 0x2E3B, 
-    0x0000, 0xC408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0000, 0x0000, 0x3354, 0xFB75, 
-    0x9E86, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 
-    0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 
-    0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 
-    0xDF8E, 0xDF8E, 0xDF8E, 0x1F8F, 0xBF86, 0x1765, 0xAB3A, 0x0100, 0x0000, 0x8010, 0xC08B, 0x80C5, 
-    0x60E6, 0xE1F6, 0x21FF, 0x41FF, 0x41FF, 0x41FF, 0x41FF, 0x41FF, 0x21FF, 0x01FF, 0x80E6, 0x60BD, 
-    0x4073, 0x0000, 0x0000, 0x4421, 0x1254, 0x5D7E, 0x1F8F, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 
-    0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0xDF8E, 0x9E86, 
-    0xFB75, 0x3354, 0x0000, 0x0000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0xC408, 0x2000, 0x0000, 0x0000, 0x8C32, 0xF24B, 0xD65C, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 
-    0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 
-    0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 
-    0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF664, 0x1765, 0x586D, 0x955C, 0xA729, 
-    0xA020, 0x0100, 0x0000, 0x0000, 0x0000, 0x805A, 0xA083, 0x609C, 0x20B5, 0x20BD, 0x20BD, 0xC0AC, 
-    0xE08B, 0xC062, 0x0000, 0x0000, 0x0000, 0xC218, 0x0018, 0x0E3B, 0x3865, 0x3865, 0xF664, 0xF764, 
-    0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 0xF764, 
-    0xF764, 0xD65C, 0xF24B, 0x8C32, 0x0000, 0x0000, 0x2000, 0xE408, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6100, 0xE408, 0x8200, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4008, 0xC018, 0x0021, 0x4008, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2008, 0x0021, 0xA018, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8200, 0xE408, 0x6100, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x2511, 0x2511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 
-    0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 
-    0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 
-    0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x8208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x2000, 0xC018, 0x0021, 0x0029, 0x2029, 0x2029, 0x2029, 0x0029, 0x0029, 0xE020, 0x2000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0xE408, 0x0511, 0x0409, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 
-    0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x2511, 0x2511, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000
-};
-
-#endif // BABY_BATH_IMAGE_H
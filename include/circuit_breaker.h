@@ -0,0 +1,56 @@
+#ifndef CIRCUIT_BREAKER_H
+#define CIRCUIT_BREAKER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Circuit breaker with exponential backoff for one remote endpoint
+ *
+ * - CLOSED: requests flow; consecutive failures are counted
+ * - OPEN: after failureThreshold consecutive failures no request is allowed
+ *   until the backoff has elapsed
+ * - HALF_OPEN: one trial is allowed; success closes the breaker, failure
+ *   reopens it with twice the previous backoff (up to maxBackoffMs)
+ *
+ * The caller decides what a failure is (e.g. timeout or 5xx, but not a 404
+ * for a misspelled entity) and asks allowRequest() before contacting the
+ * endpoint. Not thread-safe; each breaker belongs to one task.
+ */
+class CircuitBreaker {
+public:
+    enum State {
+        CLOSED,
+        OPEN,
+        HALF_OPEN
+    };
+
+    CircuitBreaker(const char* name, int failureThreshold, unsigned long baseBackoffMs, unsigned long maxBackoffMs);
+
+    bool allowRequest();
+    void recordSuccess();
+    void recordFailure();
+    void reset();
+
+    State getState() const { return state; }
+    const char* getStateName() const;
+    static const char* stateName(State state);
+    int getConsecutiveFailures() const { return consecutiveFailures; }
+    unsigned long getTotalFailures() const { return totalFailures; }
+    unsigned long getRetryInMs() const;
+
+private:
+    const char* name;
+    int failureThreshold;
+    unsigned long baseBackoffMs;
+    unsigned long maxBackoffMs;
+
+    State state;
+    int consecutiveFailures;
+    unsigned long totalFailures;
+    unsigned long backoffMs;
+    unsigned long openedAt;
+
+    void trip(unsigned long backoff);
+};
+
+#endif
@@ -3,6 +3,38 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include "temperature.h"
+
+// Sensor registry capacity and entity ID storage (see SensorRegistry)
+const int MAX_SENSORS = 8;
+const int ENTITY_ID_MAX = 128;          // Including terminator, as in the old fixed entity fields;
+                                        // NVS values that do not fit are not loaded at all
+
+/**
+ * @brief What a sensor measures, which decides how its readings are used
+ *
+ * Tank and out pipe drive bath readiness, heating in drives heating
+ * detection, room is the idle screen. Other roles are only reported.
+ * Stored in NVS as a number, so existing values must not be renumbered.
+ */
+enum SensorRole : uint8_t {
+    ROLE_NONE = 0,                      // Slot unused
+    ROLE_TANK = 1,                      // Hot water in storage tank
+    ROLE_OUT_PIPE = 2,                  // Hot water from out pipe
+    ROLE_HEATING_IN = 3,                // Heating pipe incoming
+    ROLE_ROOM = 4,                      // Room temperature
+    ROLE_RETURN_PIPE = 5,               // Heating / circulation return
+    ROLE_OTHER = 6,                     // Shown on /status only
+    ROLE_COUNT
+};
+
+/**
+ * @brief Configured sensor slot: role and Home Assistant entity
+ */
+struct SensorConfig {
+    uint8_t role;                        // SensorRole
+    char entity_id[ENTITY_ID_MAX];       // e.g. "sensor.tank_temperature"
+};
 
 /**
  * @brief Configuration data structure
@@ -18,23 +50,27 @@ struct Config {
     // Home Assistant settings
     char ha_url[128];                    // e.g., "http://192.168.1.100:8123"
     char ha_token[256];                  // Long-lived access token
+    bool ha_batch_fetch;                 // Read all entities with one /api/template request
+    bool ha_websocket;                   // Push updates over /api/websocket, polling as fallback
+    char ha_cert_sha256[65];             // Pinned server certificate SHA-256 (hex), "" = not verified
     
-    // Home Assistant Entity IDs for temperature sensors
-    char entity_tank_temp[128];          // Hot water in storage tank
-    char entity_out_pipe_temp[128];      // Hot water from out pipe
-    char entity_heating_in_temp[128];    // Heating pipe incoming
-    char entity_room_temp[128];          // Room temperature
+    // Temperature sensors; slots with an empty entity ID are unused
+    SensorConfig sensors[MAX_SENSORS];
     
     // Temperature thresholds for bath readiness
-    float min_tank_temp;                 // Minimum tank temperature for bath
-    float min_out_pipe_temp;             // Minimum out pipe temperature
+    TempCenti min_tank_temp;             // Minimum tank temperature for bath
+    TempCenti min_out_pipe_temp;         // Minimum out pipe temperature
     
     // Display settings
     int screen_brightness;               // 0-255
     bool celsius;                        // true = Celsius, false = Fahrenheit
+    int screen_dim_after;                // Idle minutes before dimming, 0 = never
+    int screen_sleep_after;              // Idle minutes before the panel sleeps, 0 = never
     
     // Polling interval (seconds)
-    int poll_interval;                   // How often to fetch from HA
+    int poll_interval;                   // Nominal interval between HA fetches
+    int poll_min_interval;               // Floor while temperatures move fast
+    int poll_max_interval;               // Ceiling while readings are flat
 };
 
 /**
@@ -43,7 +79,7 @@ struct Config {
  * Handles loading, saving, and managing all device configuration including:
  * - WiFi credentials
  * - Home Assistant connection details
- * - Entity IDs for temperature sensors
+ * - Temperature sensor slots (role + entity ID)
  * - Temperature thresholds for bath readiness
  * - Display settings
  * 
@@ -54,6 +90,9 @@ private:
     Preferences preferences;
     Config config;
     
+    void migrateSensors();
+    void saveSensors();
+    
 public:
     ConfigManager();
     void begin();
@@ -65,9 +104,16 @@ public:
     
     void setWiFi(const char* ssid, const char* password);
     void setHA(const char* url, const char* token);
-    void setEntities(const char* tank, const char* outPipe, const char* heatIn, const char* room);
-    void setThresholds(float minTank, float minOutPipe);
+    void setSensor(int slot, uint8_t role, const char* entityId);
+    void setThresholds(TempCenti minTank, TempCenti minOutPipe);
     void setBrightness(int brightness);
+    void setScreenTimeouts(int dimAfter, int sleepAfter);
+    void setBatchFetch(bool enabled);
+    void setWebSocket(bool enabled);
+    void setPollIntervals(int nominal, int minimum, int maximum);
+    void setCertPin(const char* hexSha256);
+    
+    static bool normalizeCertPin(const char* input, char* output, size_t outputSize);
 };
 
 #endif
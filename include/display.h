@@ -2,6 +2,12 @@
 #define DISPLAY_H
 
 #include <Arduino.h>
+#include "circuit_breaker.h"
+#include "config.h"
+#include "display_power.h"
+#include "screen_layout.h"
+#include "temperature.h"
+#include "trend_history.h"
 
 /**
  * @brief Temperature sensor data structure
@@ -11,11 +17,11 @@
  * Tracks hot water activity for intelligent display mode switching.
  */
 struct TemperatureData {
-    float tankTemp;
-    float outPipeTemp;
-    float heatingInTemp;
-    float roomTemp;
-    float previousTankTemp;
+    TempCenti tankTemp;
+    TempCenti outPipeTemp;
+    TempCenti heatingInTemp;
+    TempCenti roomTemp;
+    TempCenti previousTankTemp;
     bool tankValid;
     bool outPipeValid;
     bool heatingInValid;
@@ -27,6 +33,59 @@ struct TemperatureData {
     bool heatingActive;  // Track if heating is currently running
 };
 
+/**
+ * @brief Frame pacing of the heating animation (exposed on /status)
+ */
+struct AnimationStats {
+    unsigned long frames;
+    unsigned long lateFrames;      // Started more than 1.5 frame periods after the previous one
+    unsigned long avgIntervalUs;   // Between frame starts, moving average
+    unsigned long maxIntervalUs;
+    unsigned long avgRenderUs;     // Strip composition + push, moving average
+};
+
+struct DisplayRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+/**
+ * @brief What a widget looks like on screen (or should look like)
+ */
+struct WidgetState {
+    bool visible;
+    DisplayRect bounds;
+    uint32_t content;     // Changes whenever the widget's pixels change
+};
+
+/**
+ * @brief Pages of the refresh() rotation
+ * 
+ * Bath image, room temperature and trend while the bath is ready; room
+ * temperature and trend without hot water activity. The STOP sign does not
+ * rotate.
+ */
+enum RotationPage : uint8_t {
+    PAGE_BATH_IMAGE,
+    PAGE_ROOM,
+    PAGE_TREND         // Skipped until there are two samples to plot
+};
+
+/**
+ * @brief Panel traffic of refresh() (exposed on /status)
+ */
+struct RenderStats {
+    unsigned long frames;          // Refreshes that sent anything
+    unsigned long fullFrames;      // Of which whole-screen repaints
+    unsigned long paletteFrames;   // Of which composed in the palette scene buffer
+    unsigned long lastBytes;       // SPI pixel bytes of the last refresh
+    unsigned long lastTransfers;   // SPI windows of the last refresh (bands when composing)
+    unsigned long avgBytes;        // Moving average per refresh
+    uint8_t lastRects;             // Dirty rectangles of the last refresh
+};
+
 /**
  * @brief Display manager for TFT LCD interface
  * 
@@ -34,51 +93,112 @@ struct TemperatureData {
  * - Temperature visualization
  * - Bath readiness status (STOP sign or bath image)
  * - Room temperature display
+ * - Trend sparklines of tank, out pipe and heating inlet
  * - Heating activity animations
- * - Brightness control
+ * - Brightness control, idle dimming and panel sleep (DisplayPower)
  * 
  * Uses LovyanGFX library for hardware acceleration.
- * Implements smart refresh logic to minimize redraws.
+ * Rendering is retained: refresh() lays the scene out as widgets, compares
+ * them with what was drawn last time and repaints only the rectangles of
+ * widgets that appeared, disappeared or changed. Positions, colours and text
+ * come from the layout tables in screen_layout.cpp.
  */
 class DisplayManager {
 private:
     TemperatureData tempData;
     bool bathReady;
     bool previousBathReady;
-    float minTankTemp;
-    float minOutPipeTemp;
+    TempCenti minTankTemp;
+    TempCenti minOutPipeTemp;
     bool useCelsius;
     bool needsRedraw;
     bool showingBathStatus;  // Track display mode
-    bool showingBathImage;   // For alternating bath/room display
-    unsigned long lastDisplayToggle;  // Time of last toggle
+    RotationPage rotationPage;        // Current page of the rotation
+    unsigned long lastDisplayToggle;  // Time of last page change
+    CircuitBreaker::State linkState;  // Worst Home Assistant breaker state
+    bool wavesVisible;                // Current scene shows the heat waves
+    bool animationRunning;
+    unsigned long lastFrameUs;
+    AnimationStats animStats;
+    WidgetState drawnWidgets[WIDGET_COUNT];   // What the panel currently shows
+    WidgetState sceneWidgets[WIDGET_COUNT];   // What the current state asks for
+    char roomText[16];                        // Characters of the WIDGET_ROOM_GLYPH cells
+    bool fullRedraw;                          // Panel content unknown (other screen shown)
+    RenderStats renderStats;
+    DisplayPower power;
+    int backlightLevel;                       // Brightness setting while active (0-255)
+    bool panelSleeping;                       // ST7789 in sleep-in
+    bool panelSleepPending;                   // Backlight fading out, sleep-in at panelSleepAt
+    unsigned long panelSleepAt;
+    TrendHistory trend;
+    TempCenti trendLow;                       // Chart range, whole 5° steps
+    TempCenti trendHigh;
+    unsigned long trendPlotted;               // trend.getAdded() the chart shows
+    uint32_t trendVersion;                    // Changes whenever the chart's pixels change
+    char trendMaxText[12];                    // Axis labels in the display unit
+    char trendMinText[12];
     
-    void drawHeader();
-    void drawRoomTemperature();
+    void layoutScene();
+    void showWidget(int widget, uint32_t content);
+    void showLabel(int widget, const char* text);
+    RotationPage nextRotationPage() const;
+    unsigned long rotationPageTime() const;
+    bool trendAvailable() const;
+    int trendRow(TempCenti value) const;
+    void plotTrendColumn(int x, const TrendSample* previous, const TrendSample& sample);
+    void rebuildTrendChart();
+    void paintRegion(const DisplayRect& rect);
+    bool sceneFitsPalette() const;
+    void paletteRegion(const DisplayRect& rect);
+    void composeRegion(const DisplayRect& rect);
+    void drawRegion(const DisplayRect& rect);
+    void paintWidget(int widget, int originX, int originY);
+    void paintSpec(const WidgetSpec& spec, const DisplayRect& bounds, int originX, int originY,
+                   const char* text, uint16_t color);
+    void paintPage(const ScreenLayout& layout, const char* text);
+    void invalidate();
+    void applyPowerState(unsigned long fadeMs);
+    void updatePower();
+    void noteActivity();
     void drawTemperatures();
-    void drawStatus();
     void drawHeatingIndicator();
+    void composeHeatStrip(int stripX, int offset);
+#ifdef WAVE_BENCHMARK
+    void benchmarkHeatingIndicator();
+#endif
+#ifdef IMAGE_BENCHMARK
+    void benchmarkBathImage();
+#endif
     void drawBathtubIcon(int x, int y, int size, bool ready);
-    void drawThermometerBar(int x, int y, int width, int height, float temp, float minTemp, float maxTemp, uint16_t color);
+    void drawThermometerBar(int x, int y, int width, int height, TempCenti temp, TempCenti minTemp, TempCenti maxTemp, uint16_t color);
     
-    float convertTemp(float temp);
+    TempCenti convertTemp(TempCenti temp);
+    void formatTemp(TempCenti temp, int decimals, char* buf, size_t size);
     const char* getTempUnit();
     
 public:
     DisplayManager();
     void begin(int brightness = 200);
     void setBrightness(int brightness);
+    void setPowerTimeouts(unsigned long dimAfterMs, unsigned long sleepAfterMs);
     void setTemperatureUnit(bool celsius);
-    void setThresholds(float minTank, float minOutPipe);
+    void setThresholds(TempCenti minTank, TempCenti minOutPipe);
     
-    void updateTemperature(int sensor, float value);
+    void updateTemperature(uint8_t role, TempCenti value);
     void updateBathStatus(bool ready);
     void updateHeatingStatus(bool active);
+    void updateLinkStatus(CircuitBreaker::State state);
+    void addTrendSample(const TempCenti values[TREND_SERIES]);
     
     void showConfigMode();
     void showIPAddress(IPAddress ip);
     void showStartupScreen(IPAddress ip);
     void refresh();
+    void animate();
+    const AnimationStats& getAnimationStats() const { return animStats; }
+    const RenderStats& getRenderStats() const { return renderStats; }
+    const DisplayPower& getPower() const { return power; }
+    const TrendHistory& getTrend() const { return trend; }
 };
 
 #endif
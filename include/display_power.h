@@ -0,0 +1,49 @@
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Idle state machine of the display's power management
+ *
+ * ACTIVE while there is activity (hot water use, a status page), DIMMED
+ * after dimAfterMs without any, ASLEEP (backlight off, panel in sleep-in)
+ * after sleepAfterMs. Any activity returns to ACTIVE at once. A timeout of
+ * 0 disables that state.
+ *
+ * Only decides and keeps time; DisplayManager drives the backlight and the
+ * panel. Time spent in each state is accumulated for the energy figures on
+ * /status.
+ */
+class DisplayPower {
+public:
+    enum State : uint8_t {
+        ACTIVE,
+        DIMMED,
+        ASLEEP,
+        STATE_COUNT
+    };
+
+    DisplayPower();
+    void configure(unsigned long dimAfterMs, unsigned long sleepAfterMs);
+    bool activity(unsigned long now);
+    bool update(unsigned long now);
+
+    State getState() const { return state; }
+    unsigned long getSecondsIn(State s, unsigned long now) const;
+    unsigned long getWakeups() const { return wakeups; }
+    static const char* stateName(State s);
+
+private:
+    State state;
+    unsigned long dimAfterMs;
+    unsigned long sleepAfterMs;
+    unsigned long lastActivity;
+    unsigned long stateSince;
+    uint64_t totalMs[STATE_COUNT];   // Completed periods per state
+    unsigned long wakeups;           // Returns to ACTIVE from DIMMED or ASLEEP
+
+    void enter(State next, unsigned long now);
+};
+
+#endif
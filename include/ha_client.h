@@ -0,0 +1,151 @@
+#ifndef HA_CLIENT_H
+#define HA_CLIENT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "ha_state_parser.h"
+#include "ha_tls.h"
+#include "circuit_breaker.h"
+#include "temperature.h"
+
+/**
+ * @brief Connection reuse counters of a Home Assistant HTTP client
+ */
+struct HAConnectionStats {
+    unsigned long requests;       // HTTP requests sent
+    unsigned long reused;         // ...of which over an already open connection
+    unsigned long handshakes;     // New TCP (and TLS) connections opened
+    unsigned long staleRetries;   // Kept-alive connections the server had closed
+};
+
+/**
+ * @brief Non-blocking Home Assistant REST poller
+ *
+ * Runs one sensor poll as a resumable state machine on a non-blocking lwIP
+ * socket: connect, (TLS handshake,) send, read headers, read body. Every call
+ * to step() advances the current request by a bounded slice (one connect
+ * check, one handshake flight, one send() or one recv() of at most
+ * RECV_SLICE bytes) and returns immediately, so loop() keeps serving the web
+ * server, OTA, LED and display while Home Assistant is slow or unreachable.
+ *
+ * A poll is either one POST /api/template for all entities (batch mode) or
+ * one GET /api/states/<id> per entity. A failed batch falls back to
+ * per-entity requests within the same poll.
+ *
+ * The client is long-lived: one keep-alive connection is held open across
+ * requests and polls, and only reopened after an error, a "Connection: close"
+ * response or when the server dropped the idle connection (detected before
+ * sending, or retried once on a fresh connection if the request fails before
+ * any response byte). Bodies are read exactly to Content-Length so the
+ * connection stays usable; the Host/Authorization header block is rebuilt
+ * only when the URL or token changes.
+ *
+ * Every request outcome feeds a circuit breaker: once it opens, the rest
+ * of the poll is skipped and startPoll() refuses new polls until the
+ * backoff has elapsed.
+ *
+ * https:// URLs run the same state machine over HATls, with an extra
+ * resumable handshake step after connect; the TLS session is cached so
+ * reconnects take the abbreviated handshake.
+ */
+class HAClient {
+public:
+    static const int SENSOR_COUNT = MAX_SENSORS;
+
+    HAClient();
+    ~HAClient();
+
+    bool startPoll(const Config& config);
+    bool step();
+    void cancel();
+
+    bool isBusy() const { return phase != PHASE_IDLE; }
+    TempCenti getValue(int sensor) const { return values[sensor]; }
+    bool wasBatched() const { return batched; }
+    unsigned long getPollDuration() const { return pollDurationMs; }
+    const HAConnectionStats& getStats() const { return stats; }
+    const HATls& getTls() const { return tls; }
+    const CircuitBreaker& getBreaker() const { return breaker; }
+
+    static bool parseUrl(const char* url, String& host, uint16_t& port, bool& secure, String& basePath);
+    static String buildBatchTemplate(const char* const entityIds[], int count);
+    static bool parseBatchValues(const char* text, const char* const entityIds[], TempCenti values[], int count);
+
+private:
+    enum Phase {
+        PHASE_IDLE,
+        PHASE_BATCH,       // Single template request for all entities
+        PHASE_ENTITIES     // One state request per entity
+    };
+
+    enum RequestState {
+        REQ_IDLE,
+        REQ_RESOLVE,
+        REQ_CONNECT,
+        REQ_CONNECTING,
+        REQ_HANDSHAKE,
+        REQ_SEND,
+        REQ_HEADERS,
+        REQ_BODY,
+        REQ_DONE,
+        REQ_FAILED
+    };
+
+    static const size_t RECV_SLICE = 256;
+    static const size_t LINE_MAX = 96;
+    static const size_t BODY_MAX = 160;
+    static const long DRAIN_MAX = 2048;    // Larger unread remainders close the connection instead
+
+    // Poll
+    Phase phase;
+    int entityIndex;
+    bool batched;
+    unsigned long pollStart;
+    unsigned long pollDurationMs;
+    TempCenti values[SENSOR_COUNT];    // TEMP_INVALID until fetched
+    char entities[SENSOR_COUNT][ENTITY_ID_MAX];
+    char token[256];
+    String host;
+    String basePath;
+    uint16_t port;
+    bool secure;
+    uint32_t hostIp;       // 0 = resolve before the next connect
+    String fixedHeaders;   // Host, Authorization and Connection lines
+    HAConnectionStats stats;
+    HATls tls;
+    CircuitBreaker breaker;
+
+    // Current request
+    RequestState reqState;
+    int sock;
+    unsigned long reqDeadline;
+    String request;
+    size_t sent;
+    int statusCode;
+    long contentLength;
+    long bodyRead;
+    bool chunked;
+    bool keepAlive;        // Response leaves the connection usable
+    bool reusedConnection; // Request went out over a kept-alive connection
+    char line[LINE_MAX + 1];
+    size_t lineLen;
+    char body[BODY_MAX + 1];
+    size_t bodyLen;
+    bool parseState;       // Body goes to HAStateParser instead of body[]
+    HAStateParser stateParser;
+
+    void beginRequest(const char* method, const String& path, const String& payload, bool stateRequest);
+    void advanceRequest();
+    void closeSocket();
+    bool connectionAlive();
+    void onConnected();
+    int transportSend(const char* data, size_t length);
+    int transportRecv(char* data, size_t length);
+    void failRequest(const char* reason);
+    void handleHeaderLine();
+    void handleBody(const char* data, size_t length);
+    bool nextEntity();
+    void finishPoll();
+};
+
+#endif
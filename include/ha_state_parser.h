@@ -0,0 +1,65 @@
+#ifndef HA_STATE_PARSER_H
+#define HA_STATE_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Bounded-memory streaming parser for Home Assistant entity responses
+ *
+ * Extracts the top-level "state" value from a /api/states/<entity_id> JSON
+ * body while it is being received. Bytes are fed in arbitrary chunks straight
+ * from the network stream; parsing stops as soon as the state string is
+ * complete, so the (often several KB) attributes object never has to be read
+ * or buffered.
+ *
+ * Only keys of the outermost object are considered, so a nested "state" key
+ * inside attributes or context can't be mistaken for the entity state.
+ * Memory use is fixed: the parser object is under 64 bytes and never allocates.
+ *
+ * Depends only on the C standard library so it can be built and unit tested
+ * on the host.
+ */
+class HAStateParser {
+public:
+    enum Result {
+        NEED_MORE,  // Keep feeding bytes
+        DONE,       // State value available via getState()
+        FAILED      // Malformed input, non-string state or state too long
+    };
+
+    static const size_t MAX_STATE_LEN = 31;
+
+    HAStateParser();
+    void reset();
+
+    Result feed(char c);
+    Result feed(const char* data, size_t length, size_t* consumed);
+
+    Result getResult() const { return result; }
+    const char* getState() const { return state; }
+
+private:
+    enum Mode {
+        SCAN,           // Outside any string
+        IN_STRING,      // Skipping a string we don't care about
+        IN_KEY,         // Reading a top-level key
+        BEFORE_VALUE,   // After "state": waiting for the opening quote
+        IN_STATE        // Capturing the state string
+    };
+
+    static const size_t MAX_KEY_LEN = 6;
+
+    Mode mode;
+    Result result;
+    uint16_t depth;
+    bool escape;
+    bool expectKey;        // Next top-level string is a key
+    bool stateKeySeen;     // Last top-level key was "state"
+    uint8_t keyLen;
+    uint8_t stateLen;
+    char key[MAX_KEY_LEN + 1];
+    char state[MAX_STATE_LEN + 1];
+};
+
+#endif
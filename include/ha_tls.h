@@ -0,0 +1,102 @@
+#ifndef HA_TLS_H
+#define HA_TLS_H
+
+#include <Arduino.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/x509_crt.h>
+
+/**
+ * @brief Resumable TLS client layer for HAClient
+ *
+ * Runs mbedTLS over an already connected non-blocking socket. handshake(),
+ * read() and write() never wait: they return AGAIN (IO_AGAIN) until the
+ * socket is ready, so TLS fits into HAClient's step() slices.
+ *
+ * To keep repeated connections cheap on the single-core ESP32-C6:
+ * - The SSL config, entropy and DRBG are set up once and kept for the
+ *   lifetime of the object; only the per-connection context is allocated
+ * - The negotiated session (session ID and, if offered, session ticket) is
+ *   cached and offered on the next connection, so the server can take the
+ *   abbreviated handshake path without any public-key operation
+ * - An optional SHA-256 pin of the server certificate (DER) is checked on
+ *   full handshakes only. Sessions are cached only after the pin matched, so
+ *   a resumed session is already validated.
+ *
+ * Heap use of a handshake is the drop in free heap from begin() to the
+ * lowest value seen after each handshake step, so allocations made and
+ * freed within one mbedtls_ssl_handshake() call are not counted.
+ *
+ * Without a pin the certificate is not verified, same as the previous
+ * HTTPClient path (self-signed certificates are common on HA installs).
+ */
+class HATls {
+public:
+    static const int IO_ERROR = -1;
+    static const int IO_AGAIN = -2;
+
+    enum HandshakeResult {
+        HS_AGAIN,
+        HS_DONE,
+        HS_FAILED
+    };
+
+    HATls();
+    ~HATls();
+
+    bool begin(int sock, const char* host);
+    HandshakeResult handshake();
+    int read(char* buf, size_t length);
+    int write(const char* buf, size_t length);
+    bool isIdle();
+    void close();
+
+    bool setPin(const char* hexSha256);
+    void forgetSession();
+
+    unsigned long getFullCount() const { return fullCount; }
+    unsigned long getResumedCount() const { return resumedCount; }
+    unsigned long getFullAvgMs() const { return fullCount > 0 ? fullTotalMs / fullCount : 0; }
+    unsigned long getResumedAvgMs() const { return resumedCount > 0 ? resumedTotalMs / resumedCount : 0; }
+    size_t getFullHeapPeak() const { return fullHeapPeak; }
+    size_t getResumedHeapPeak() const { return resumedHeapPeak; }
+
+private:
+    mbedtls_ssl_config conf;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_session session;
+    bool configured;
+    bool active;
+    bool haveSession;
+    int fd;
+
+    // Certificate pin (empty = no verification)
+    char pinHex[65];
+    uint8_t pin[32];
+    bool certSeen;         // Verify callback ran: full handshake
+    bool pinMatched;
+
+    // Handshake timing
+    unsigned long handshakeStart;
+    unsigned long fullCount;
+    unsigned long fullTotalMs;
+    unsigned long resumedCount;
+    unsigned long resumedTotalMs;
+
+    // Handshake heap use, largest so far per kind
+    size_t heapAtBegin;
+    size_t heapLow;
+    size_t fullHeapPeak;
+    size_t resumedHeapPeak;
+
+    bool setupConfig();
+    void sampleHeap();
+    static int bioSend(void* ctx, const unsigned char* buf, size_t length);
+    static int bioRecv(void* ctx, unsigned char* buf, size_t length);
+    static int verifyCert(void* ctx, mbedtls_x509_crt* crt, int depth, uint32_t* flags);
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HA_WEBSOCKET_H
+#define HA_WEBSOCKET_H
+
+#include <Arduino.h>
+#include <WebSocketsClient.h>
+#include "config.h"
+#include "circuit_breaker.h"
+#include "temperature.h"
+
+/**
+ * @brief Push-based sensor updates over the Home Assistant WebSocket API
+ *
+ * Connects to <ha_url>/api/websocket, authenticates with the long-lived
+ * access token and subscribes to state changes of the configured entities.
+ * Each new state is parsed to centi-degrees and handed to the callback with
+ * the sensor slot index (Config::sensors / SensorRegistry).
+ *
+ * The subscription uses a "state" trigger limited to the configured entity
+ * IDs, so Home Assistant filters state_changed events server-side instead of
+ * streaming every entity in the house. Only the server address comes from
+ * Config, so a local stand-in replaying scripted events can be used for testing.
+ *
+ * Drops and connection attempts that do not reach a subscription within
+ * WS_SUBSCRIBE_TIMEOUT count as failures of a circuit breaker. While it is
+ * open the client is disconnected and not looped, so the library's own
+ * reconnect timer stops hammering a dead server.
+ */
+class HAWebSocket {
+public:
+    typedef void (*StateCallback)(int sensor, TempCenti value);
+
+    HAWebSocket();
+    void begin(const Config& config, StateCallback callback);
+    void stop();
+    void loop();
+
+    bool isSubscribed() const { return subscribed; }
+    unsigned long getEventCount() const { return eventCount; }
+    const CircuitBreaker& getBreaker() const { return breaker; }
+
+private:
+    static const int SENSOR_COUNT = MAX_SENSORS;
+    static const int SUBSCRIBE_ID = 1;
+
+    WebSocketsClient client;
+    StateCallback onState;
+    char token[256];
+    char entities[SENSOR_COUNT][ENTITY_ID_MAX];
+    bool running;
+    bool subscribed;
+    bool paused;                    // Breaker open, client disconnected
+    unsigned long attemptStart;     // Start of the current connect/subscribe attempt
+    unsigned long eventCount;
+    CircuitBreaker breaker;
+
+    void handleEvent(WStype_t type, uint8_t* payload, size_t length);
+    void handleMessage(const uint8_t* payload, size_t length);
+    void sendAuth();
+    void sendSubscribe();
+    bool isDuplicate(int slot) const;
+    void recordFailure(const char* reason);
+};
+
+#endif
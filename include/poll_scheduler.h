@@ -0,0 +1,44 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "temperature.h"
+
+/**
+ * @brief Adaptive Home Assistant poll interval
+ *
+ * Adjusts the REST poll interval from the readings of each poll:
+ * - Fast slope on any sensor (e.g. out pipe rising during a bath fill):
+ *   drop straight to the floor interval
+ * - Tank or out pipe near its bath threshold: halve, at most the nominal interval
+ * - Flat readings: back off exponentially up to the ceiling
+ * - Anything in between: return to the nominal (configured) interval
+ *
+ * All intervals are in milliseconds and always stay within [floor, ceiling].
+ */
+class PollScheduler {
+public:
+    static const int SENSOR_COUNT = MAX_SENSORS;
+
+    PollScheduler();
+    void configure(unsigned long floorMs, unsigned long nominalMs, unsigned long ceilingMs);
+    void update(const TempCenti temps[], bool nearThreshold);
+
+    unsigned long getInterval() const { return interval; }
+    TempCenti getMaxSlope() const { return maxSlope; }
+
+private:
+    unsigned long floorMs;
+    unsigned long nominalMs;
+    unsigned long ceilingMs;
+    unsigned long interval;
+    TempCenti maxSlope;             // Centi-degrees per minute, last update
+    TempCenti lastTemps[SENSOR_COUNT];
+    unsigned long lastUpdate;
+    bool hasLast;
+
+    unsigned long clamp(unsigned long ms) const;
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef RENDER_PROFILE_H
+#define RENDER_PROFILE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Opt-in draw call profiler for display.cpp
+ *
+ * Build with -D RENDER_PROFILER. Every drawing call wrapped in RENDER_DRAW
+ * adds one call, the area it asked for (before clipping) and its duration
+ * to its primitive and to the scene being drawn, set by RENDER_SCENE for
+ * the rest of the enclosing block. Results are served on /debug/render and
+ * printed to serial once a minute.
+ *
+ * Without the flag RENDER_DRAW expands to the bare call, RENDER_SCENE to
+ * nothing, and none of the functions below exist.
+ */
+
+enum RenderPrimitive : uint8_t {
+    PRIM_FILL,          // fillScreen / fillRect / fillSprite
+    PRIM_CIRCLE,        // fillCircle / drawCircle
+    PRIM_LINE,
+    PRIM_TEXT,          // drawString, i.e. the font rasteriser
+    PRIM_IMAGE,         // RLE rows decoded into a band or pushed with pushImage
+    PRIM_SPRITE,        // pushSprite: glyph cache, wave dots, heat strips
+    PRIM_PANEL_PUSH,    // pushImageDMA of a composed band, including the DMA wait
+    PRIM_COUNT
+};
+
+enum RenderScene : uint8_t {
+    SCENE_FRAME,        // Outside any scene: band clears and panel pushes
+    SCENE_STOP,
+    SCENE_BATH_IMAGE,
+    SCENE_ROOM_TEMP,
+    SCENE_HEATING,      // Heat wave overlay, in scenes and animation frames
+    SCENE_TREND,        // Trend page: chart columns, axis labels and legend
+    SCENE_LINK,
+    SCENE_STATUS_PAGE,  // Config / startup / IP address pages
+    SCENE_COUNT
+};
+
+struct RenderCounter {
+    unsigned long calls;
+    unsigned long pixels;
+    unsigned long us;
+};
+
+struct RenderProfile {
+    RenderCounter primitives[PRIM_COUNT];
+    RenderCounter scenes[SCENE_COUNT];
+    unsigned long sinceMs;     // millis() of the last reset
+};
+
+#ifdef RENDER_PROFILER
+
+extern RenderProfile renderProfile;
+
+void renderProfileRecord(RenderPrimitive primitive, unsigned long pixels, unsigned long us);
+void renderProfileReset();
+void renderProfilePrint();
+const char* renderPrimitiveName(int primitive);
+const char* renderSceneName(int scene);
+
+/**
+ * @brief Attributes draw calls to a scene until the end of the block
+ */
+class RenderSceneScope {
+public:
+    explicit RenderSceneScope(RenderScene scene);
+    ~RenderSceneScope();
+
+private:
+    RenderScene previous;
+};
+
+/**
+ * @brief Approximate area of a circle of radius r
+ */
+inline unsigned long renderCircleArea(int r) {
+    return (unsigned long)(355L * r * r / 113);
+}
+
+/**
+ * @brief Approximate pixel count of a circle outline of radius r
+ */
+inline unsigned long renderCircleOutline(int r) {
+    return (unsigned long)(710L * r / 113);
+}
+
+/**
+ * @brief Pixel count of a one pixel wide line
+ */
+inline unsigned long renderLinePixels(int x0, int y0, int x1, int y1) {
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 > y0 ? y1 - y0 : y0 - y1;
+    return (unsigned long)(dx > dy ? dx : dy) + 1;
+}
+
+#define RENDER_DRAW(primitive, pixels, call) \
+    do { \
+        unsigned long renderStartUs = micros(); \
+        call; \
+        renderProfileRecord(primitive, pixels, micros() - renderStartUs); \
+    } while (0)
+
+#define RENDER_SCENE(scene) RenderSceneScope renderSceneScope(scene)
+
+#else
+
+#define RENDER_DRAW(primitive, pixels, call) call
+#define RENDER_SCENE(scene)
+
+#endif
+
+#endif
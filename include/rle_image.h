@@ -0,0 +1,56 @@
+#ifndef RLE_IMAGE_H
+#define RLE_IMAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Run-length encoded RGB565 image in flash (see tools/rle_image.py)
+ *
+ * Rows are encoded independently as tokens with a one byte header:
+ * 0x00-0x7F is a literal of (h + 1) pixels, 0x80-0xFF a run of
+ * (h & 0x7F) + 1 copies of one pixel. Pixels are stored byte-swapped, as
+ * the panel and LovyanGFX sprites expect, so decoded rows go straight into
+ * a band buffer or pushImage() without conversion.
+ */
+struct RleImage {
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;        // Encoded bytes
+    uint32_t checksum;    // FNV-1a of the decoded pixels, for verification
+    const uint8_t* data;
+};
+
+/**
+ * @brief Streaming row decoder for an RleImage
+ *
+ * Keeps its position between calls, so decoding an image band by band
+ * from top to bottom never re-reads a row. Seeking backwards restarts
+ * from the first row. Needs no buffer of its own.
+ *
+ * Depends only on the C standard library so it can be built and tested
+ * on the host.
+ */
+class RleDecoder {
+public:
+    RleDecoder();
+
+    void begin(const RleImage* image);
+    void seekRow(int row);
+    void decodeRow(uint16_t* out, int skip, int count);
+    int currentRow() const { return row; }
+    const RleImage* image() const { return img; }
+
+private:
+    const RleImage* img;
+    const uint8_t* pos;
+    int row;
+
+    void rewind();
+};
+
+uint32_t rleChecksum(uint32_t hash, const uint16_t* pixels, size_t count);
+
+const uint32_t RLE_CHECKSUM_SEED = 2166136261UL;
+
+#endif
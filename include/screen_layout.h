@@ -0,0 +1,142 @@
+#ifndef SCREEN_LAYOUT_H
+#define SCREEN_LAYOUT_H
+
+#include <Arduino.h>
+#include "render_profile.h"
+
+// Panel in landscape (setRotation(1))
+const int SCREEN_WIDTH = 320;
+const int SCREEN_HEIGHT = 172;
+const int SCREEN_CENTER_X = SCREEN_WIDTH / 2;
+const int SCREEN_CENTER_Y = SCREEN_HEIGHT / 2;
+
+// Heat wave strips on both sides of the bath scenes
+const int HEAT_STRIP_WIDTH = 20;
+
+// Character cells of the room temperature, e.g. "-12.5C"
+const int ROOM_GLYPHS = 7;
+
+/**
+ * @brief Retained scene elements, in paint order (later ones on top)
+ */
+enum DisplayWidget : uint8_t {
+    WIDGET_BATH_IMAGE,
+    WIDGET_STOP_SIGN,
+    WIDGET_ROOM_WAITING,  // "Waiting..." until the first room reading
+    WIDGET_ROOM_GLYPH,    // First room temperature character cell
+    WIDGET_ROOM_GLYPH_LAST = WIDGET_ROOM_GLYPH + ROOM_GLYPHS - 1,
+    WIDGET_ROOM_LABEL,
+    WIDGET_TREND_CHART,   // Sparklines of the last TREND_SPAN_MS
+    WIDGET_TREND_MAX,     // Axis labels, text set at layout time
+    WIDGET_TREND_MIN,
+    WIDGET_TREND_TANK,    // Legend
+    WIDGET_TREND_OUT_PIPE,
+    WIDGET_TREND_HEATING_IN,
+    WIDGET_TREND_SPAN,
+    WIDGET_WAVES_LEFT,
+    WIDGET_WAVES_RIGHT,
+    WIDGET_LINK,
+    WIDGET_COUNT
+};
+
+/**
+ * @brief What a layout entry draws
+ */
+enum WidgetKind : uint8_t {
+    KIND_LABEL,       // Text in font and size, colour on accent
+    KIND_BIG_NUMBER,  // Cached room glyphs, one widget slot per character (ROOM_GLYPHS slots)
+    KIND_IMAGE,       // Flash image asset
+    KIND_DISC,        // Filled circle, outline rings and centred text in accent
+    KIND_CHECK,       // Tick mark, outline = stroke count
+    KIND_STRIP,       // Animated heat wave strip
+    KIND_SPARKLINE    // Trend chart, one column per sample
+};
+
+/**
+ * @brief One entry of a compile-time layout table
+ *
+ * (x, y) is the point of the widget's box named by datum (LovyanGFX
+ * TL_DATUM, MC_DATUM, BC_DATUM, ...); discs and ticks are always centred
+ * on it. Build entries with the *Spec() helpers below; a scene table wraps
+ * them in inSlot() to bind them to a DisplayWidget. DisplayManager turns
+ * fixed entries into bounding boxes once at begin(), the big number is laid
+ * out per value.
+ */
+struct WidgetSpec {
+    uint8_t widget;       // DisplayWidget slot, scene tables only
+    WidgetKind kind;
+    uint8_t datum;
+    uint8_t scene;        // RenderScene the draw calls count towards
+    int16_t x;
+    int16_t y;
+    int16_t w;            // Strips and sparklines
+    int16_t h;
+    int16_t radius;       // Discs and ticks
+    uint8_t outline;      // Disc rings from radius outwards, tick strokes
+    uint8_t font;
+    uint8_t size;         // Text size
+    uint8_t asset;        // Images: AssetId
+    uint16_t color;       // Text, disc fill or tick colour (RGB565)
+    uint16_t accent;      // Label background, disc rings and disc text
+    const char* text;     // Labels: nullptr = supplied when painting
+};
+
+/**
+ * @brief A screen: background colour and its widgets in paint order
+ */
+struct ScreenLayout {
+    uint16_t background;
+    const WidgetSpec* widgets;
+    uint8_t count;
+};
+
+constexpr WidgetSpec labelSpec(uint8_t datum, int x, int y, const char* text, uint8_t font, uint8_t size,
+                               uint16_t color, uint16_t background) {
+    return { 0, KIND_LABEL, datum, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, 0, 0, 0, 0,
+             font, size, 0, color, background, text };
+}
+
+constexpr WidgetSpec bigNumberSpec(uint8_t datum, int x, int y) {
+    return { 0, KIND_BIG_NUMBER, datum, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, 0, 0, 0, 0,
+             0, 0, 0, 0, 0, nullptr };
+}
+
+constexpr WidgetSpec imageSpec(uint8_t datum, int x, int y, uint8_t asset) {
+    return { 0, KIND_IMAGE, datum, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, 0, 0, 0, 0,
+             0, 0, asset, 0, 0, nullptr };
+}
+
+constexpr WidgetSpec discSpec(int x, int y, int radius, uint8_t rings, uint16_t color, uint16_t accent,
+                              const char* text = nullptr, uint8_t font = 0, uint8_t size = 1) {
+    return { 0, KIND_DISC, 0, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, 0, 0, (int16_t)radius, rings,
+             font, size, 0, color, accent, text };
+}
+
+constexpr WidgetSpec checkSpec(int x, int y, int radius, uint8_t strokes, uint16_t color) {
+    return { 0, KIND_CHECK, 0, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, 0, 0, (int16_t)radius, strokes,
+             0, 0, 0, color, 0, nullptr };
+}
+
+constexpr WidgetSpec stripSpec(uint8_t datum, int x, int y, int w, int h) {
+    return { 0, KIND_STRIP, datum, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, 0, 0,
+             0, 0, 0, 0, 0, nullptr };
+}
+
+constexpr WidgetSpec sparklineSpec(uint8_t datum, int x, int y, int w, int h) {
+    return { 0, KIND_SPARKLINE, datum, SCENE_STATUS_PAGE, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, 0, 0,
+             0, 0, 0, 0, 0, nullptr };
+}
+
+constexpr WidgetSpec inSlot(uint8_t widget, RenderScene scene, WidgetSpec spec) {
+    spec.widget = widget;
+    spec.scene = scene;
+    return spec;
+}
+
+// Tables in screen_layout.cpp
+extern const ScreenLayout SCENE_SCREEN;    // Retained widgets of refresh(), one per DisplayWidget
+extern const ScreenLayout CONFIG_SCREEN;
+extern const ScreenLayout WIFI_SCREEN;     // Text: IP address
+extern const ScreenLayout STARTUP_SCREEN;  // Text: IP address
+
+#endif
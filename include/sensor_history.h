@@ -0,0 +1,104 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "temperature.h"
+
+// One sample per sensor slot at the default poll interval
+const unsigned long HISTORY_INTERVAL_MS = 10000;
+
+// Delta-encoded blocks per sensor: 72 x 140 B = 9.8 KB, 79 KB for all
+// MAX_SENSORS slots. A changing reading costs one byte, so a full ring
+// holds at least 24 h (8640 samples) unless readings often jump by more
+// than 1°C; unchanged readings cost a byte per 50 samples.
+const int HISTORY_BLOCK_BYTES = 128;
+const int HISTORY_BLOCKS = 72;
+
+const int16_t HISTORY_NONE = INT16_MIN;   // No reading
+
+/**
+ * @brief Summary of the samples in one downsampling bucket
+ */
+struct HistoryBucket {
+    TempCenti min;          // TEMP_INVALID if the bucket has no reading
+    TempCenti max;
+    TempCenti mean;
+    uint32_t samples;       // Samples with a reading
+};
+
+/**
+ * @brief One encoded block: the samples first .. first + samples - 1
+ */
+struct HistoryBlock {
+    uint32_t first;         // Sequence number of the first sample
+    uint16_t samples;
+    int16_t base;           // Value before the first sample, HISTORY_NONE if none
+    uint8_t used;           // Bytes of data used
+    uint8_t data[HISTORY_BLOCK_BYTES];
+};
+
+/**
+ * @brief Circular buffer of one sensor's readings, delta-encoded in blocks
+ *
+ * Samples are numbered by a sequence number that all sensors of a
+ * HistoryStore share. Each block starts from the value before it, so it
+ * decodes on its own; when the ring is full the oldest block is dropped.
+ * Appending is O(1) and allocation free. Queries find the first block by
+ * binary search and decode runs of equal values in one step.
+ *
+ * Codes: 0-200 delta of -100..+100 centi-degrees, 201-250 the previous
+ * value repeated 1-50 times, 251 no reading, 252 absolute value in the
+ * next two bytes (little endian).
+ */
+class SensorHistory {
+public:
+    SensorHistory();
+    void clear(uint32_t next);
+    void append(TempCenti value);
+
+    uint32_t getFirst() const;                      // Oldest retained sample
+    uint32_t getEnd() const { return end; }         // One past the newest
+    size_t getBytesUsed() const;
+
+    int read(uint32_t from, uint32_t to, TempCenti* out, int max) const;
+    int downsample(uint32_t from, uint32_t to, int buckets, HistoryBucket* out) const;
+
+private:
+    int blockAt(int index) const { return (oldest + index) % HISTORY_BLOCKS; }
+    int findBlock(uint32_t sequence) const;
+    uint8_t* reserve(int bytes);
+    static int nextRun(const HistoryBlock& block, int& pos, int16_t& value);
+
+    HistoryBlock blocks[HISTORY_BLOCKS];
+    int oldest;             // Ring slot of the oldest block
+    int blockCount;
+    uint32_t end;
+    int16_t last;           // Newest value, HISTORY_NONE if none
+    int runAt;              // Offset of the open repeat code in the newest block, -1 if none
+};
+
+/**
+ * @brief Histories of all sensor slots, sampled together every HISTORY_INTERVAL_MS
+ *
+ * Times are millis() values; they map to sequence numbers assuming samples
+ * were recorded HISTORY_INTERVAL_MS apart, counting back from the newest.
+ */
+class HistoryStore {
+public:
+    HistoryStore();
+    void record(const TempCenti values[MAX_SENSORS], unsigned long now);
+    void clear(int sensor);
+
+    const SensorHistory& get(int sensor) const { return sensors[sensor]; }
+    uint32_t getSequence() const { return sequence; }
+    uint32_t sequenceAt(unsigned long time) const;
+    size_t getBytesUsed() const;
+
+private:
+    SensorHistory sensors[MAX_SENSORS];
+    uint32_t sequence;      // Next sample
+    unsigned long lastRecord;
+};
+
+#endif
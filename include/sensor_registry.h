@@ -0,0 +1,61 @@
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "temperature.h"
+
+/**
+ * @brief Latest reading of one sensor slot, as handed to the loop task
+ */
+struct SensorReading {
+    uint8_t role;                  // SensorRole
+    bool valid;                    // At least one reading since the slot was configured
+    TempCenti value;               // Centi-degrees °C
+    unsigned long updatedAt;       // millis() of the last reading
+    uint32_t readingCount;         // Bumped on every new reading
+};
+
+/**
+ * @brief Runtime state of one configured sensor
+ */
+struct SensorDescriptor {
+    char entityId[ENTITY_ID_MAX];
+    SensorReading reading;
+};
+
+/**
+ * @brief Fixed-capacity registry of the temperature sensors
+ *
+ * Slot i mirrors Config::sensors[i], so HAClient values and WebSocket
+ * callbacks address sensors by the same index. Logic that needs a specific
+ * measurement (bath readiness, heating detection, display) asks for a role;
+ * if several slots share a role, the first valid one is used.
+ *
+ * Memory is bounded by MAX_SENSORS: a descriptor is 96 bytes (80 byte
+ * entity ID + 16 byte reading), 768 bytes for the registry. Each further
+ * copy of the entity IDs (Config, HAClient, HAWebSocket) adds 80 bytes per
+ * slot, and the snapshot carries 16 bytes per slot.
+ */
+class SensorRegistry {
+public:
+    SensorRegistry();
+
+    void configure(const Config& config);
+    void setValue(int slot, TempCenti value);
+
+    const SensorDescriptor& get(int slot) const { return sensors[slot]; }
+    bool isUsed(int slot) const { return sensors[slot].entityId[0] != '\0'; }
+    int findRole(uint8_t role) const;
+    TempCenti valueOf(uint8_t role) const;
+    void copyReadings(SensorReading out[]) const;
+
+    static int primarySlot(const SensorReading readings[], uint8_t role);
+    static const char* roleName(uint8_t role);
+    static const char* roleLabel(uint8_t role);
+
+private:
+    SensorDescriptor sensors[MAX_SENSORS];
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef SENSOR_SNAPSHOT_H
+#define SENSOR_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "sensor_registry.h"
+
+/**
+ * @brief Immutable view of everything the network task knows about the sensors
+ *
+ * Published as a whole after every poll or push update, so readers always
+ * see values that belong together (e.g. bathReady matches the temperatures).
+ * Sensor slots follow Config::sensors; the entity IDs stay in the config.
+ */
+struct SensorSnapshot {
+    SensorReading sensors[MAX_SENSORS];
+    bool haConnected;
+    bool bathReady;
+    bool heatingActive;
+
+    // Network diagnostics for /status
+    bool pushActive;
+    unsigned long pushEvents;
+    bool lastPollBatched;
+    unsigned long lastPollMs;
+    unsigned long pollAvgMs;
+    unsigned long pollCount;
+    unsigned long pollIntervalMs;           // Current adaptive REST poll interval
+    unsigned long haRequests;               // REST requests sent
+    unsigned long haReused;                 // ...over a kept-alive connection
+    unsigned long haHandshakes;             // New connections opened
+    unsigned long tlsFull;                  // Full TLS handshakes (https)
+    unsigned long tlsResumed;               // Abbreviated handshakes from the session cache
+    unsigned long tlsFullAvgMs;
+    unsigned long tlsResumedAvgMs;
+    unsigned long tlsFullHeap;              // Largest heap use of a handshake, bytes
+    unsigned long tlsResumedHeap;
+
+    // Circuit breakers (CircuitBreaker::State) per endpoint
+    uint8_t restBreaker;
+    uint8_t restFailures;                   // Consecutive failed requests
+    unsigned long restFailuresTotal;
+    unsigned long restRetryInMs;            // Until the next trial while open
+    uint8_t wsBreaker;
+    uint8_t wsFailures;
+};
+
+/**
+ * @brief Single-writer, lock-free snapshot handoff (seqlock)
+ *
+ * The network task publishes; the loop task (display, LED, web handlers)
+ * reads. The sequence counter is odd while a write is in progress. Readers
+ * copy the data and retry if the counter changed or was odd, so they never
+ * block the writer and never return a torn mix of old and new values.
+ *
+ * Both tasks run at the same priority, so a reader that interrupts a write
+ * yields to let the writer finish instead of spinning.
+ */
+class SnapshotBuffer {
+public:
+    SnapshotBuffer();
+
+    void publish(const SensorSnapshot& snapshot);
+    uint32_t read(SensorSnapshot& out) const;
+    uint32_t getVersion() const;
+
+private:
+    std::atomic<uint32_t> sequence;
+    SensorSnapshot data;
+};
+
+#endif
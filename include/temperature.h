@@ -0,0 +1,36 @@
+#ifndef TEMPERATURE_H
+#define TEMPERATURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Fixed-point temperature in hundredths of a degree (54.25 °C = 5425)
+ *
+ * The ESP32-C6 has no FPU, so every float operation is a soft-float library
+ * call. Temperatures are parsed straight from the Home Assistant state text
+ * into centi-degrees and stay integers through thresholds, rate math and
+ * rendering; only NVS keeps the thresholds as float for compatibility.
+ *
+ * int32 covers any sensor range and leaves room for rate math
+ * (a difference times 60000 ms still needs 64 bits, see callers).
+ *
+ * Depends only on the C standard library so it can be built and unit tested
+ * on the host.
+ */
+typedef int32_t TempCenti;
+
+const TempCenti TEMP_INVALID = INT32_MIN;   // No reading / unparsable state
+const TempCenti TEMP_ONE_DEGREE = 100;
+
+bool tempParse(const char* text, TempCenti* out, const char** end = nullptr);
+size_t tempFormat(TempCenti value, char* buf, size_t size, int decimals);
+TempCenti tempToFahrenheit(TempCenti celsius);
+TempCenti tempFromFloat(float value);
+float tempToFloat(TempCenti value);
+
+inline TempCenti tempAbs(TempCenti value) {
+    return value < 0 ? -value : value;
+}
+
+#endif
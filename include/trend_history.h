@@ -0,0 +1,49 @@
+#ifndef TREND_HISTORY_H
+#define TREND_HISTORY_H
+
+#include <Arduino.h>
+#include "temperature.h"
+
+// Series of the trend chart, in TrendSample::values order
+enum TrendSeries : uint8_t {
+    TREND_TANK,
+    TREND_OUT_PIPE,
+    TREND_HEATING_IN,
+    TREND_SERIES
+};
+
+// One sample per chart column, spread over the last TREND_SPAN_MS
+const int TREND_SAMPLES = 256;
+const unsigned long TREND_SPAN_MS = 6UL * 3600000UL;                      // 6 hours
+const unsigned long TREND_INTERVAL_MS = TREND_SPAN_MS / TREND_SAMPLES;    // ~84 s
+
+const int16_t TREND_NONE = INT16_MIN;   // No reading for the series
+
+struct TrendSample {
+    int16_t values[TREND_SERIES];       // Centi-degrees Celsius or TREND_NONE
+};
+
+/**
+ * @brief Fixed-size ring of the last TREND_SAMPLES trend samples
+ *
+ * 1.5 KB of RAM, no allocation; the oldest sample is overwritten once the
+ * ring is full. getAdded() counts every sample ever added, so a reader can
+ * tell how many arrived since it last looked.
+ */
+class TrendHistory {
+public:
+    TrendHistory();
+    void add(const TempCenti values[TREND_SERIES]);
+
+    int getCount() const { return count; }
+    const TrendSample& get(int age) const;
+    unsigned long getAdded() const { return added; }
+
+private:
+    TrendSample samples[TREND_SAMPLES];
+    int head;                // Slot of the next sample
+    int count;
+    unsigned long added;
+};
+
+#endif
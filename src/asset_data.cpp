@@ -0,0 +1,781 @@
+// Generated by tools/build_assets.py from data/*.png - do not edit
+
+#include "assets.h"
+
+const uint8_t assetData[] PROGMEM = {
+    // baby-bath_172: 172x172 RGB565 RLE, 12307 bytes
+    0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xEB, 0x00,
+    0x00, 0x08, 0x00, 0x20, 0x10, 0x61, 0x18, 0xC2, 0x18, 0xA2, 0x18, 0xA2, 0x20, 0xC2, 0x08, 0x40,
+    0x00, 0x00, 0x00, 0x20, 0xB6, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x03, 0x21, 0x24, 0x29, 0x65, 0x29,
+    0x45, 0x10, 0x82, 0xAD, 0x00, 0x00, 0x03, 0x18, 0xA2, 0x29, 0x03, 0x20, 0xC2, 0x10, 0x61, 0x84,
+    0x00, 0x00, 0x06, 0x18, 0x81, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE2, 0x20, 0xE3, 0x00,
+    0x20, 0xB2, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0x08, 0x61, 0x10, 0xA3, 0x83, 0x00, 0x00, 0x00,
+    0x10, 0xA3, 0xA9, 0x00, 0x00, 0x02, 0x18, 0x82, 0x29, 0x03, 0x18, 0xA2, 0x83, 0x00, 0x00, 0x07,
+    0x29, 0x03, 0x5A, 0x47, 0x62, 0x88, 0x6A, 0xA9, 0x5A, 0x67, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81,
+    0x82, 0x00, 0x00, 0x02, 0x10, 0x41, 0x20, 0xE3, 0x20, 0xC2, 0xB0, 0x00, 0x00, 0xB3, 0x00, 0x00,
+    0x08, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xEF, 0xA5, 0x55, 0x94, 0xD3, 0x10, 0xA2, 0x00,
+    0x00, 0x10, 0xA2, 0xA7, 0x00, 0x00, 0x09, 0x20, 0xE3, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0xE6, 0x93, 0xCD, 0xC4, 0xF0, 0xDD, 0xB3, 0xEE, 0x34, 0xF6, 0x55, 0x82, 0xFE, 0x75, 0x05, 0xDD,
+    0x93, 0x52, 0x27, 0x00, 0x00, 0x00, 0x00, 0x93, 0xCD, 0x73, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x20,
+    0xE2, 0x10, 0x81, 0xAE, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x03, 0x08, 0x82, 0x08, 0x61, 0x00, 0x00,
+    0xBD, 0xF8, 0x82, 0xF7, 0xDF, 0x03, 0xDE, 0xFC, 0x42, 0x49, 0x00, 0x00, 0x10, 0xC3, 0xA4, 0x00,
+    0x00, 0x0A, 0x20, 0xA2, 0x18, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xAC, 0xD5, 0x72, 0xF6, 0x55,
+    0xFE, 0xB6, 0xFE, 0xD7, 0xFE, 0xB6, 0xFE, 0x96, 0x83, 0xFE, 0x75, 0x0B, 0xFE, 0xB6, 0xEE, 0x34,
+    0x41, 0xC5, 0x00, 0x00, 0xBC, 0xD0, 0xFE, 0xB6, 0xE5, 0xD3, 0xAC, 0x8F, 0x41, 0xC6, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xE2, 0xAD, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x03, 0x00, 0x20, 0x21, 0x04, 0x21,
+    0x04, 0x18, 0xE3, 0x91, 0x00, 0x00, 0x0A, 0x21, 0x24, 0x00, 0x00, 0x8C, 0x92, 0xF7, 0xDF, 0xEF,
+    0x9E, 0xE7, 0x7E, 0xE7, 0x7D, 0xF7, 0xFF, 0xC6, 0x79, 0x00, 0x00, 0x18, 0xE3, 0xA3, 0x00, 0x00,
+    0x0A, 0x20, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x93, 0xAC, 0xE5, 0xD3, 0xFE, 0x96, 0xFE, 0xB6, 0xFE,
+    0x96, 0xF6, 0x55, 0xDD, 0xB3, 0xF6, 0x55, 0x84, 0xFE, 0x75, 0x0D, 0xF6, 0x55, 0xFE, 0xB6, 0xBC,
+    0xD0, 0x00, 0x00, 0x6A, 0xA8, 0xFE, 0x75, 0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55, 0xBC, 0xD0, 0x31,
+    0x44, 0x00, 0x00, 0x18, 0xA2, 0x10, 0x61, 0xAB, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x01, 0x21, 0x04,
+    0x10, 0xA2, 0x82, 0x00, 0x00, 0x01, 0x19, 0x04, 0x18, 0xE3, 0x8F, 0x00, 0x00, 0x0B, 0x21, 0x45,
+    0x00, 0x00, 0xBE, 0x38, 0xF7, 0xDF, 0xE7, 0x7E, 0xEF, 0x9E, 0xEF, 0x9E, 0xEF, 0xBE, 0xDF, 0x3D,
+    0x29, 0x65, 0x00, 0x00, 0x21, 0x24, 0xA0, 0x00, 0x00, 0x0D, 0x08, 0x40, 0x20, 0xE2, 0x00, 0x00,
+    0x52, 0x27, 0xD5, 0x92, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0x75, 0xF6, 0x55, 0xFE, 0x96, 0xBC, 0xF0,
+    0x00, 0x00, 0xB4, 0xAF, 0xFE, 0x96, 0x83, 0xFE, 0x75, 0x0E, 0xF6, 0x75, 0xFE, 0xB6, 0xD5, 0x92,
+    0x00, 0x00, 0x52, 0x27, 0xF6, 0x55, 0xFE, 0x75, 0xF6, 0x55, 0xFE, 0x96, 0xFE, 0xB6, 0xEE, 0x35,
+    0x9B, 0xED, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC2, 0xAA, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x08, 0x18,
+    0xE3, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x69, 0x52, 0xEB, 0x39, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0xC3, 0x8E, 0x00, 0x00, 0x0B, 0x21, 0x45, 0x00, 0x00, 0xB5, 0xF7, 0xF7, 0xDF, 0xE7, 0x7D, 0xEF,
+    0x9E, 0xEF, 0x7E, 0xEF, 0xBE, 0xDF, 0x3C, 0x08, 0x41, 0x00, 0x00, 0x21, 0x04, 0x9F, 0x00, 0x00,
+    0x05, 0x10, 0x61, 0x18, 0x81, 0x00, 0x00, 0x93, 0xCD, 0xF6, 0x55, 0xFE, 0xB6, 0x82, 0xFE, 0x75,
+    0x05, 0xF6, 0x75, 0xFE, 0xB6, 0xAC, 0x6E, 0x00, 0x00, 0x83, 0x6B, 0xFE, 0x96, 0x83, 0xFE, 0x75,
+    0x0F, 0xF6, 0x75, 0xFE, 0xB6, 0xD5, 0x72, 0x00, 0x00, 0x52, 0x27, 0xF6, 0x55, 0xFE, 0x76, 0xFE,
+    0x75, 0xFE, 0x75, 0xF6, 0x55, 0xFE, 0x96, 0xFE, 0x96, 0xCD, 0x51, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xC2, 0xA9, 0x00, 0x00, 0x99, 0x00, 0x00, 0x0A, 0x10, 0xC3, 0x00, 0x00, 0x7C, 0x10, 0xD6, 0xDB,
+    0xE7, 0x7D, 0xEF, 0x9E, 0xE7, 0x5D, 0xBE, 0x38, 0x4A, 0x69, 0x00, 0x00, 0x18, 0xE3, 0x8D, 0x00,
+    0x00, 0x0A, 0x19, 0x04, 0x00, 0x00, 0x6B, 0x8E, 0xEF, 0xBE, 0xF7, 0xDF, 0xEF, 0x9E, 0xEF, 0x9E,
+    0xF7, 0xFF, 0xB5, 0xB6, 0x00, 0x00, 0x21, 0x04, 0x9F, 0x00, 0x00, 0x06, 0x10, 0x81, 0x08, 0x40,
+    0x00, 0x00, 0xB4, 0xAF, 0xFE, 0x96, 0xFE, 0x96, 0xF6, 0x75, 0x82, 0xFE, 0x75, 0x0F, 0xF6, 0x75,
+    0xFE, 0xB6, 0xCD, 0x31, 0x00, 0x00, 0x49, 0xC5, 0xF6, 0x35, 0xFE, 0x96, 0xF6, 0x55, 0xF6, 0x75,
+    0xFE, 0x75, 0xF6, 0x55, 0xFE, 0xB6, 0xA4, 0x2E, 0x00, 0x00, 0x7B, 0x2A, 0xFE, 0x96, 0x85, 0xFE,
+    0x75, 0x04, 0xFE, 0xB6, 0xE5, 0xF4, 0x49, 0xE6, 0x00, 0x00, 0x20, 0xE2, 0xA8, 0x00, 0x00, 0x98,
+    0x00, 0x00, 0x0C, 0x18, 0xE3, 0x00, 0x00, 0x9D, 0x14, 0xF7, 0xDF, 0xF7, 0xDF, 0xEF, 0x9E, 0xEF,
+    0x9E, 0xEF, 0xBE, 0xF7, 0xDF, 0xE7, 0x5D, 0x5A, 0xEB, 0x00, 0x00, 0x18, 0xE3, 0x8D, 0x00, 0x00,
+    0x09, 0x18, 0xC3, 0x00, 0x00, 0x8C, 0x92, 0xE7, 0x5D, 0xEF, 0x9E, 0xEF, 0x9E, 0xBE, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x82, 0x9E, 0x00, 0x00, 0x04, 0x08, 0x20, 0x18, 0x81, 0x00, 0x00, 0xC5,
+    0x11, 0xFE, 0xB6, 0x86, 0xFE, 0x75, 0x0F, 0xFE, 0x96, 0xF6, 0x35, 0x39, 0x64, 0x00, 0x00, 0x93,
+    0xCD, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0xB6, 0xD5, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0xC5, 0x11, 0xFE, 0xB6, 0xF6, 0x55, 0x84, 0xFE, 0x75, 0x05, 0xF6, 0x55, 0xFE, 0xB6, 0xEE,
+    0x34, 0x52, 0x27, 0x00, 0x00, 0x20, 0xC2, 0xA7, 0x00, 0x00, 0x97, 0x00, 0x00, 0x05, 0x18, 0xE4,
+    0x00, 0x00, 0x63, 0x6D, 0xEF, 0xBE, 0xEF, 0xBE, 0xE7, 0x7E, 0x82, 0xEF, 0x9E, 0x05, 0xE7, 0x7D,
+    0xF7, 0xDF, 0xD6, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC3, 0x8D, 0x00, 0x00, 0x07, 0x10, 0xA2,
+    0x00, 0x00, 0x21, 0x04, 0x6B, 0x6E, 0x4A, 0x69, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x88, 0x00,
+    0x00, 0x01, 0x21, 0x04, 0x19, 0x24, 0x94, 0x00, 0x00, 0x03, 0x20, 0xC2, 0x00, 0x00, 0xBC, 0xD0,
+    0xFE, 0xB6, 0x87, 0xFE, 0x75, 0x0C, 0xF6, 0x75, 0xFE, 0x96, 0xC5, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x4B, 0xD5, 0x92, 0xEE, 0x14, 0xE5, 0xF3, 0xB4, 0x8F, 0x20, 0xE2, 0x00, 0x00, 0x72, 0xE9,
+    0x88, 0xFE, 0x75, 0x05, 0xF6, 0x55, 0xFE, 0xB6, 0xEE, 0x14, 0x39, 0x85, 0x00, 0x00, 0x20, 0xA2,
+    0xA6, 0x00, 0x00, 0x97, 0x00, 0x00, 0x04, 0x21, 0x04, 0x00, 0x00, 0xC6, 0x38, 0xF7, 0xDF, 0xE7,
+    0x7E, 0x84, 0xEF, 0x9E, 0x04, 0xE7, 0x7E, 0xEF, 0xDF, 0x8C, 0x71, 0x00, 0x00, 0x21, 0x24, 0x8E,
+    0x00, 0x00, 0x00, 0x18, 0xE3, 0x82, 0x00, 0x00, 0x01, 0x18, 0xE3, 0x08, 0x82, 0x87, 0x00, 0x00,
+    0x04, 0x10, 0x82, 0x21, 0x24, 0x10, 0xA2, 0x10, 0xC3, 0x21, 0x24, 0x92, 0x00, 0x00, 0x03, 0x20,
+    0xE2, 0x00, 0x00, 0xA4, 0x0D, 0xFE, 0x96, 0x8A, 0xFE, 0x75, 0x01, 0xFE, 0x96, 0xB4, 0x8F, 0x82,
+    0x00, 0x00, 0x00, 0x20, 0xC2, 0x82, 0x00, 0x00, 0x02, 0x6A, 0xA9, 0xF6, 0x35, 0xFE, 0x96, 0x88,
+    0xFE, 0x75, 0x05, 0xF6, 0x55, 0xFE, 0xB6, 0xDD, 0xB3, 0x00, 0x00, 0x00, 0x20, 0x08, 0x40, 0xA5,
+    0x00, 0x00, 0x96, 0x00, 0x00, 0x04, 0x21, 0x04, 0x00, 0x20, 0x00, 0x00, 0xD6, 0xFC, 0xEF, 0xBE,
+    0x85, 0xEF, 0x9E, 0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0xB5, 0xD7, 0x00, 0x00, 0x21, 0x25, 0x8F, 0x00,
+    0x00, 0x02, 0x10, 0xA2, 0x21, 0x45, 0x21, 0x04, 0x88, 0x00, 0x00, 0x00, 0x10, 0x82, 0x84, 0x00,
+    0x00, 0x01, 0x08, 0x82, 0x00, 0x20, 0x8F, 0x00, 0x00, 0x04, 0x20, 0xC2, 0x00, 0x00, 0x6A, 0xA8,
+    0xFE, 0x75, 0xFE, 0x76, 0x8B, 0xFE, 0x75, 0x0A, 0xFE, 0x96, 0xD5, 0x92, 0x83, 0x4B, 0x39, 0x64,
+    0x00, 0x00, 0x10, 0x61, 0x62, 0x68, 0xB4, 0xAF, 0xF6, 0x55, 0xFE, 0x96, 0xF6, 0x75, 0x89, 0xFE,
+    0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xBC, 0xF0, 0x00, 0x00, 0x20, 0xE2, 0xA5, 0x00, 0x00, 0x96,
+    0x00, 0x00, 0x04, 0x19, 0x24, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFC, 0xEF, 0xBE, 0x85, 0xEF, 0x9E,
+    0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0xBD, 0xF8, 0x00, 0x00, 0x21, 0x24, 0x9A, 0x00, 0x00, 0x09, 0x10,
+    0x82, 0x00, 0x00, 0x00, 0x20, 0xAD, 0x96, 0xD6, 0xDB, 0xCE, 0xBA, 0x94, 0xF3, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x8D, 0x00, 0x00, 0x05, 0x10, 0x61, 0x08, 0x20, 0x00, 0x00, 0xE5, 0xD3, 0xFE,
+    0x96, 0xF6, 0x75, 0x8C, 0xFE, 0x75, 0x81, 0xFE, 0x96, 0x05, 0xEE, 0x34, 0xE5, 0xF3, 0xEE, 0x14,
+    0xF6, 0x75, 0xFE, 0xB6, 0xFE, 0x76, 0x8D, 0xFE, 0x75, 0x03, 0xFE, 0x96, 0x7B, 0x2A, 0x00, 0x00,
+    0x20, 0xE2, 0xA4, 0x00, 0x00, 0x97, 0x00, 0x00, 0x04, 0x18, 0xE3, 0x00, 0x00, 0xCE, 0x9A, 0xF7,
+    0xDF, 0xE7, 0x7E, 0x84, 0xEF, 0x9E, 0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0x9C, 0xF3, 0x00, 0x00, 0x21,
+    0x24, 0x99, 0x00, 0x00, 0x81, 0x08, 0x61, 0x08, 0x00, 0x00, 0xCE, 0x79, 0xF7, 0xFF, 0xEF, 0xBF,
+    0xF7, 0xDF, 0xF7, 0xFF, 0xAD, 0x96, 0x00, 0x00, 0x18, 0xE3, 0x8D, 0x00, 0x00, 0x04, 0x20, 0xE2,
+    0x00, 0x00, 0xA4, 0x4E, 0xFE, 0xB6, 0xF6, 0x75, 0x8F, 0xFE, 0x75, 0x82, 0xFE, 0x96, 0x01, 0xFE,
+    0x76, 0xF6, 0x75, 0x8E, 0xFE, 0x75, 0x03, 0xFE, 0x96, 0xE5, 0xD3, 0x00, 0x00, 0x10, 0x40, 0xA4,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x03, 0x21, 0x24, 0x00, 0x00, 0x84, 0x51, 0xF7, 0xDF, 0x84, 0xEF,
+    0x9E, 0x05, 0xE7, 0x7D, 0xEF, 0xBF, 0xE7, 0x5D, 0x39, 0xE7, 0x00, 0x00, 0x18, 0xE3, 0x99, 0x00,
+    0x00, 0x0B, 0x21, 0x24, 0x00, 0x00, 0x7C, 0x10, 0xF7, 0xDF, 0xEF, 0x9E, 0xEF, 0x9E, 0xE7, 0x7E,
+    0xEF, 0xBE, 0xE7, 0x7E, 0x4A, 0x69, 0x00, 0x00, 0x21, 0x04, 0x8B, 0x00, 0x00, 0x04, 0x10, 0x61,
+    0x00, 0x00, 0x20, 0xC2, 0xEE, 0x34, 0xFE, 0x96, 0x87, 0xFE, 0x75, 0x02, 0xF6, 0x55, 0xF6, 0x75,
+    0xF6, 0x55, 0x86, 0xFE, 0x75, 0x81, 0xF6, 0x75, 0x85, 0xFE, 0x75, 0x02, 0xF6, 0x55, 0xF6, 0x75,
+    0xF6, 0x55, 0x87, 0xFE, 0x75, 0x04, 0xF6, 0x75, 0xFE, 0x96, 0x9B, 0xED, 0x00, 0x00, 0x20, 0xE3,
+    0xA3, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0C, 0x18, 0xC3, 0x00, 0x00, 0xBE, 0x18, 0xF7, 0xDF, 0xEF,
+    0xBE, 0xEF, 0x9E, 0xE7, 0x7E, 0xEF, 0x9E, 0xEF, 0xDF, 0xF7, 0xDF, 0x8C, 0x71, 0x00, 0x00, 0x18,
+    0xE4, 0x9A, 0x00, 0x00, 0x04, 0x29, 0x65, 0x00, 0x00, 0xA5, 0x55, 0xEF, 0xDF, 0xE7, 0x7E, 0x82,
+    0xEF, 0x9E, 0x03, 0xEF, 0xBE, 0x7C, 0x10, 0x00, 0x00, 0x29, 0x86, 0x8B, 0x00, 0x00, 0x04, 0x28,
+    0xE3, 0x00, 0x00, 0xA4, 0x4E, 0xFE, 0xB6, 0xF6, 0x75, 0x86, 0xFE, 0x75, 0x06, 0xFE, 0x96, 0xFE,
+    0xB6, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x76, 0xF6, 0x55, 0x8A, 0xFE, 0x75, 0x84, 0xFE,
+    0x96, 0x01, 0xFE, 0x75, 0xF6, 0x55, 0x85, 0xFE, 0x75, 0x04, 0xFE, 0x96, 0xE5, 0xF3, 0x00, 0x00,
+    0x08, 0x20, 0x18, 0xA2, 0xA2, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0B, 0x08, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0x76, 0xE7, 0x7D, 0xEF, 0xBF, 0xF7, 0xDF, 0xEF, 0xBE, 0xDF, 0x1C, 0x84, 0x30, 0x00,
+    0x00, 0x18, 0xE3, 0x9B, 0x00, 0x00, 0x0B, 0x21, 0x24, 0x00, 0x00, 0x7C, 0x30, 0xF7, 0xDF, 0xEF,
+    0x9E, 0xE7, 0x7E, 0xE7, 0x7E, 0xEF, 0xBE, 0xEF, 0x7E, 0x4A, 0x69, 0x00, 0x00, 0x21, 0x04, 0x8A,
+    0x00, 0x00, 0x04, 0x20, 0xC2, 0x00, 0x20, 0x00, 0x00, 0xE5, 0xD3, 0xFE, 0x96, 0x85, 0xFE, 0x75,
+    0x81, 0xFE, 0x96, 0x06, 0xEE, 0x14, 0xD5, 0x72, 0xC5, 0x11, 0xCD, 0x31, 0xDD, 0xB3, 0xF6, 0x55,
+    0xFE, 0xB6, 0x87, 0xFE, 0x75, 0x09, 0xF6, 0x75, 0xFE, 0x96, 0xFE, 0x96, 0xE5, 0xF4, 0xD5, 0x52,
+    0xC5, 0x11, 0xCD, 0x31, 0xE5, 0xD3, 0xFE, 0x76, 0xFE, 0xB6, 0x86, 0xFE, 0x75, 0x03, 0xFE, 0x96,
+    0x83, 0x6B, 0x00, 0x00, 0x29, 0x03, 0xA2, 0x00, 0x00, 0x99, 0x00, 0x00, 0x09, 0x08, 0x61, 0x00,
+    0x20, 0x00, 0x00, 0x42, 0x28, 0x8C, 0x92, 0x9C, 0xF3, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0xE3, 0x9C, 0x00, 0x00, 0x81, 0x08, 0x61, 0x08, 0x00, 0x00, 0xCE, 0x7A, 0xF7, 0xFF, 0xEF, 0xBF,
+    0xF7, 0xDF, 0xF7, 0xFF, 0xAD, 0x96, 0x00, 0x00, 0x18, 0xE3, 0x8B, 0x00, 0x00, 0x02, 0x20, 0xE2,
+    0x00, 0x00, 0x7B, 0x0A, 0x86, 0xFE, 0x75, 0x03, 0xFE, 0x96, 0xF6, 0x34, 0x9C, 0x0D, 0x29, 0x03,
+    0x83, 0x00, 0x00, 0x03, 0x5A, 0x27, 0xC4, 0xF0, 0xFE, 0x96, 0xFE, 0x96, 0x85, 0xFE, 0x75, 0x02,
+    0xFE, 0x96, 0xE5, 0xD3, 0x83, 0x6B, 0x84, 0x00, 0x00, 0x02, 0x6A, 0xC9, 0xD5, 0x72, 0xFE, 0x96,
+    0x84, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xC5, 0x11, 0x00, 0x00, 0x20, 0xC2, 0xA2, 0x00,
+    0x00, 0x9A, 0x00, 0x00, 0x01, 0x08, 0x61, 0x19, 0x04, 0x84, 0x00, 0x00, 0x00, 0x19, 0x04, 0x9E,
+    0x00, 0x00, 0x09, 0x10, 0x82, 0x00, 0x00, 0x10, 0xA2, 0xAD, 0x96, 0xD6, 0xDB, 0xCE, 0xBA, 0x9C,
+    0xF3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x88, 0x00, 0x00, 0x07, 0x10, 0x41, 0x29, 0x23, 0x29,
+    0x03, 0x39, 0x64, 0x00, 0x00, 0xB4, 0xAF, 0xFE, 0xB6, 0xF6, 0x55, 0x82, 0xFE, 0x75, 0x0C, 0xF6,
+    0x75, 0xFE, 0x96, 0xE5, 0xF3, 0x49, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x41, 0xA5, 0x72, 0xEA, 0x6A,
+    0xA9, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x93, 0xCC, 0x85, 0xFE, 0x75, 0x01, 0xFE, 0x96, 0xD5,
+    0x72, 0x82, 0x00, 0x00, 0x02, 0x52, 0x27, 0x7B, 0x0A, 0x62, 0x68, 0x82, 0x00, 0x00, 0x01, 0xB4,
+    0xAF, 0xFE, 0x96, 0x84, 0xFE, 0x75, 0x06, 0xFE, 0x96, 0xEE, 0x14, 0x10, 0x61, 0x20, 0xC2, 0x29,
+    0x03, 0x29, 0x23, 0x20, 0xC2, 0x9F, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x18, 0xC3, 0x29, 0x65,
+    0x29, 0x86, 0x21, 0x45, 0x08, 0x61, 0xA0, 0x00, 0x00, 0x00, 0x10, 0x82, 0x84, 0x00, 0x00, 0x01,
+    0x08, 0x41, 0x00, 0x20, 0x88, 0x00, 0x00, 0x00, 0x18, 0xA2, 0x84, 0x00, 0x00, 0x01, 0xDD, 0xB3,
+    0xFE, 0x96, 0x83, 0xFE, 0x75, 0x0E, 0xF6, 0x75, 0xFE, 0xB6, 0xB4, 0x8F, 0x00, 0x00, 0x49, 0xC6,
+    0xC5, 0x11, 0xF6, 0x35, 0xFE, 0x75, 0xFE, 0x75, 0xEE, 0x14, 0xA4, 0x2E, 0x00, 0x00, 0x00, 0x00,
+    0xED, 0xF4, 0xFE, 0x96, 0x83, 0xFE, 0x75, 0x0B, 0xFE, 0x96, 0x83, 0x6B, 0x00, 0x00, 0x6A, 0xC9,
+    0xD5, 0x92, 0xF6, 0x55, 0xFE, 0x76, 0xFE, 0x55, 0xE5, 0xD3, 0x8B, 0x6B, 0x00, 0x00, 0x31, 0x64,
+    0x86, 0xFE, 0x75, 0x01, 0xFE, 0x96, 0x72, 0xC9, 0x83, 0x00, 0x00, 0x01, 0x20, 0xC2, 0x00, 0x20,
+    0x9D, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x05, 0x10, 0xA2, 0x21, 0x04, 0x10, 0xA2, 0x18, 0xC3, 0x21,
+    0x04, 0x08, 0x61, 0x88, 0x00, 0x00, 0x06, 0x18, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xAC, 0xAC,
+    0x6E, 0xA4, 0x4E, 0xCD, 0x31, 0x86, 0xFE, 0x75, 0x0B, 0xFE, 0x76, 0xF6, 0x35, 0xBC, 0xD0, 0xE5,
+    0xF4, 0xFE, 0xB6, 0xFE, 0x96, 0xFE, 0x75, 0xFE, 0x75, 0xFE, 0x96, 0xFE, 0x96, 0xCD, 0x51, 0xCD,
+    0x51, 0x85, 0xFE, 0x75, 0x0C, 0xFE, 0x96, 0xE5, 0xF4, 0xBC, 0xD0, 0xF6, 0x35, 0xFE, 0xB6, 0xFE,
+    0x76, 0xFE, 0x75, 0xFE, 0x75, 0xFE, 0xB6, 0xFE, 0x75, 0xC4, 0xF0, 0xDD, 0xB3, 0xFE, 0x96, 0x85,
+    0xFE, 0x75, 0x07, 0xFE, 0x96, 0xE5, 0xF3, 0xAC, 0x4E, 0xAC, 0x6F, 0x9C, 0x0D, 0x5A, 0x47, 0x00,
+    0x00, 0x10, 0x61, 0x9D, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x07, 0x18, 0xA2, 0x00, 0x00, 0x62, 0x88,
+    0xE5, 0xF4, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0x87, 0xFE, 0x75, 0x03, 0xFE, 0x76,
+    0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55, 0x84, 0xFE, 0x75, 0x81, 0xFE, 0x96, 0x86, 0xFE, 0x75, 0x03,
+    0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55, 0x84, 0xFE, 0x75, 0x01, 0xFE, 0xB6, 0xFE, 0x96,
+    0x87, 0xFE, 0x75, 0x07, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0x75, 0xAC, 0x8F,
+    0x00, 0x00, 0x18, 0x81, 0x9C, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x08, 0x18, 0x81, 0x00, 0x00, 0x39,
+    0x64, 0xEE, 0x34, 0xFE, 0xB6, 0xF6, 0x55, 0xF6, 0x75, 0xFE, 0x75, 0xF6, 0x75, 0x88, 0xFE, 0x75,
+    0x01, 0xF6, 0x55, 0xF6, 0x75, 0x85, 0xFE, 0x75, 0x81, 0xF6, 0x75, 0x87, 0xFE, 0x75, 0x00, 0xF6,
+    0x55, 0x86, 0xFE, 0x75, 0x01, 0xF6, 0x55, 0xF6, 0x75, 0x88, 0xFE, 0x75, 0x07, 0xF6, 0x75, 0xFE,
+    0x75, 0xF6, 0x55, 0xFE, 0x76, 0xFE, 0xB6, 0xA4, 0x2E, 0x00, 0x00, 0x20, 0xE2, 0x9B, 0x00, 0x00,
+    0xD0, 0x00, 0x00, 0x04, 0x28, 0xE3, 0x00, 0x00, 0xB4, 0xAF, 0xFE, 0xB6, 0xF6, 0x55, 0xB4, 0xFE,
+    0x75, 0x05, 0xF6, 0x75, 0xFE, 0x96, 0xEE, 0x14, 0x10, 0x81, 0x00, 0x00, 0x20, 0xE2, 0x9A, 0x00,
+    0x00, 0xB0, 0x00, 0x00, 0x02, 0x19, 0x04, 0x21, 0x24, 0x19, 0x04, 0x9B, 0x00, 0x00, 0x05, 0x18,
+    0xE3, 0x18, 0xA2, 0x00, 0x00, 0xD5, 0x92, 0xFE, 0x96, 0xF6, 0x75, 0xB7, 0xFE, 0x75, 0x02, 0x6A,
+    0xA9, 0x00, 0x00, 0x31, 0x23, 0x9A, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x02, 0x18, 0xE3, 0x21, 0x24,
+    0x10, 0xA2, 0x82, 0x00, 0x00, 0x02, 0x10, 0x82, 0x21, 0x25, 0x18, 0xE3, 0x98, 0x00, 0x00, 0x05,
+    0x21, 0x02, 0x18, 0xA2, 0x00, 0x00, 0xD5, 0x72, 0xFE, 0x96, 0xF6, 0x55, 0xB7, 0xFE, 0x75, 0x02,
+    0x62, 0xA8, 0x00, 0x00, 0x31, 0x24, 0x9A, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x21, 0x04, 0x82,
+    0x00, 0x00, 0x02, 0x21, 0x24, 0x31, 0xC7, 0x21, 0x24, 0x82, 0x00, 0x00, 0x00, 0x21, 0x04, 0x98,
+    0x00, 0x00, 0x04, 0x29, 0x03, 0x00, 0x00, 0xAC, 0x6E, 0xFE, 0xB6, 0xF6, 0x55, 0xB4, 0xFE, 0x75,
+    0x05, 0xF6, 0x55, 0xFE, 0x96, 0xEE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x18, 0xA2, 0x9A, 0x00, 0x00,
+    0xAA, 0x00, 0x00, 0x0E, 0x08, 0x41, 0x18, 0xE3, 0x00, 0x00, 0x3A, 0x08, 0xA5, 0x55, 0xD6, 0xDB,
+    0xDF, 0x3C, 0xE7, 0x5D, 0xDF, 0x3D, 0xD6, 0xDB, 0xAD, 0x75, 0x42, 0x49, 0x00, 0x00, 0x10, 0xC3,
+    0x08, 0x61, 0x96, 0x00, 0x00, 0x04, 0x10, 0x61, 0x00, 0x00, 0x08, 0x40, 0xE5, 0xF4, 0xFE, 0xB6,
+    0x82, 0xFE, 0x75, 0x00, 0xF6, 0x75, 0xAC, 0xFE, 0x75, 0x00, 0xF6, 0x75, 0x82, 0xFE, 0x75, 0x81,
+    0xFE, 0x96, 0x02, 0x8B, 0xAC, 0x00, 0x00, 0x20, 0xC2, 0x9B, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x06,
+    0x08, 0x41, 0x10, 0xA2, 0x00, 0x00, 0x94, 0xD3, 0xE7, 0x5D, 0xF7, 0xDF, 0xEF, 0xBF, 0x82, 0xEF,
+    0xBE, 0x06, 0xEF, 0xBF, 0xF7, 0xDF, 0xE7, 0x7D, 0x9D, 0x14, 0x00, 0x00, 0x08, 0x41, 0x08, 0x61,
+    0x96, 0x00, 0x00, 0x03, 0x18, 0x81, 0x00, 0x00, 0x49, 0xC6, 0xDD, 0x93, 0x83, 0xFE, 0x96, 0xAC,
+    0xFE, 0x75, 0x83, 0xFE, 0x96, 0x03, 0xEE, 0x35, 0x93, 0xCD, 0x00, 0x00, 0x18, 0xA2, 0x9C, 0x00,
+    0x00, 0xA9, 0x00, 0x00, 0x05, 0x18, 0xC3, 0x00, 0x00, 0xAD, 0x96, 0xF7, 0xDF, 0xEF, 0xBE, 0xE7,
+    0x7E, 0x84, 0xEF, 0x9E, 0x05, 0xE7, 0x7D, 0xEF, 0xBE, 0xF7, 0xDF, 0xB5, 0xF7, 0x00, 0x00, 0x10,
+    0xC3, 0x97, 0x00, 0x00, 0x06, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xC9, 0x93, 0xCC, 0x8B,
+    0xAC, 0xBC, 0xB0, 0x9C, 0xFE, 0x75, 0x00, 0xF6, 0x75, 0x8D, 0xFE, 0x75, 0x07, 0xFE, 0x96, 0xDD,
+    0xB3, 0x93, 0xAC, 0x93, 0xCD, 0x83, 0x4B, 0x29, 0x23, 0x00, 0x00, 0x18, 0xA1, 0x9D, 0x00, 0x00,
+    0xA1, 0x00, 0x00, 0x0A, 0x00, 0x20, 0x21, 0x24, 0x29, 0x66, 0x29, 0x45, 0x08, 0x82, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x94, 0xF3, 0xF7, 0xDF, 0x8A, 0xEF, 0x9E, 0x03, 0xF7, 0xDF,
+    0x9D, 0x34, 0x00, 0x00, 0x21, 0x04, 0x97, 0x00, 0x00, 0x01, 0x18, 0xA2, 0x10, 0x81, 0x83, 0x00,
+    0x00, 0x01, 0xDD, 0x93, 0xFE, 0xB6, 0x8B, 0xFE, 0x75, 0x02, 0xFE, 0x96, 0xFE, 0x76, 0xFE, 0x96,
+    0x8A, 0xFE, 0x75, 0x00, 0xF6, 0x75, 0x82, 0xFE, 0x96, 0x8B, 0xFE, 0x75, 0x01, 0xFE, 0x96, 0x62,
+    0x68, 0x83, 0x00, 0x00, 0x00, 0x20, 0xC2, 0x9E, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x08, 0x61,
+    0x21, 0x24, 0x10, 0xA2, 0x82, 0x00, 0x00, 0x06, 0x08, 0x82, 0x21, 0x24, 0x18, 0xE3, 0x00, 0x00,
+    0x42, 0x28, 0xE7, 0x7D, 0xEF, 0xBE, 0x8A, 0xEF, 0x9E, 0x04, 0xEF, 0xBE, 0xE7, 0x9E, 0x52, 0xAA,
+    0x00, 0x00, 0x21, 0x04, 0x97, 0x00, 0x00, 0x07, 0x08, 0x41, 0x20, 0xE2, 0x28, 0xE3, 0x31, 0x44,
+    0x00, 0x00, 0xB4, 0x8F, 0xFE, 0xB6, 0xF6, 0x75, 0x88, 0xFE, 0x75, 0x07, 0xF6, 0x75, 0xFE, 0x96,
+    0xD5, 0x72, 0x52, 0x27, 0xCD, 0x31, 0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55, 0x85, 0xFE, 0x75, 0x06,
+    0xF6, 0x55, 0xFE, 0x75, 0xFE, 0xB6, 0xDD, 0xB3, 0x5A, 0x68, 0xBC, 0xD0, 0xFE, 0x96, 0x89, 0xFE,
+    0x75, 0x06, 0xFE, 0x96, 0xED, 0xF4, 0x00, 0x00, 0x20, 0xE2, 0x28, 0xE3, 0x29, 0x03, 0x18, 0x81,
+    0x9F, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x0D, 0x18, 0xC3, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x39,
+    0xE7, 0x5A, 0xEB, 0x42, 0x28, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC3, 0x00, 0x00, 0xA5, 0x75, 0xF7,
+    0xDF, 0xE7, 0x7E, 0x8A, 0xEF, 0x9E, 0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0xB5, 0xD7, 0x00, 0x00, 0x21,
+    0x24, 0x9A, 0x00, 0x00, 0x02, 0x20, 0xC2, 0x00, 0x00, 0x6A, 0xC9, 0x8A, 0xFE, 0x75, 0x08, 0xF6,
+    0x75, 0xFE, 0xB6, 0xAC, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x6E, 0xF6, 0x55, 0xFE, 0xB6, 0xFE,
+    0x96, 0x83, 0xFE, 0x75, 0x07, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x76, 0xC4, 0xF0, 0x20, 0xE2, 0x00,
+    0x00, 0x7B, 0x0A, 0xFE, 0x96, 0x88, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xC4, 0xF0, 0x00,
+    0x00, 0x20, 0xC2, 0xA2, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x0D, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0xF3, 0xD6, 0xDB, 0xE7, 0x5D, 0xEF, 0x9E, 0xE7, 0x5D, 0xD6, 0xDB, 0xA5, 0x55, 0x18, 0xE3,
+    0x00, 0x00, 0xDF, 0x1C, 0xEF, 0xBF, 0x8C, 0xEF, 0x9E, 0x04, 0xEF, 0xBF, 0xD6, 0xFB, 0x00, 0x00,
+    0x08, 0x41, 0x10, 0xA2, 0x86, 0x00, 0x00, 0x06, 0x08, 0x41, 0x18, 0xE3, 0x21, 0x24, 0x21, 0x25,
+    0x21, 0x24, 0x21, 0x24, 0x18, 0xC3, 0x8B, 0x00, 0x00, 0x04, 0x20, 0xC2, 0x10, 0x61, 0x00, 0x00,
+    0xDD, 0xB3, 0xFE, 0x96, 0x8A, 0xFE, 0x75, 0x12, 0xF6, 0x55, 0x93, 0xAC, 0x00, 0x00, 0x00, 0x00,
+    0x5A, 0x47, 0xBC, 0xF0, 0xEE, 0x14, 0xFE, 0x75, 0xFE, 0x96, 0xFE, 0x96, 0xFE, 0x75, 0xEE, 0x14,
+    0xCD, 0x31, 0x72, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA8, 0xEE, 0x14, 0xFE, 0x96, 0x89, 0xFE,
+    0x75, 0x03, 0xFE, 0x96, 0x73, 0x0A, 0x00, 0x00, 0x29, 0x03, 0xA2, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x05, 0x18, 0xE3, 0x00, 0x00, 0x42, 0x28, 0xD6, 0xDB, 0xF7, 0xDF, 0xEF, 0xBF, 0x82, 0xEF, 0xBE,
+    0x03, 0xEF, 0xBF, 0xF7, 0xDF, 0xDF, 0x1C, 0xD6, 0xFB, 0x8E, 0xEF, 0x9E, 0x05, 0xEF, 0xBE, 0xE7,
+    0x7D, 0x4A, 0x49, 0x00, 0x00, 0x29, 0x65, 0x00, 0x20, 0x84, 0x00, 0x00, 0x01, 0x19, 0x04, 0x21,
+    0x04, 0x85, 0x00, 0x00, 0x01, 0x21, 0x24, 0x18, 0xE3, 0x8A, 0x00, 0x00, 0x04, 0x29, 0x03, 0x00,
+    0x00, 0x9C, 0x0D, 0xFE, 0x96, 0xF6, 0x75, 0x89, 0xFE, 0x75, 0x81, 0xFE, 0x96, 0x01, 0xB4, 0xB0,
+    0x18, 0xC2, 0x82, 0x00, 0x00, 0x04, 0x6A, 0xA9, 0x83, 0x4B, 0x83, 0x4B, 0x72, 0xE9, 0x29, 0x03,
+    0x82, 0x00, 0x00, 0x03, 0xA4, 0x2D, 0xF6, 0x55, 0xFE, 0x96, 0xF6, 0x75, 0x88, 0xFE, 0x75, 0x04,
+    0xFE, 0x96, 0xDD, 0xB3, 0x00, 0x00, 0x10, 0x81, 0x18, 0x81, 0xA2, 0x00, 0x00, 0x9B, 0x00, 0x00,
+    0x05, 0x10, 0xA2, 0x00, 0x00, 0x29, 0x65, 0xDF, 0x1C, 0xF7, 0xDF, 0xE7, 0x7E, 0x84, 0xEF, 0x9E,
+    0x02, 0xE7, 0x7E, 0xEF, 0xBE, 0xEF, 0xBF, 0x8F, 0xEF, 0x9E, 0x05, 0xEF, 0xBE, 0x7C, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xA2, 0x10, 0xA2, 0x82, 0x00, 0x00, 0x0B, 0x19, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x31, 0xA6, 0x6B, 0x8E, 0x84, 0x30, 0x84, 0x10, 0x6B, 0x6D, 0x08, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xE3, 0x89, 0x00, 0x00, 0x04, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0xED, 0xF4, 0xFE,
+    0x96, 0x8B, 0xFE, 0x75, 0x03, 0xFE, 0xB6, 0xEE, 0x14, 0xAC, 0x4E, 0x52, 0x27, 0x85, 0x00, 0x00,
+    0x04, 0x41, 0xA5, 0x9B, 0xED, 0xE5, 0xD3, 0xFE, 0x96, 0xFE, 0x96, 0x8A, 0xFE, 0x75, 0x03, 0xFE,
+    0x96, 0x8B, 0x8C, 0x00, 0x00, 0x20, 0xE3, 0xA3, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x04, 0x18, 0xE3,
+    0x00, 0x00, 0xBE, 0x18, 0xF7, 0xDF, 0xE7, 0x7D, 0x86, 0xEF, 0x9E, 0x81, 0xE7, 0x7E, 0x90, 0xEF,
+    0x9E, 0x0B, 0xE7, 0x5D, 0xC6, 0x59, 0x84, 0x51, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA2, 0x00, 0x00,
+    0x19, 0x04, 0x00, 0x00, 0x52, 0xCB, 0xBE, 0x18, 0xE7, 0x5D, 0x82, 0xEF, 0xBE, 0x05, 0xEF, 0x9E,
+    0xDF, 0x3C, 0xAD, 0x96, 0x29, 0x86, 0x00, 0x00, 0x21, 0x04, 0x89, 0x00, 0x00, 0x03, 0x20, 0xE2,
+    0x00, 0x00, 0x93, 0xCC, 0xFE, 0x96, 0x8B, 0xFE, 0x75, 0x0C, 0xF6, 0x75, 0xFE, 0x96, 0xFE, 0x96,
+    0xF6, 0x55, 0xDD, 0xB3, 0xC5, 0x11, 0xBC, 0xD0, 0xBC, 0xD0, 0xC4, 0xF0, 0xDD, 0xB3, 0xF6, 0x35,
+    0xFE, 0x96, 0xFE, 0x96, 0x8A, 0xFE, 0x75, 0x04, 0xF6, 0x75, 0xFE, 0xB6, 0xDD, 0x92, 0x00, 0x00,
+    0x18, 0xA1, 0xA4, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x02, 0x21, 0x25, 0x00, 0x00, 0x5A, 0xCB, 0x9C,
+    0xEF, 0x9E, 0x0B, 0xEF, 0xBE, 0xF7, 0xDF, 0xF7, 0xDF, 0xC6, 0x59, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0x86, 0x00, 0x00, 0x94, 0xD3, 0xEF, 0x9E, 0xF7, 0xDF, 0xEF, 0xBE, 0x83, 0xEF, 0x9E, 0x05, 0xEF,
+    0xBF, 0xF7, 0xDF, 0xE7, 0x5D, 0x73, 0xCF, 0x00, 0x00, 0x19, 0x04, 0x88, 0x00, 0x00, 0x05, 0x08,
+    0x40, 0x18, 0xA1, 0x00, 0x00, 0xD5, 0x92, 0xFE, 0xB6, 0xF6, 0x75, 0x8B, 0xFE, 0x75, 0x02, 0xF6,
+    0x75, 0xFE, 0x96, 0xFE, 0x96, 0x83, 0xFE, 0xB6, 0x81, 0xFE, 0x96, 0x8C, 0xFE, 0x75, 0x04, 0xFE,
+    0x76, 0xFE, 0x75, 0x6A, 0xA8, 0x00, 0x00, 0x20, 0xC2, 0xA4, 0x00, 0x00, 0x99, 0x00, 0x00, 0x04,
+    0x21, 0x24, 0x31, 0x86, 0x00, 0x00, 0x9D, 0x14, 0xF7, 0xDF, 0x9C, 0xEF, 0x9E, 0x09, 0xE7, 0x7E,
+    0xEF, 0x9E, 0xF7, 0xFF, 0xCE, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x14, 0xF7, 0xDF, 0xEF, 0xBE,
+    0xE7, 0x7D, 0x85, 0xEF, 0x9E, 0x05, 0xE7, 0x7D, 0xEF, 0xBF, 0xEF, 0xBE, 0x7B, 0xEF, 0x00, 0x00,
+    0x19, 0x04, 0x88, 0x00, 0x00, 0x04, 0x18, 0xA2, 0x00, 0x00, 0x49, 0xE6, 0xF6, 0x55, 0xFE, 0x96,
+    0x8D, 0xFE, 0x75, 0x85, 0xF6, 0x55, 0x8C, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xAC, 0x6E,
+    0x00, 0x00, 0x20, 0xE2, 0xA5, 0x00, 0x00, 0x97, 0x00, 0x00, 0x81, 0x21, 0x04, 0x82, 0x00, 0x00,
+    0x02, 0xAD, 0xB6, 0xF7, 0xDF, 0xE7, 0x7E, 0x9D, 0xEF, 0x9E, 0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0xC6,
+    0x59, 0xAD, 0x96, 0xEF, 0xBE, 0x89, 0xEF, 0x9E, 0x05, 0xE7, 0x7E, 0xEF, 0xBF, 0xE7, 0x7D, 0x42,
+    0x49, 0x00, 0x00, 0x18, 0xC3, 0x88, 0x00, 0x00, 0x03, 0x20, 0xE2, 0x00, 0x00, 0x83, 0x6B, 0xFE,
+    0x96, 0x9F, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xD5, 0x52, 0x00, 0x00, 0x18, 0xA2, 0xA6,
+    0x00, 0x00, 0x95, 0x00, 0x00, 0x01, 0x10, 0xA3, 0x18, 0xE3, 0x82, 0x00, 0x00, 0x03, 0x4A, 0x8A,
+    0x63, 0x4D, 0xDF, 0x1C, 0xEF, 0xBE, 0xA0, 0xEF, 0x9E, 0x01, 0xEF, 0xDF, 0xF7, 0xDF, 0x8B, 0xEF,
+    0x9E, 0x05, 0xE7, 0x7E, 0xF7, 0xDF, 0xBE, 0x18, 0x00, 0x00, 0x18, 0xE4, 0x10, 0x82, 0x88, 0x00,
+    0x00, 0x03, 0x20, 0xE2, 0x00, 0x00, 0xA4, 0x4E, 0xFE, 0xB6, 0x9D, 0xFE, 0x75, 0x05, 0xF6, 0x55,
+    0xFE, 0xB6, 0xE5, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0xA6, 0x00, 0x00, 0x94, 0x00, 0x00,
+    0x08, 0x18, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x73, 0xAE, 0xBE, 0x38, 0xDF, 0x1C, 0xE7, 0x7D, 0xEF,
+    0x9E, 0xEF, 0xBE, 0x90, 0xEF, 0x9E, 0x00, 0xEF, 0x7E, 0x8F, 0xEF, 0x9E, 0x81, 0xE7, 0x7E, 0x8C,
+    0xEF, 0x9E, 0x04, 0xEF, 0xBE, 0xE7, 0x7D, 0x4A, 0x49, 0x00, 0x00, 0x21, 0x24, 0x89, 0x00, 0x00,
+    0x05, 0x29, 0x03, 0x00, 0x00, 0xAC, 0x6F, 0xFE, 0xB6, 0xFE, 0x76, 0xF6, 0x75, 0x99, 0xFE, 0x75,
+    0x05, 0xF6, 0x55, 0xFE, 0xB6, 0xE5, 0xD3, 0x29, 0x03, 0x00, 0x00, 0x18, 0x81, 0xA7, 0x00, 0x00,
+    0x93, 0x00, 0x00, 0x07, 0x18, 0xC3, 0x00, 0x00, 0x18, 0xC3, 0xBE, 0x38, 0xEF, 0xBE, 0xF7, 0xDF,
+    0xEF, 0xBE, 0xEF, 0xBE, 0x90, 0xEF, 0x9E, 0x05, 0xE7, 0x7E, 0xEF, 0x9E, 0xF7, 0xDF, 0xEF, 0xDF,
+    0xEF, 0xBF, 0xEF, 0xBE, 0x9C, 0xEF, 0x9E, 0x03, 0xEF, 0xBF, 0x8C, 0x71, 0x00, 0x00, 0x21, 0x45,
+    0x88, 0x00, 0x00, 0x00, 0x18, 0x81, 0x82, 0x00, 0x00, 0x03, 0x9C, 0x0D, 0xFE, 0x96, 0xFE, 0x96,
+    0xF6, 0x55, 0x98, 0xFE, 0x75, 0x05, 0xFE, 0xB6, 0xD5, 0x92, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xA1, 0xA7, 0x00, 0x00, 0x92, 0x00, 0x00, 0x04, 0x10, 0xC3, 0x00, 0x00, 0x29, 0x85, 0xD6,
+    0xFB, 0xF7, 0xDF, 0x94, 0xEF, 0x9E, 0x06, 0xF7, 0xDF, 0xE7, 0x7D, 0xC6, 0x38, 0x94, 0xD3, 0x7B,
+    0xF0, 0xC6, 0x59, 0xEF, 0xBE, 0x8A, 0xEF, 0x9E, 0x82, 0xE7, 0x7E, 0x8C, 0xEF, 0x9E, 0x04, 0xE7,
+    0x7E, 0xEF, 0xDF, 0xA5, 0x55, 0x00, 0x00, 0x21, 0x24, 0x87, 0x00, 0x00, 0x0A, 0x18, 0xA2, 0x00,
+    0x00, 0x52, 0x06, 0x93, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x0A, 0xEE, 0x14, 0xFE, 0xB6, 0xFE,
+    0x75, 0xF6, 0x75, 0x93, 0xFE, 0x75, 0x09, 0xF6, 0x75, 0xFE, 0x96, 0xFE, 0x96, 0xB4, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x62, 0x88, 0x8B, 0x8C, 0x00, 0x00, 0x18, 0xA2, 0xA6, 0x00, 0x00, 0x91, 0x00,
+    0x00, 0x05, 0x08, 0x41, 0x10, 0xA2, 0x00, 0x00, 0xCE, 0x9A, 0xF7, 0xDF, 0xE7, 0x7D, 0x93, 0xEF,
+    0x9E, 0x02, 0xF7, 0xDF, 0xC6, 0x79, 0x4A, 0x8A, 0x82, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xEF, 0xBE,
+    0x89, 0xEF, 0x9E, 0x00, 0xEF, 0xBE, 0x82, 0xF7, 0xDF, 0x01, 0xEF, 0xBE, 0xE7, 0x7E, 0x8A, 0xEF,
+    0x9E, 0x04, 0xE7, 0x7E, 0xF7, 0xDF, 0xAD, 0x96, 0x00, 0x00, 0x21, 0x24, 0x86, 0x00, 0x00, 0x0D,
+    0x10, 0x61, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xB3, 0xFE, 0xB6, 0xB4, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x44, 0xC5, 0x11, 0xFE, 0x75, 0xFE, 0xB6, 0xFE, 0x75, 0xF6, 0x55, 0x8E, 0xFE, 0x75, 0x0D,
+    0xF6, 0x55, 0xFE, 0x75, 0xFE, 0x96, 0xFE, 0xB6, 0xE5, 0xF3, 0x83, 0x4A, 0x00, 0x00, 0x00, 0x00,
+    0x6A, 0xC9, 0xEE, 0x35, 0xFE, 0x96, 0x7B, 0x2A, 0x00, 0x00, 0x20, 0xC2, 0xA5, 0x00, 0x00, 0x91,
+    0x00, 0x00, 0x04, 0x21, 0x24, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0xE7, 0x7E, 0x92, 0xEF, 0x9E,
+    0x02, 0xE7, 0x7E, 0xEF, 0xDF, 0xBE, 0x18, 0x82, 0x00, 0x00, 0x03, 0x6B, 0x6D, 0x8C, 0x92, 0xCE,
+    0x9A, 0xEF, 0xBE, 0x89, 0xEF, 0x9E, 0x05, 0xE7, 0x5D, 0xA5, 0x55, 0xAD, 0x76, 0xC6, 0x59, 0xE7,
+    0x5D, 0xF7, 0xDF, 0x8B, 0xEF, 0x9E, 0x03, 0xF7, 0xDF, 0x94, 0xF3, 0x00, 0x00, 0x21, 0x24, 0x86,
+    0x00, 0x00, 0x11, 0x20, 0xC2, 0x00, 0x00, 0xC5, 0x31, 0xFE, 0xB6, 0xFE, 0x75, 0xFE, 0x96, 0xD5,
+    0x72, 0x41, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x72, 0xE9, 0xD5, 0x72, 0xFE, 0x75, 0xFE, 0xB6, 0xFE,
+    0x96, 0xFE, 0x75, 0xF6, 0x75, 0xF6, 0x75, 0x86, 0xFE, 0x75, 0x07, 0xF6, 0x75, 0xF6, 0x55, 0xFE,
+    0x75, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xEE, 0x14, 0xA4, 0x2E, 0x82, 0x00, 0x00, 0x07, 0xA4,
+    0x2E, 0xFE, 0x75, 0xFE, 0x96, 0xFE, 0x96, 0xF6, 0x55, 0x49, 0xE6, 0x00, 0x00, 0x18, 0xA2, 0xA4,
+    0x00, 0x00, 0x90, 0x00, 0x00, 0x04, 0x08, 0x41, 0x10, 0x82, 0x00, 0x00, 0xD6, 0xDB, 0xEF, 0xBF,
+    0x93, 0xEF, 0x9E, 0x08, 0xEF, 0xBF, 0xD6, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x52, 0xAB, 0xCE, 0xBA,
+    0xEF, 0x9E, 0xEF, 0xBF, 0xEF, 0xBF, 0x88, 0xEF, 0x9E, 0x02, 0xE7, 0x7E, 0xF7, 0xDF, 0xA5, 0x75,
+    0x82, 0x00, 0x00, 0x02, 0x42, 0x28, 0xB5, 0xB6, 0xEF, 0xBE, 0x8A, 0xEF, 0x9E, 0x03, 0xF7, 0xDF,
+    0x73, 0xCF, 0x00, 0x00, 0x29, 0x66, 0x85, 0x00, 0x00, 0x09, 0x20, 0xE2, 0x00, 0x00, 0x9B, 0xED,
+    0xFE, 0x96, 0xFE, 0x75, 0xFE, 0x75, 0xF6, 0x75, 0xFE, 0xB6, 0xF6, 0x35, 0x9C, 0x0D, 0x82, 0x00,
+    0x00, 0x05, 0x72, 0xE9, 0xC4, 0xF0, 0xEE, 0x14, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0xB6, 0x86, 0xFE,
+    0x96, 0x12, 0xFE, 0xB6, 0xFE, 0x96, 0xFE, 0x96, 0xF6, 0x55, 0xD5, 0x92, 0x9B, 0xED, 0x20, 0xC2,
+    0x00, 0x00, 0x00, 0x00, 0x62, 0x88, 0xD5, 0x92, 0xFE, 0x96, 0xFE, 0x76, 0xFE, 0x75, 0xF6, 0x75,
+    0xFE, 0xB6, 0xDD, 0xB3, 0x00, 0x00, 0x18, 0x81, 0xA4, 0x00, 0x00, 0x90, 0x00, 0x00, 0x02, 0x29,
+    0x65, 0x00, 0x00, 0x63, 0x2C, 0x95, 0xEF, 0x9E, 0x05, 0xEF, 0xBE, 0x84, 0x51, 0x00, 0x00, 0x3A,
+    0x08, 0xDF, 0x3C, 0xF7, 0xFF, 0x8C, 0xEF, 0x9E, 0x03, 0xEF, 0xBE, 0xD6, 0xFB, 0x73, 0xAE, 0x5A,
+    0xEB, 0x82, 0x00, 0x00, 0x00, 0x84, 0x51, 0x8A, 0xEF, 0x9E, 0x04, 0xEF, 0xBE, 0xCE, 0x9A, 0x31,
+    0xC7, 0x00, 0x00, 0x18, 0xE3, 0x83, 0x00, 0x00, 0x04, 0x10, 0x81, 0x00, 0x00, 0x31, 0x64, 0xF6,
+    0x35, 0xFE, 0x96, 0x82, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0x96, 0xFE, 0x96, 0xDD, 0xB3, 0x8B,
+    0x8C, 0x82, 0x00, 0x00, 0x0E, 0x20, 0xE3, 0x83, 0x4A, 0xB4, 0x8F, 0xD5, 0x52, 0xE5, 0xF3, 0xEE,
+    0x34, 0xF6, 0x35, 0xF6, 0x55, 0xF6, 0x55, 0xF6, 0x35, 0xEE, 0x14, 0xDD, 0x92, 0xC4, 0xF0, 0x93,
+    0xCD, 0x52, 0x27, 0x82, 0x00, 0x00, 0x03, 0x5A, 0x47, 0xBC, 0xF0, 0xFE, 0x75, 0xFE, 0xB6, 0x83,
+    0xFE, 0x75, 0x04, 0xF6, 0x75, 0xFE, 0xB6, 0xA4, 0x2D, 0x00, 0x00, 0x20, 0xE2, 0xA3, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x03, 0x29, 0x65, 0x00, 0x00, 0x84, 0x51, 0xEF, 0xBF, 0x93, 0xEF, 0x9E, 0x06,
+    0xEF, 0xBE, 0xE7, 0x3D, 0x39, 0xC7, 0x00, 0x00, 0xAD, 0xB6, 0xF7, 0xDF, 0xE7, 0x7D, 0x8D, 0xEF,
+    0x9E, 0x81, 0xEF, 0xBE, 0x06, 0xEF, 0x9E, 0xD6, 0xDB, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0x14, 0xEF, 0xBF, 0x89, 0xEF, 0x9E, 0x04, 0xF7, 0xDF, 0xE7, 0x5D, 0x7C, 0x10, 0x00, 0x00, 0x21,
+    0x04, 0x82, 0x00, 0x00, 0x04, 0x20, 0xC2, 0x00, 0x00, 0xC4, 0xF0, 0xFE, 0xB6, 0xF6, 0x55, 0x85,
+    0xFE, 0x75, 0x81, 0xFE, 0x96, 0x02, 0xE5, 0xD3, 0xA4, 0x2E, 0x52, 0x07, 0x84, 0x00, 0x00, 0x05,
+    0x31, 0x44, 0x41, 0xA5, 0x49, 0xE6, 0x41, 0xC6, 0x39, 0x64, 0x18, 0xA2, 0x83, 0x00, 0x00, 0x05,
+    0x18, 0x81, 0x83, 0x6B, 0xCD, 0x31, 0xF6, 0x55, 0xFE, 0xB6, 0xFE, 0x76, 0x85, 0xFE, 0x75, 0x04,
+    0xFE, 0x96, 0xF6, 0x35, 0x31, 0x44, 0x00, 0x00, 0x18, 0xC2, 0xA2, 0x00, 0x00, 0x90, 0x00, 0x00,
+    0x03, 0x29, 0x45, 0x00, 0x00, 0x94, 0xB3, 0xEF, 0xBF, 0x92, 0xEF, 0x9E, 0x06, 0xE7, 0x7E, 0xF7,
+    0xDF, 0xCE, 0x9A, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xBB, 0xF7, 0xDF, 0x91, 0xEF, 0x9E, 0x06, 0xF7,
+    0xDF, 0xEF, 0xBE, 0x8C, 0x92, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xDB, 0xF7, 0xDF, 0x89, 0xEF, 0x9E,
+    0x81, 0xEF, 0xBE, 0x08, 0x7C, 0x10, 0x00, 0x00, 0x18, 0xE3, 0x00, 0x00, 0x20, 0xC2, 0x00, 0x00,
+    0x52, 0x27, 0xF6, 0x55, 0xFE, 0x76, 0x88, 0xFE, 0x75, 0x07, 0xFE, 0x96, 0xFE, 0xB6, 0xF6, 0x55,
+    0xD5, 0x92, 0xAC, 0x6F, 0x83, 0x4B, 0x52, 0x27, 0x00, 0x20, 0x85, 0x00, 0x00, 0x08, 0x41, 0xA5,
+    0x6A, 0xA9, 0x9C, 0x0D, 0xC5, 0x31, 0xEE, 0x14, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55,
+    0x86, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0x96, 0xB4, 0x8F, 0x00, 0x00, 0x20, 0xE2, 0xA2, 0x00,
+    0x00, 0x90, 0x00, 0x00, 0x03, 0x29, 0x65, 0x00, 0x00, 0x84, 0x71, 0xEF, 0xBF, 0x93, 0xEF, 0x9E,
+    0x05, 0xF7, 0xDF, 0xD6, 0xDB, 0x00, 0x00, 0x21, 0x45, 0xE7, 0x5D, 0xEF, 0xBE, 0x91, 0xEF, 0x9E,
+    0x06, 0xE7, 0x7D, 0xEF, 0xBE, 0xE7, 0x7E, 0x4A, 0x69, 0x00, 0x00, 0x94, 0xD3, 0xEF, 0xBF, 0x89,
+    0xEF, 0x9E, 0x0A, 0xE7, 0x7E, 0xEF, 0xBF, 0xE7, 0x5D, 0x42, 0x28, 0x00, 0x00, 0x10, 0xC3, 0x20,
+    0xE3, 0x00, 0x00, 0xBC, 0xD0, 0xFE, 0xB6, 0xF6, 0x55, 0x8A, 0xFE, 0x75, 0x81, 0xFE, 0x96, 0x10,
+    0xFE, 0xB6, 0xFE, 0x96, 0xF6, 0x55, 0xEE, 0x14, 0xDD, 0xB3, 0xDD, 0x92, 0xD5, 0x72, 0xD5, 0x92,
+    0xDD, 0x92, 0xE5, 0xD3, 0xF6, 0x35, 0xFE, 0x75, 0xFE, 0x96, 0xFE, 0xB6, 0xFE, 0x96, 0xFE, 0x75,
+    0xF6, 0x55, 0x89, 0xFE, 0x75, 0x04, 0xFE, 0x96, 0xEE, 0x14, 0x18, 0xA2, 0x00, 0x00, 0x10, 0x41,
+    0xA1, 0x00, 0x00, 0x90, 0x00, 0x00, 0x02, 0x29, 0x65, 0x00, 0x00, 0x63, 0x4D, 0x96, 0xEF, 0x9E,
+    0x02, 0xC6, 0x79, 0xCE, 0xBA, 0xEF, 0xBE, 0x93, 0xEF, 0x9E, 0x04, 0xE7, 0x7D, 0xF7, 0xDF, 0xA5,
+    0x55, 0x00, 0x00, 0x6B, 0x6D, 0x8B, 0xEF, 0x9E, 0x08, 0xE7, 0x7D, 0xF7, 0xDF, 0xB5, 0xF7, 0x00,
+    0x00, 0x21, 0x04, 0x00, 0x00, 0x10, 0x61, 0xEE, 0x14, 0xFE, 0x96, 0x8D, 0xFE, 0x75, 0x04, 0xF6,
+    0x55, 0xFE, 0x75, 0xFE, 0x76, 0xFE, 0x96, 0xFE, 0xB6, 0x83, 0xFE, 0x96, 0x01, 0xFE, 0xB6, 0xFE,
+    0x96, 0x90, 0xFE, 0x75, 0x03, 0xFE, 0x96, 0x93, 0xCC, 0x00, 0x00, 0x29, 0x03, 0xA1, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x04, 0x10, 0x82, 0x08, 0x61, 0x00, 0x00, 0xD6, 0xFB, 0xEF, 0xBF, 0x94, 0xEF,
+    0x9E, 0x01, 0xF7, 0xDF, 0xEF, 0xBF, 0x94, 0xEF, 0x9E, 0x06, 0xE7, 0x7E, 0xF7, 0xDF, 0xBD, 0xF7,
+    0x00, 0x00, 0x42, 0x49, 0xE7, 0x7D, 0xEF, 0xBE, 0x8A, 0xEF, 0x9E, 0x06, 0xEF, 0xBE, 0xE7, 0x5D,
+    0x29, 0x65, 0x10, 0x20, 0x00, 0x00, 0x83, 0x6B, 0xFE, 0x96, 0x92, 0xFE, 0x75, 0x00, 0xF6, 0x75,
+    0x83, 0xF6, 0x55, 0x91, 0xFE, 0x75, 0x04, 0xF6, 0x55, 0xFE, 0xB6, 0xCD, 0x52, 0x00, 0x00, 0x20,
+    0xC2, 0xA1, 0x00, 0x00, 0x91, 0x00, 0x00, 0x04, 0x21, 0x24, 0x00, 0x00, 0x9C, 0xF3, 0xF7, 0xDF,
+    0xE7, 0x7E, 0x93, 0xEF, 0x9E, 0x81, 0xE7, 0x7E, 0x95, 0xEF, 0x9E, 0x04, 0xEF, 0xBE, 0xDF, 0x1C,
+    0x42, 0x28, 0x8C, 0x92, 0xEF, 0xBE, 0x8C, 0xEF, 0x9E, 0x06, 0xEF, 0xBE, 0x7C, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0xBC, 0xF0, 0xFE, 0x96, 0xF6, 0x55, 0xA9, 0xFE, 0x75, 0x04, 0xFE, 0x96, 0xEE, 0x34,
+    0x31, 0x24, 0x00, 0x00, 0x29, 0x03, 0xA0, 0x00, 0x00, 0x91, 0x00, 0x00, 0x81, 0x08, 0x61, 0x03,
+    0x00, 0x00, 0xCE, 0xBA, 0xF7, 0xDF, 0xE7, 0x7D, 0xAB, 0xEF, 0x9E, 0x00, 0xEF, 0xBE, 0x8E, 0xEF,
+    0x9E, 0x06, 0xE7, 0x7E, 0xF7, 0xDF, 0x94, 0xD3, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xB3, 0xFE, 0x96,
+    0xAB, 0xFE, 0x75, 0x03, 0xFE, 0x96, 0x7B, 0x0A, 0x00, 0x00, 0x29, 0x03, 0xA0, 0x00, 0x00, 0x92,
+    0x00, 0x00, 0x05, 0x18, 0xC3, 0x00, 0x00, 0x39, 0xC7, 0xDF, 0x1C, 0xF7, 0xDF, 0xEF, 0x9E, 0x8E,
+    0xE7, 0x7E, 0x93, 0xEF, 0x9E, 0x87, 0xE7, 0x7E, 0x03, 0xE7, 0x7D, 0xEF, 0x9E, 0xEF, 0x9E, 0xE7,
+    0x7D, 0x8B, 0xE7, 0x7E, 0x06, 0xE7, 0x7D, 0xEF, 0xBF, 0x94, 0xF3, 0x00, 0x00, 0x41, 0xC6, 0xEE,
+    0x14, 0xFE, 0x75, 0xAB, 0xF6, 0x55, 0x03, 0xFE, 0x96, 0xA4, 0x2E, 0x00, 0x00, 0x29, 0x03, 0xA0,
+    0x00, 0x00, 0x93, 0x00, 0x00, 0x04, 0x18, 0xE3, 0x00, 0x00, 0x29, 0x65, 0xCE, 0x79, 0xEF, 0xDF,
+    0x8E, 0xF7, 0xDF, 0x02, 0xEF, 0xBF, 0xEF, 0x9E, 0xE7, 0x7E, 0x8D, 0xEF, 0x9E, 0x02, 0xE7, 0x7E,
+    0xEF, 0x9E, 0xEF, 0xBF, 0x98, 0xF7, 0xDF, 0x05, 0xF7, 0xFF, 0x84, 0x30, 0x00, 0x00, 0x6A, 0xC9,
+    0xFE, 0x96, 0xFE, 0xB6, 0xAB, 0xFE, 0x96, 0x03, 0xFE, 0xD7, 0xC5, 0x10, 0x00, 0x00, 0x28, 0xE3,
+    0xA0, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x84, 0x51, 0xC6,
+    0x38, 0x8C, 0xC6, 0x59, 0x03, 0xC6, 0x79, 0xDE, 0xFC, 0xEF, 0xBE, 0xF7, 0xDF, 0x8D, 0xEF, 0x9E,
+    0x03, 0xEF, 0xDF, 0xEF, 0xBE, 0xDF, 0x1C, 0xC6, 0x79, 0x97, 0xC6, 0x59, 0x04, 0xBE, 0x38, 0x41,
+    0xE7, 0x00, 0x00, 0x6A, 0xA9, 0xD5, 0x72, 0xAB, 0xD5, 0x52, 0x05, 0xCD, 0x52, 0xD5, 0x92, 0xAC,
+    0x4E, 0x00, 0x00, 0x20, 0xA2, 0x20, 0x62, 0x86, 0x20, 0x82, 0x81, 0x20, 0x62, 0x96, 0x00, 0x00,
+    0x93, 0x00, 0x00, 0x03, 0x08, 0x20, 0x20, 0x41, 0x10, 0x82, 0x00, 0x20, 0x90, 0x00, 0x00, 0x02,
+    0x73, 0xCF, 0xCE, 0xBA, 0xF7, 0xDF, 0x8B, 0xEF, 0x9E, 0x02, 0xF7, 0xDF, 0xD6, 0xDB, 0x7B, 0xCF,
+    0xD9, 0x00, 0x00, 0x01, 0x10, 0x20, 0x20, 0x62, 0x94, 0x00, 0x00, 0x93, 0x00, 0x00, 0x05, 0x18,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x49, 0x46, 0x59, 0xC7, 0x59, 0xC8, 0x8C, 0x59, 0xC7, 0x00, 0x49,
+    0x86, 0x82, 0x00, 0x00, 0x01, 0xB5, 0xF7, 0xF7, 0xDF, 0x89, 0xEF, 0x9E, 0x01, 0xEF, 0xBF, 0xB5,
+    0xF7, 0x82, 0x00, 0x00, 0x01, 0x49, 0x86, 0x59, 0xA7, 0x97, 0x59, 0xC7, 0x02, 0x59, 0x66, 0x51,
+    0x66, 0x59, 0x66, 0xAE, 0x59, 0xA7, 0x01, 0x59, 0x87, 0x51, 0x66, 0x88, 0x59, 0x66, 0x04, 0x51,
+    0x66, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00, 0x18, 0x41, 0x93, 0x00, 0x00, 0x92, 0x00, 0x00, 0x03,
+    0x10, 0x21, 0x00, 0x00, 0xA2, 0xAC, 0xEC, 0x12, 0x8F, 0xFC, 0x53, 0x07, 0xFC, 0x33, 0xDB, 0xD1,
+    0x7A, 0x29, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x79, 0xF7, 0xDF, 0xE7, 0x7E, 0x86, 0xEF, 0x9E, 0x06,
+    0xF7, 0xDF, 0xCE, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x72, 0x29, 0xDB, 0xB1, 0xFC, 0x33, 0xD6, 0xFC,
+    0x53, 0x04, 0xFC, 0x33, 0xEB, 0xF2, 0x92, 0x6B, 0x00, 0x00, 0x10, 0x21, 0x92, 0x00, 0x00, 0x91,
+    0x00, 0x00, 0x05, 0x20, 0x62, 0x00, 0x00, 0xB3, 0x0E, 0xFC, 0x94, 0xFC, 0x74, 0xFC, 0x54, 0x8E,
+    0xFC, 0x74, 0x06, 0xFC, 0x54, 0xFC, 0x74, 0xFC, 0x54, 0x82, 0x4A, 0x00, 0x00, 0x52, 0x8A, 0xE7,
+    0x7E, 0x88, 0xEF, 0x9E, 0x05, 0x5A, 0xCB, 0x00, 0x00, 0x7A, 0x4A, 0xFC, 0x54, 0xFC, 0x94, 0xFC,
+    0x54, 0xD6, 0xFC, 0x74, 0x05, 0xFC, 0x54, 0xFC, 0x74, 0xFC, 0x74, 0xB2, 0xED, 0x00, 0x00, 0x20,
+    0x62, 0x91, 0x00, 0x00, 0x90, 0x00, 0x00, 0x05, 0x20, 0x82, 0x00, 0x00, 0x61, 0x87, 0xFC, 0x54,
+    0xFC, 0x54, 0xFC, 0x53, 0x83, 0xFC, 0x54, 0x00, 0xFC, 0x53, 0x83, 0xFC, 0x54, 0x81, 0xFC, 0x53,
+    0x81, 0xFC, 0x54, 0x0B, 0xFC, 0x53, 0xFC, 0x54, 0xFC, 0x53, 0xFC, 0x54, 0xFC, 0x53, 0xFC, 0x74,
+    0xEC, 0x12, 0x09, 0x04, 0x00, 0x00, 0xC6, 0x59, 0xF7, 0xDF, 0xE7, 0x7E, 0x83, 0xEF, 0x9E, 0x07,
+    0xE7, 0x7E, 0xF7, 0xDF, 0xC6, 0x7A, 0x00, 0x00, 0x00, 0xC2, 0xEB, 0xF2, 0xFC, 0x74, 0xFC, 0x53,
+    0x86, 0xFC, 0x54, 0x82, 0xFC, 0x53, 0x84, 0xFC, 0x54, 0x81, 0xFC, 0x53, 0x8D, 0xFC, 0x54, 0x00,
+    0xFC, 0x53, 0x87, 0xFC, 0x54, 0x81, 0xFC, 0x53, 0x03, 0xFC, 0x54, 0xFC, 0x53, 0xFC, 0x54, 0xFC,
+    0x53, 0x85, 0xFC, 0x54, 0x07, 0xFC, 0x53, 0xFC, 0x54, 0xFC, 0x53, 0xFC, 0x54, 0xFC, 0x53, 0xFC,
+    0x54, 0xFC, 0x54, 0xFC, 0x53, 0x82, 0xFC, 0x54, 0x00, 0xFC, 0x53, 0x87, 0xFC, 0x54, 0x00, 0xFC,
+    0x53, 0x88, 0xFC, 0x54, 0x00, 0xFC, 0x53, 0x83, 0xFC, 0x54, 0x07, 0xFC, 0x53, 0xFC, 0x54, 0xFC,
+    0x53, 0xFC, 0x74, 0xFC, 0x54, 0x61, 0xA7, 0x00, 0x00, 0x28, 0x82, 0x90, 0x00, 0x00, 0x90, 0x00,
+    0x00, 0x04, 0x28, 0xA3, 0x00, 0x00, 0xB2, 0xED, 0xFC, 0x74, 0xFC, 0x53, 0x92, 0xFC, 0x54, 0x05,
+    0xFC, 0x53, 0xFC, 0x74, 0x8A, 0x6B, 0x00, 0x00, 0xA5, 0x34, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x06,
+    0xE7, 0x7E, 0xF7, 0xDF, 0xAD, 0x55, 0x00, 0x00, 0x82, 0x4A, 0xFC, 0x74, 0xFC, 0x53, 0xDA, 0xFC,
+    0x54, 0x04, 0xFC, 0x53, 0xFC, 0x74, 0xB3, 0x0E, 0x00, 0x00, 0x28, 0xA3, 0x90, 0x00, 0x00, 0x90,
+    0x00, 0x00, 0x04, 0x28, 0x82, 0x00, 0x00, 0xC3, 0x2F, 0xFC, 0x74, 0xFC, 0x53, 0x92, 0xFC, 0x54,
+    0x05, 0xFC, 0x53, 0xFC, 0x74, 0xA2, 0xCD, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0x84, 0xEF, 0x9E,
+    0x06, 0xE7, 0x7E, 0xF7, 0xDF, 0xA5, 0x14, 0x00, 0x00, 0x92, 0xAC, 0xFC, 0x74, 0xFC, 0x53, 0xDA,
+    0xFC, 0x54, 0x04, 0xFC, 0x53, 0xFC, 0x74, 0xC3, 0x4F, 0x00, 0x00, 0x28, 0x82, 0x90, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x04, 0x28, 0x83, 0x00, 0x00, 0xA2, 0xAC, 0xFC, 0x74, 0xFC, 0x53, 0x92, 0xFC,
+    0x54, 0x05, 0xFC, 0x53, 0xFC, 0x74, 0xA2, 0xED, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0x84, 0xEF,
+    0x9E, 0x05, 0xE7, 0x7E, 0xF7, 0xDF, 0xA5, 0x14, 0x00, 0x00, 0x92, 0xAC, 0xFC, 0x74, 0xDB, 0xFC,
+    0x54, 0x04, 0xFC, 0x53, 0xFC, 0x74, 0xA2, 0xAC, 0x00, 0x00, 0x28, 0xA3, 0x90, 0x00, 0x00, 0x90,
+    0x00, 0x00, 0x06, 0x18, 0x41, 0x00, 0x00, 0x20, 0x62, 0xF4, 0x12, 0xFC, 0x74, 0xFC, 0x53, 0xFC,
+    0x54, 0x91, 0xFC, 0x53, 0x04, 0xFC, 0x74, 0xA2, 0xCD, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0x84,
+    0xEF, 0x9E, 0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0xA5, 0x14, 0x00, 0x00, 0x92, 0xAC, 0xFC, 0x74, 0xD9,
+    0xFC, 0x53, 0x06, 0xFC, 0x54, 0xFC, 0x53, 0xFC, 0x74, 0xF4, 0x13, 0x20, 0x82, 0x00, 0x00, 0x18,
+    0x61, 0x90, 0x00, 0x00, 0x91, 0x00, 0x00, 0x03, 0x18, 0x41, 0x00, 0x00, 0x71, 0xE8, 0xF4, 0x33,
+    0x93, 0xFC, 0x74, 0x04, 0xFC, 0x95, 0xAA, 0xED, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0x84, 0xEF,
+    0x9E, 0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0xA5, 0x34, 0x00, 0x00, 0x9A, 0xCC, 0xFC, 0x95, 0xDB, 0xFC,
+    0x74, 0x03, 0xF4, 0x33, 0x79, 0xE9, 0x00, 0x00, 0x20, 0x61, 0x91, 0x00, 0x00, 0x92, 0x00, 0x00,
+    0x04, 0x18, 0x41, 0x00, 0x00, 0x41, 0x04, 0xB3, 0x0E, 0xDB, 0xB1, 0x91, 0xDB, 0xD1, 0x04, 0xE3,
+    0xF2, 0x8A, 0x8B, 0x00, 0x00, 0x94, 0xB2, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x05, 0xEF, 0x7E, 0xF7,
+    0xDF, 0xA5, 0x14, 0x00, 0x00, 0x82, 0x6A, 0xE3, 0xF2, 0xD9, 0xDB, 0xD1, 0x04, 0xDB, 0xB1, 0xB3,
+    0x0E, 0x41, 0x04, 0x00, 0x00, 0x18, 0x41, 0x92, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x18, 0x41,
+    0x95, 0x00, 0x00, 0x03, 0x00, 0x81, 0x00, 0x00, 0x8C, 0xB2, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x04,
+    0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x14, 0x00, 0x00, 0x00, 0xC2, 0xDD, 0x00, 0x00, 0x00, 0x18, 0x41,
+    0x93, 0x00, 0x00, 0x94, 0x00, 0x00, 0x06, 0x18, 0x41, 0x28, 0x82, 0x18, 0x42, 0x18, 0x41, 0x18,
+    0x00, 0x21, 0x25, 0x29, 0xA7, 0x8D, 0x29, 0x87, 0x04, 0x29, 0xA7, 0x21, 0x66, 0x00, 0x00, 0x94,
+    0xB2, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x04, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x14, 0x00, 0x00, 0x29,
+    0x45, 0xD6, 0x29, 0x87, 0x06, 0x29, 0xA7, 0x21, 0x25, 0x18, 0x00, 0x18, 0x41, 0x18, 0x41, 0x28,
+    0x82, 0x18, 0x41, 0x94, 0x00, 0x00, 0x97, 0x00, 0x00, 0x04, 0x11, 0x05, 0x00, 0x00, 0x5C, 0xB5,
+    0x86, 0x9E, 0x7E, 0x5D, 0x8B, 0x86, 0x7D, 0x05, 0x7E, 0x5D, 0x86, 0x9E, 0x54, 0x12, 0x00, 0x00,
+    0x94, 0xB3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x06, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00,
+    0x4B, 0xB1, 0x86, 0x9E, 0x86, 0x5D, 0xD3, 0x86, 0x7D, 0x04, 0x7E, 0x5D, 0x86, 0x9E, 0x5C, 0x95,
+    0x00, 0x00, 0x11, 0x05, 0x97, 0x00, 0x00, 0x97, 0x00, 0x00, 0x03, 0x11, 0x05, 0x00, 0x00, 0x4B,
+    0xD1, 0x8E, 0xDF, 0x8C, 0x86, 0xBF, 0x05, 0x86, 0xBE, 0x8E, 0xFF, 0x5C, 0x53, 0x00, 0x00, 0x94,
+    0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53,
+    0xF2, 0x8E, 0xDF, 0xD5, 0x86, 0xBF, 0x03, 0x8E, 0xDF, 0x4B, 0xD1, 0x00, 0x00, 0x11, 0x04, 0x97,
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x03, 0x08, 0xC4, 0x00, 0x00, 0x2A, 0x2A, 0x86, 0x7E, 0x8D, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x05,
+    0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x87, 0x86, 0x9E, 0x00,
+    0x86, 0xBE, 0xCC, 0x86, 0x9E, 0x03, 0x86, 0x7E, 0x2A, 0x2A, 0x00, 0x00, 0x08, 0xC4, 0x97, 0x00,
+    0x00, 0x97, 0x00, 0x00, 0x04, 0x00, 0x62, 0x00, 0x21, 0x00, 0x00, 0x7E, 0x1C, 0x8E, 0xDF, 0x8C,
+    0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E,
+    0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x84, 0x86, 0x9E,
+    0x06, 0x86, 0xBF, 0x8E, 0xDF, 0x86, 0x9E, 0x86, 0x5D, 0x86, 0x7E, 0x86, 0xBF, 0x8E, 0xDF, 0xC8,
+    0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x7E, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x00, 0x62, 0x97, 0x00, 0x00,
+    0x97, 0x00, 0x00, 0x04, 0x00, 0xA2, 0x08, 0xC4, 0x00, 0x00, 0x6D, 0x58, 0x8E, 0xDF, 0x8C, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x05,
+    0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x83, 0x86, 0x9E, 0x08,
+    0x86, 0xBF, 0x86, 0x7D, 0x5C, 0x95, 0x43, 0x0E, 0x2A, 0x09, 0x3A, 0x8B, 0x4B, 0xB1, 0x75, 0xBA,
+    0x8E, 0xBF, 0xC7, 0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x6D, 0x58, 0x00, 0x00, 0x08, 0xC4, 0x00, 0xA2,
+    0x97, 0x00, 0x00, 0x98, 0x00, 0x00, 0x03, 0x11, 0x05, 0x00, 0x00, 0x54, 0x74, 0x8E, 0xDF, 0x8C,
+    0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E,
+    0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x82, 0x86, 0x9E,
+    0x02, 0x86, 0xBF, 0x7E, 0x1C, 0x2A, 0x2A, 0x85, 0x00, 0x00, 0x01, 0x5C, 0x95, 0x86, 0xBF, 0xC6,
+    0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x54, 0x74, 0x00, 0x00, 0x11, 0x05, 0x98, 0x00, 0x00, 0x98, 0x00,
+    0x00, 0x03, 0x11, 0x25, 0x00, 0x00, 0x3B, 0x2E, 0x86, 0xBE, 0x8C, 0x86, 0x9E, 0x04, 0x8E, 0xDF,
+    0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x14, 0xEF, 0x7E, 0xF7, 0xDF,
+    0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x86, 0x9E, 0x86, 0x9E, 0x86, 0xBE, 0x86, 0x7E,
+    0x2A, 0x4A, 0x00, 0x00, 0x00, 0xA4, 0x9D, 0x14, 0xC6, 0x59, 0xB5, 0xF7, 0x6B, 0x6E, 0x00, 0x00,
+    0x00, 0x00, 0x65, 0x37, 0x8E, 0xDF, 0xC5, 0x86, 0x9E, 0x03, 0x86, 0xBE, 0x3B, 0x0E, 0x00, 0x00,
+    0x11, 0x25, 0x98, 0x00, 0x00, 0x98, 0x00, 0x00, 0x04, 0x11, 0x05, 0x00, 0x00, 0x19, 0x67, 0x86,
+    0x5D, 0x86, 0xBF, 0x8B, 0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7,
+    0xDF, 0x84, 0xEF, 0x9E, 0x0C, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86,
+    0xBF, 0x86, 0x9E, 0x86, 0x9E, 0x8E, 0xDF, 0x64, 0xD6, 0x00, 0x00, 0x00, 0x02, 0xC6, 0x79, 0x82,
+    0xF7, 0xDF, 0x05, 0xEF, 0xBE, 0x84, 0x31, 0x00, 0x00, 0x29, 0xE9, 0x86, 0x7D, 0x86, 0xBE, 0xC3,
+    0x86, 0x9E, 0x04, 0x86, 0xBF, 0x86, 0x5D, 0x19, 0x66, 0x00, 0x00, 0x11, 0x05, 0x98, 0x00, 0x00,
+    0x98, 0x00, 0x00, 0x04, 0x08, 0x82, 0x00, 0x83, 0x00, 0x00, 0x75, 0xDB, 0x8E, 0xDF, 0x8B, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x15,
+    0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x86, 0x9E, 0x86, 0x9E,
+    0x86, 0xBE, 0x43, 0x4F, 0x00, 0x00, 0x94, 0xD3, 0xF7, 0xDF, 0xE7, 0x7E, 0xEF, 0x9E, 0xE7, 0x7D,
+    0xF7, 0xDF, 0xDF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x75, 0xBA, 0x8E, 0xDF, 0x8B, 0x86, 0x9E, 0x01,
+    0x86, 0xBE, 0x86, 0xBF, 0x82, 0x8E, 0xDF, 0x00, 0x86, 0xBF, 0xB1, 0x86, 0x9E, 0x04, 0x8E, 0xDF,
+    0x75, 0xDA, 0x00, 0x00, 0x08, 0xA3, 0x08, 0x82, 0x98, 0x00, 0x00, 0x99, 0x00, 0x00, 0x03, 0x11,
+    0x05, 0x00, 0x00, 0x64, 0xF7, 0x8E, 0xDF, 0x8B, 0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x33, 0x00,
+    0x00, 0x94, 0xD3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x05, 0xEF, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00,
+    0x00, 0x53, 0xF2, 0x86, 0xBF, 0x82, 0x86, 0x9E, 0x04, 0x43, 0x2E, 0x00, 0x00, 0xB5, 0xF7, 0xF7,
+    0xDF, 0xE7, 0x7E, 0x82, 0xEF, 0x9E, 0x04, 0xE7, 0x7D, 0x4A, 0xAA, 0x00, 0x00, 0x6D, 0x37, 0x8E,
+    0xDF, 0x89, 0x86, 0x9E, 0x0A, 0x86, 0xBF, 0x8E, 0xDF, 0x86, 0x9E, 0x7E, 0x1C, 0x75, 0x99, 0x6D,
+    0x78, 0x75, 0xBA, 0x7E, 0x3C, 0x86, 0x9E, 0x8E, 0xDF, 0x86, 0xBE, 0xAE, 0x86, 0x9E, 0x03, 0x8E,
+    0xDF, 0x64, 0xF7, 0x00, 0x00, 0x11, 0x05, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x03, 0x11, 0x05,
+    0x00, 0x00, 0x4B, 0xF2, 0x8E, 0xDF, 0x8B, 0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x54, 0x53, 0x00, 0x00,
+    0x94, 0xB3, 0xF7, 0xDF, 0x84, 0xEF, 0x9E, 0x15, 0xE7, 0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00,
+    0x53, 0xF2, 0x86, 0xBF, 0x86, 0x9E, 0x86, 0x9E, 0x86, 0xBE, 0x43, 0x0E, 0x00, 0x00, 0xA5, 0x55,
+    0xF7, 0xDF, 0xE7, 0x7D, 0xEF, 0x9E, 0xE7, 0x7D, 0xEF, 0xBE, 0xE7, 0x5D, 0x21, 0x45, 0x00, 0x00,
+    0x6D, 0x99, 0x8E, 0xDF, 0x88, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x7E, 0x3C, 0x5C, 0x74, 0x32, 0x6A,
+    0x83, 0x00, 0x00, 0x04, 0x10, 0x00, 0x42, 0xED, 0x64, 0xF6, 0x86, 0x7D, 0x8E, 0xDF, 0xAD, 0x86,
+    0x9E, 0x03, 0x8E, 0xDF, 0x4B, 0xD2, 0x00, 0x00, 0x11, 0x05, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00,
+    0x04, 0x08, 0xC4, 0x00, 0x00, 0x2A, 0x6B, 0x86, 0x9E, 0x86, 0xBE, 0x8A, 0x86, 0x9E, 0x05, 0x8E,
+    0xDF, 0x54, 0x33, 0x00, 0x00, 0x94, 0xB3, 0xEF, 0xBF, 0xE7, 0x7E, 0x83, 0xEF, 0x9E, 0x15, 0xE7,
+    0x7E, 0xF7, 0xDF, 0x9D, 0x34, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x86, 0x9E, 0x86, 0x9E, 0x8E,
+    0xDF, 0x54, 0x54, 0x00, 0x00, 0x3A, 0x29, 0xE7, 0x5D, 0xF7, 0xFF, 0xEF, 0xBE, 0xEF, 0xBF, 0xF7,
+    0xFF, 0xA5, 0x55, 0x00, 0x00, 0x18, 0xE3, 0x7E, 0x5D, 0x86, 0xBF, 0x86, 0x86, 0x9E, 0x09, 0x86,
+    0xBE, 0x86, 0xBF, 0x64, 0xF6, 0x20, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0x63, 0x62,
+    0xC4, 0x42, 0x03, 0x82, 0x00, 0x00, 0x02, 0x32, 0x08, 0x6D, 0x9A, 0x8E, 0xDF, 0xAB, 0x86, 0x9E,
+    0x04, 0x86, 0xBE, 0x86, 0x9E, 0x2A, 0x6B, 0x00, 0x00, 0x08, 0xC4, 0x99, 0x00, 0x00, 0x99, 0x00,
+    0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x1C, 0x8E, 0xBF, 0x8A, 0x86, 0x9E, 0x04,
+    0x8E, 0xDF, 0x5C, 0x74, 0x00, 0x00, 0x84, 0x72, 0xEF, 0xBF, 0x85, 0xEF, 0x9E, 0x13, 0xF7, 0xDF,
+    0x94, 0xF4, 0x00, 0x00, 0x54, 0x33, 0x8E, 0xDF, 0x86, 0x9E, 0x86, 0x9E, 0x86, 0xBF, 0x7E, 0x3C,
+    0x08, 0x00, 0x00, 0x00, 0x5B, 0x0C, 0xCE, 0x7A, 0xDF, 0x3C, 0xDF, 0x1C, 0x9D, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0x54, 0x8E, 0xDF, 0x87, 0x86, 0x9E, 0x10, 0x86, 0xBE, 0x4B, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x52, 0x84, 0xBD, 0x63, 0xE6, 0x61, 0xF6, 0xE0, 0xFF, 0x00, 0xF6, 0xC0, 0xE6, 0x41,
+    0xAC, 0xE3, 0x29, 0x64, 0x00, 0x00, 0x00, 0x00, 0x64, 0xF7, 0x8E, 0xDF, 0xAA, 0x86, 0x9E, 0x04,
+    0x8E, 0xDF, 0x7E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x99, 0x00, 0x00, 0x9A, 0x00, 0x00,
+    0x03, 0x08, 0xC3, 0x00, 0x00, 0x6D, 0x79, 0x8E, 0xDF, 0x8A, 0x86, 0x9E, 0x06, 0x8E, 0xDF, 0x6D,
+    0x58, 0x00, 0x00, 0x3A, 0x28, 0xE7, 0x7D, 0xEF, 0xBE, 0xE7, 0x7E, 0x84, 0xEF, 0x9E, 0x03, 0x5B,
+    0x0C, 0x00, 0x00, 0x64, 0xF6, 0x8E, 0xDF, 0x82, 0x86, 0x9E, 0x01, 0x8E, 0xDF, 0x6D, 0x79, 0x82,
+    0x00, 0x00, 0x00, 0x21, 0x25, 0x82, 0x00, 0x00, 0x02, 0x3B, 0x2F, 0x86, 0x9E, 0x86, 0xBE, 0x86,
+    0x86, 0x9E, 0x12, 0x8E, 0xDF, 0x54, 0x53, 0x00, 0x00, 0x00, 0x05, 0xA4, 0xA2, 0xF6, 0xE0, 0xFF,
+    0x41, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x01, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x41, 0xEE, 0xA0, 0x7B,
+    0x83, 0x00, 0x03, 0x00, 0x00, 0x6D, 0x58, 0x8E, 0xDF, 0xA9, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x6D,
+    0x79, 0x00, 0x00, 0x08, 0xC3, 0x9A, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x03, 0x11, 0x05, 0x00, 0x00,
+    0x5C, 0x95, 0x8E, 0xDF, 0x8A, 0x86, 0x9E, 0x05, 0x86, 0xBF, 0x7E, 0x5D, 0x21, 0x66, 0x00, 0x00,
+    0xA5, 0x55, 0xF7, 0xDF, 0x83, 0xEF, 0x9E, 0x05, 0xF7, 0xFF, 0xB5, 0xD7, 0x00, 0x00, 0x08, 0x00,
+    0x7E, 0x1C, 0x8E, 0xDF, 0x83, 0x86, 0x9E, 0x09, 0x8E, 0xDF, 0x75, 0xDA, 0x43, 0x0E, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0xC8, 0x5C, 0x95, 0x86, 0x9E, 0x86, 0xBF, 0x86, 0x86, 0x9E, 0x14,
+    0x8E, 0xDF, 0x6D, 0x99, 0x00, 0x00, 0x00, 0x04, 0xB5, 0x01, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x21,
+    0xF6, 0xE1, 0xFF, 0x21, 0xFF, 0x21, 0xF7, 0x01, 0xFF, 0x01, 0xF6, 0xE1, 0xFF, 0x21, 0xFF, 0x20,
+    0x83, 0xA2, 0x00, 0x00, 0x20, 0xE0, 0x7E, 0x3C, 0x86, 0xBF, 0xA8, 0x86, 0x9E, 0x03, 0x8E, 0xDF,
+    0x5C, 0x74, 0x00, 0x00, 0x11, 0x05, 0x9A, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x03, 0x11, 0x25, 0x00,
+    0x00, 0x3B, 0x4F, 0x86, 0xBF, 0x8B, 0x86, 0x9E, 0x0D, 0x8E, 0xDF, 0x5C, 0xB5, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0x76, 0xEF, 0x9E, 0xEF, 0xBF, 0xEF, 0xBE, 0xEF, 0x9E, 0xB5, 0xD7, 0x00, 0x02, 0x00,
+    0x00, 0x54, 0x33, 0x8E, 0xDF, 0x85, 0x86, 0x9E, 0x07, 0x8E, 0xDF, 0x86, 0xBE, 0x7E, 0x1C, 0x75,
+    0xFB, 0x75, 0xFB, 0x86, 0x5D, 0x8E, 0xDF, 0x86, 0xBE, 0x88, 0x86, 0x9E, 0x13, 0x3A, 0xAC, 0x00,
+    0x00, 0x8C, 0x03, 0xFF, 0x20, 0xFF, 0x21, 0xF6, 0xE1, 0x9C, 0x60, 0x52, 0x40, 0x83, 0xC0, 0xEE,
+    0xA1, 0xFF, 0x21, 0xFF, 0x01, 0xFF, 0x01, 0xF6, 0xE1, 0xFF, 0x21, 0xF6, 0xE0, 0x4A, 0x64, 0x00,
+    0x00, 0x54, 0x33, 0x8E, 0xDF, 0xA8, 0x86, 0x9E, 0x03, 0x86, 0xBF, 0x3B, 0x2F, 0x00, 0x00, 0x11,
+    0x25, 0x9A, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x04, 0x11, 0x05, 0x00, 0x00, 0x19, 0xA8, 0x86, 0x7D,
+    0x86, 0xBF, 0x8C, 0x86, 0x9E, 0x0B, 0x43, 0x90, 0x00, 0x00, 0x00, 0x00, 0x52, 0xEB, 0x8C, 0x92,
+    0x8C, 0x92, 0x5B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xED, 0x86, 0x7E, 0x86, 0xBE, 0x87, 0x86,
+    0x9E, 0x82, 0x8E, 0xDF, 0x00, 0x86, 0xBF, 0x88, 0x86, 0x9E, 0x0C, 0x8E, 0xDF, 0x75, 0xBA, 0x00,
+    0x00, 0x00, 0x04, 0xE6, 0x80, 0xFF, 0x21, 0xFF, 0x21, 0xA4, 0xA0, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x7B, 0x80, 0xFF, 0x21, 0x82, 0xFF, 0x01, 0x06, 0xF6, 0xE1, 0xFF, 0x41, 0xCD, 0xA2, 0x00,
+    0x00, 0x29, 0x64, 0x7E, 0x5D, 0x86, 0xBF, 0xA6, 0x86, 0x9E, 0x04, 0x86, 0xBF, 0x86, 0x7D, 0x19,
+    0xA7, 0x00, 0x00, 0x11, 0x05, 0x9A, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x04, 0x08, 0xA2, 0x00, 0x82,
+    0x00, 0x00, 0x75, 0xFB, 0x8E, 0xDF, 0x8B, 0x86, 0x9E, 0x03, 0x86, 0xBE, 0x86, 0x9E, 0x5C, 0x74,
+    0x10, 0x00, 0x83, 0x00, 0x00, 0x03, 0x10, 0x00, 0x54, 0x33, 0x86, 0x7E, 0x86, 0xBF, 0x95, 0x86,
+    0x9E, 0x0D, 0x8E, 0xDF, 0x5C, 0x74, 0x00, 0x00, 0x83, 0xC4, 0xFF, 0x20, 0xFF, 0x01, 0xFF, 0x01,
+    0x62, 0xE0, 0x00, 0x00, 0x29, 0x20, 0x21, 0x00, 0x20, 0xE0, 0xF6, 0xC1, 0xFF, 0x21, 0x82, 0xFF,
+    0x01, 0x05, 0xFF, 0x21, 0xF6, 0xE1, 0x42, 0x04, 0x00, 0x00, 0x6D, 0x78, 0x8E, 0xDF, 0xA6, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x75, 0xDB, 0x00, 0x00, 0x00, 0x82, 0x08, 0xA2, 0x9A, 0x00, 0x00, 0x9B,
+    0x00, 0x00, 0x03, 0x11, 0x05, 0x00, 0x00, 0x65, 0x17, 0x8E, 0xDF, 0x8C, 0x86, 0x9E, 0x09, 0x86,
+    0xBE, 0x8E, 0xDF, 0x7E, 0x3C, 0x64, 0xF6, 0x5C, 0x74, 0x5C, 0x74, 0x65, 0x17, 0x7E, 0x1C, 0x8E,
+    0xDF, 0x86, 0xBE, 0x96, 0x86, 0x9E, 0x0B, 0x86, 0xBF, 0x4B, 0x8F, 0x00, 0x00, 0xB5, 0x23, 0xFF,
+    0x41, 0xF6, 0xE1, 0xFF, 0x41, 0xA4, 0x80, 0x00, 0x00, 0x10, 0x60, 0x00, 0x00, 0x7B, 0x60, 0x85,
+    0xFF, 0x01, 0x04, 0xFF, 0x21, 0x83, 0xE4, 0x00, 0x00, 0x64, 0xB5, 0x8E, 0xDF, 0xA6, 0x86, 0x9E,
+    0x03, 0x8E, 0xDF, 0x65, 0x17, 0x00, 0x00, 0x11, 0x05, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x03,
+    0x11, 0x25, 0x00, 0x00, 0x4B, 0xF2, 0x8E, 0xDF, 0x8E, 0x86, 0x9E, 0x00, 0x86, 0xBF, 0x83, 0x8E,
+    0xDF, 0x00, 0x86, 0xBF, 0x97, 0x86, 0x9E, 0x0E, 0x86, 0xBE, 0x86, 0x9E, 0x3A, 0xAB, 0x00, 0x00,
+    0xCD, 0xC3, 0xFF, 0x21, 0xF6, 0xE1, 0xFF, 0x21, 0xF6, 0xE1, 0x9C, 0x40, 0x4A, 0x00, 0x83, 0xA0,
+    0xEE, 0xA1, 0xFF, 0x21, 0xF7, 0x01, 0x83, 0xFF, 0x01, 0x04, 0xFF, 0x40, 0xA4, 0xA4, 0x00, 0x00,
+    0x54, 0x12, 0x8E, 0xDF, 0xA6, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x4B, 0xF2, 0x00, 0x00, 0x11, 0x05,
+    0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x02, 0x08, 0xE4, 0x00, 0x00, 0x32, 0x8C, 0xAF, 0x86, 0x9E,
+    0x0A, 0x42, 0xED, 0x00, 0x00, 0xCD, 0xC3, 0xFF, 0x61, 0xF6, 0xE1, 0xFF, 0x01, 0xFF, 0x21, 0xFF,
+    0x21, 0xF6, 0xE1, 0xFF, 0x21, 0xFF, 0x21, 0x84, 0xFF, 0x01, 0x05, 0xF7, 0x01, 0xFF, 0x40, 0xAC,
+    0xC4, 0x00, 0x00, 0x53, 0xF1, 0x86, 0xBF, 0xA7, 0x86, 0x9E, 0x02, 0x32, 0x8B, 0x00, 0x00, 0x08,
+    0xC4, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x04, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3C,
+    0x86, 0xBF, 0xAB, 0x86, 0x9E, 0x08, 0x8E, 0xDF, 0x86, 0x9E, 0x3A, 0xEC, 0x00, 0x00, 0x83, 0xA3,
+    0xF6, 0xE1, 0xFF, 0x41, 0xFF, 0x01, 0xF6, 0xE1, 0x88, 0xFF, 0x01, 0x05, 0xF7, 0x01, 0xFF, 0x40,
+    0xA4, 0xC4, 0x00, 0x00, 0x53, 0xF1, 0x86, 0xBF, 0xA5, 0x86, 0x9E, 0x04, 0x86, 0xBF, 0x7E, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x9B, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x03, 0x08, 0xC3, 0x00,
+    0x00, 0x6D, 0x99, 0x8E, 0xDF, 0xA9, 0x86, 0x9E, 0x0B, 0x86, 0xBE, 0x8E, 0xDF, 0x75, 0xDB, 0x3A,
+    0xCC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x4A, 0x00, 0xCD, 0xC0, 0xFF, 0x21, 0xFF, 0x21, 0xF6,
+    0xE1, 0x87, 0xFF, 0x01, 0x05, 0xF7, 0x01, 0xFF, 0x40, 0xAC, 0xC4, 0x00, 0x00, 0x53, 0xF1, 0x86,
+    0xBF, 0xA5, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x6D, 0x99, 0x00, 0x00, 0x08, 0xC3, 0x9C, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0x03, 0x11, 0x05, 0x00, 0x00, 0x5C, 0x95, 0x8E, 0xDF, 0xA8, 0x86, 0x9E, 0x0C,
+    0x8E, 0xDF, 0x86, 0x7E, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9C, 0x40, 0x49, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x8C, 0x00, 0xEE, 0xA1, 0xFF, 0x21, 0x87, 0xFF, 0x01, 0x05, 0xF7, 0x01,
+    0xFF, 0x40, 0xAC, 0xC4, 0x00, 0x00, 0x53, 0xF1, 0x86, 0xBF, 0xA5, 0x86, 0x9E, 0x03, 0x8E, 0xDF,
+    0x5C, 0x95, 0x00, 0x00, 0x11, 0x05, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x03, 0x11, 0x25, 0x00,
+    0x00, 0x43, 0x6F, 0x86, 0xBF, 0xA7, 0x86, 0x9E, 0x0E, 0x86, 0xBF, 0x75, 0xDB, 0x21, 0xE9, 0x00,
+    0x00, 0x00, 0x02, 0x7B, 0x63, 0xDE, 0x40, 0xFF, 0x41, 0xEE, 0x81, 0x8C, 0x00, 0x10, 0x80, 0x00,
+    0x00, 0x18, 0xA0, 0xCD, 0xC0, 0xFF, 0x21, 0x86, 0xFF, 0x01, 0x05, 0xF7, 0x01, 0xFF, 0x40, 0xAC,
+    0xC4, 0x00, 0x00, 0x53, 0xF1, 0x86, 0xBF, 0xA5, 0x86, 0x9E, 0x03, 0x86, 0xBF, 0x43, 0x6F, 0x00,
+    0x00, 0x11, 0x05, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x11, 0x25, 0x00, 0x00, 0x21, 0xE8,
+    0x86, 0x7D, 0x86, 0xBE, 0x8C, 0x86, 0x9E, 0x81, 0x8E, 0xDF, 0x04, 0x8E, 0xBF, 0x86, 0xBF, 0x8E,
+    0xDF, 0x8E, 0xDF, 0x86, 0xBF, 0x92, 0x86, 0x9E, 0x0D, 0x8E, 0xDF, 0x3B, 0x2E, 0x00, 0x00, 0x00,
+    0xC8, 0x83, 0xA0, 0xFF, 0x20, 0xFF, 0x61, 0xFF, 0x21, 0xFF, 0x61, 0xFF, 0x40, 0x9C, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0x40, 0x87, 0xFF, 0x01, 0x05, 0xF7, 0x01, 0xFF, 0x40, 0xA4, 0xC4, 0x00,
+    0x00, 0x53, 0xF1, 0x8E, 0xBF, 0xA4, 0x86, 0x9E, 0x04, 0x86, 0xBE, 0x86, 0x7D, 0x21, 0xC8, 0x00,
+    0x00, 0x11, 0x25, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x04, 0x08, 0xA3, 0x00, 0x62, 0x00, 0x00,
+    0x75, 0xFB, 0x8E, 0xDF, 0x8A, 0x86, 0x9E, 0x81, 0x86, 0xBF, 0x07, 0x75, 0xDA, 0x5C, 0x94, 0x53,
+    0xF2, 0x4B, 0xD1, 0x54, 0x33, 0x65, 0x17, 0x7E, 0x5D, 0x8E, 0xDF, 0x91, 0x86, 0x9E, 0x0E, 0x86,
+    0xBF, 0x75, 0xDB, 0x11, 0x05, 0x00, 0x00, 0x19, 0x03, 0x6B, 0x24, 0x9C, 0x84, 0xB5, 0x04, 0xA4,
+    0xA4, 0x73, 0x64, 0x29, 0x41, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xC0, 0xFF, 0x21, 0x86, 0xFF, 0x01,
+    0x05, 0xF6, 0xE1, 0xFF, 0x20, 0xAC, 0xC4, 0x00, 0x00, 0x54, 0x12, 0x8E, 0xDF, 0xA4, 0x86, 0x9E,
+    0x04, 0x8E, 0xDF, 0x75, 0xFB, 0x00, 0x00, 0x00, 0x62, 0x08, 0xA3, 0x9C, 0x00, 0x00, 0x9D, 0x00,
+    0x00, 0x03, 0x08, 0xE4, 0x00, 0x00, 0x65, 0x38, 0x8E, 0xDF, 0x89, 0x86, 0x9E, 0x02, 0x8E, 0xDF,
+    0x7E, 0x5D, 0x43, 0x90, 0x85, 0x00, 0x00, 0x03, 0x21, 0x45, 0x64, 0xD6, 0x86, 0xBE, 0x86, 0xBE,
+    0x90, 0x86, 0x9E, 0x02, 0x8E, 0xDF, 0x7E, 0x3C, 0x43, 0x90, 0x86, 0x00, 0x00, 0x03, 0x00, 0x01,
+    0xDE, 0x20, 0xFF, 0x41, 0xF6, 0xE1, 0x85, 0xFF, 0x01, 0x09, 0xF6, 0xE1, 0xFF, 0x21, 0xFF, 0x81,
+    0xAC, 0xC4, 0x00, 0x00, 0x53, 0xB0, 0x86, 0x9E, 0x86, 0xBE, 0x8E, 0xDF, 0x86, 0xBF, 0xA1, 0x86,
+    0x9E, 0x03, 0x8E, 0xDF, 0x65, 0x37, 0x00, 0x00, 0x08, 0xE4, 0x9D, 0x00, 0x00, 0x9D, 0x00, 0x00,
+    0x03, 0x11, 0x25, 0x00, 0x00, 0x54, 0x13, 0x8E, 0xDF, 0x88, 0x86, 0x9E, 0x0D, 0x86, 0xBF, 0x7E,
+    0x1C, 0x21, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x63, 0x4D, 0x94, 0xF4, 0x9D, 0x34, 0x8C, 0x92, 0x31,
+    0xA7, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xF2, 0x86, 0xBE, 0x91, 0x86, 0x9E, 0x81, 0x86, 0xBF, 0x0A,
+    0x75, 0xFB, 0x64, 0xB5, 0x53, 0xF1, 0x4B, 0x8F, 0x53, 0xF1, 0x64, 0xB5, 0x21, 0xA7, 0x00, 0x00,
+    0xA4, 0x82, 0xFF, 0x21, 0xFF, 0x21, 0x85, 0xFF, 0x01, 0x0A, 0xFF, 0x41, 0xEE, 0xA1, 0xB4, 0xE0,
+    0x52, 0x60, 0x00, 0x00, 0x18, 0xC2, 0x29, 0xC7, 0x43, 0x4E, 0x65, 0x17, 0x86, 0x7D, 0x8E, 0xDF,
+    0xA0, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x54, 0x13, 0x00, 0x00, 0x11, 0x25, 0x9D, 0x00, 0x00, 0x9D,
+    0x00, 0x00, 0x02, 0x08, 0xC4, 0x00, 0x00, 0x32, 0xAC, 0x88, 0x86, 0x9E, 0x0F, 0x86, 0xBE, 0x86,
+    0x9E, 0x32, 0x6B, 0x00, 0x00, 0x00, 0xE5, 0xBE, 0x18, 0xEF, 0xBE, 0xF7, 0xDF, 0xEF, 0xBF, 0xF7,
+    0xDF, 0xE7, 0x5D, 0x8C, 0x92, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xD6, 0x8E, 0xDF, 0x92, 0x86, 0x9E,
+    0x81, 0x8E, 0xDF, 0x08, 0x86, 0xDF, 0x86, 0xBF, 0x86, 0xBF, 0x8E, 0xFF, 0x65, 0x37, 0x00, 0x00,
+    0x00, 0x03, 0x83, 0xC0, 0xEE, 0xA1, 0x83, 0xFF, 0x01, 0x81, 0xFF, 0x21, 0x01, 0xBD, 0x40, 0x21,
+    0x00, 0x86, 0x00, 0x00, 0x03, 0x31, 0xE7, 0x65, 0x17, 0x86, 0xBE, 0x8E, 0xDF, 0x9F, 0x86, 0x9E,
+    0x02, 0x32, 0xAC, 0x00, 0x00, 0x08, 0xC4, 0x9D, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x04, 0x08, 0x83,
+    0x00, 0x00, 0x08, 0x83, 0x7E, 0x3C, 0x86, 0xBF, 0x86, 0x86, 0x9E, 0x10, 0x8E, 0xDF, 0x5C, 0xD6,
+    0x00, 0x00, 0x00, 0x00, 0xCE, 0x7A, 0xF7, 0xFF, 0xEF, 0x9E, 0xE7, 0x7E, 0xEF, 0x7E, 0xEF, 0x9E,
+    0xEF, 0xBF, 0xF7, 0xDF, 0x94, 0xB2, 0x00, 0x00, 0x18, 0x80, 0x7E, 0x3C, 0x86, 0xBF, 0x96, 0x86,
+    0x9E, 0x1A, 0x8E, 0xDF, 0x86, 0xBF, 0x43, 0x4F, 0x28, 0x20, 0x00, 0x03, 0x39, 0xA0, 0xF6, 0xE1,
+    0xFF, 0x01, 0xF7, 0x01, 0xFF, 0x21, 0xFF, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xA0,
+    0xBD, 0x40, 0xDE, 0x20, 0xE6, 0x61, 0xD6, 0x02, 0xA4, 0xC3, 0x31, 0xA4, 0x00, 0x00, 0x00, 0x00,
+    0x43, 0x2E, 0x7D, 0xFB, 0x8E, 0xDF, 0x86, 0xBE, 0x9B, 0x86, 0x9E, 0x04, 0x86, 0xBF, 0x7E, 0x3C,
+    0x00, 0x82, 0x00, 0x00, 0x08, 0x82, 0x9D, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x03, 0x08, 0xC3, 0x00,
+    0x00, 0x75, 0x9A, 0x8E, 0xDF, 0x87, 0x86, 0x9E, 0x04, 0x3A, 0x8B, 0x00, 0x00, 0x9D, 0x14, 0xF7,
+    0xDF, 0xE7, 0x7E, 0x83, 0xEF, 0x9E, 0x06, 0xE7, 0x7E, 0xEF, 0xBE, 0xE7, 0x5D, 0x3A, 0x29, 0x00,
+    0x00, 0x5C, 0xD6, 0x8E, 0xDF, 0x94, 0x86, 0x9E, 0x07, 0x86, 0xBE, 0x8E, 0xDF, 0x75, 0xBA, 0x43,
+    0x4E, 0x10, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x94, 0x20, 0x83, 0xFF, 0x01, 0x12, 0x83, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0xAC, 0xC0, 0xFF, 0x01, 0xFF, 0x41, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x41, 0xFF,
+    0x40, 0xEE, 0xA0, 0xA4, 0x83, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x5C, 0xB5, 0x86, 0x9E, 0x8E,
+    0xDF, 0x86, 0xBE, 0x87, 0x86, 0x9E, 0x81, 0x8E, 0xDF, 0x00, 0x86, 0xBF, 0x8E, 0x86, 0x9E, 0x03,
+    0x8E, 0xDF, 0x75, 0x9A, 0x00, 0x00, 0x08, 0xC3, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x03, 0x11,
+    0x04, 0x00, 0x00, 0x5C, 0xB5, 0x8E, 0xDF, 0x85, 0x86, 0x9E, 0x05, 0x8E, 0xDF, 0x7E, 0x1B, 0x08,
+    0x00, 0x00, 0x00, 0xD6, 0xDB, 0xF7, 0xDF, 0x85, 0xEF, 0x9E, 0x05, 0xE7, 0x7E, 0xF7, 0xDF, 0x9C,
+    0xF4, 0x00, 0x00, 0x4B, 0xB0, 0x86, 0xBF, 0x93, 0x86, 0x9E, 0x1F, 0x8E, 0xBF, 0x86, 0x7E, 0x54,
+    0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xE0, 0xDE, 0x20, 0xFF, 0x21, 0xFF, 0x01, 0xFF,
+    0x01, 0xFF, 0x21, 0x9C, 0x60, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x60, 0xFF, 0x41, 0xFF, 0x21, 0xF6,
+    0xE1, 0xFF, 0x01, 0xFF, 0x01, 0xF7, 0x01, 0xF7, 0x01, 0xFF, 0x21, 0xFF, 0x41, 0xDE, 0x20, 0x62,
+    0xE4, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x8A, 0x6D, 0x58, 0x86, 0x9E, 0x82, 0x8E, 0xDF, 0x00, 0x86,
+    0xBF, 0x82, 0x8E, 0xDF, 0x04, 0x86, 0xBF, 0x75, 0xDB, 0x54, 0x33, 0x75, 0xBA, 0x86, 0xBF, 0x8D,
+    0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x5C, 0xB5, 0x00, 0x00, 0x11, 0x05, 0x9E, 0x00, 0x00, 0x9E, 0x00,
+    0x00, 0x03, 0x11, 0x25, 0x00, 0x00, 0x43, 0x90, 0x86, 0xBF, 0x85, 0x86, 0x9E, 0x05, 0x8E, 0xDF,
+    0x75, 0xBA, 0x00, 0x00, 0x31, 0xC7, 0xE7, 0x5D, 0xEF, 0xBE, 0x85, 0xEF, 0x9E, 0x05, 0xEF, 0x7E,
+    0xF7, 0xDF, 0xAD, 0xB6, 0x00, 0x00, 0x43, 0x4F, 0x86, 0xBE, 0x92, 0x86, 0x9E, 0x10, 0x8E, 0xBF,
+    0x7E, 0x3C, 0x32, 0x4A, 0x00, 0x00, 0x00, 0x03, 0x7B, 0x84, 0xDE, 0x41, 0xFF, 0x21, 0xFF, 0x41,
+    0xFF, 0x01, 0xF6, 0xE1, 0xFF, 0x41, 0xC5, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x40, 0xFF, 0x41,
+    0x88, 0xFF, 0x01, 0x12, 0xFF, 0x41, 0xFF, 0x00, 0xB5, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x3A, 0x6A, 0x5C, 0x74, 0x75, 0x99, 0x7E, 0x1B, 0x7E, 0x3C, 0x7E, 0x1C, 0x75, 0xBA, 0x64, 0xF6,
+    0x43, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xED, 0x86, 0xBF, 0x8D, 0x86, 0x9E, 0x03, 0x86, 0xBF,
+    0x43, 0x90, 0x00, 0x00, 0x11, 0x25, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x04, 0x11, 0x25, 0x00,
+    0x00, 0x22, 0x09, 0x86, 0x7D, 0x86, 0xBE, 0x84, 0x86, 0x9E, 0x05, 0x8E, 0xDF, 0x75, 0xDA, 0x00,
+    0x00, 0x19, 0x25, 0xDF, 0x3C, 0xEF, 0xBE, 0x85, 0xEF, 0x9E, 0x05, 0xE7, 0x7D, 0xF7, 0xDF, 0xAD,
+    0x96, 0x00, 0x00, 0x4B, 0x6F, 0x86, 0xBE, 0x91, 0x86, 0x9E, 0x07, 0x86, 0xBF, 0x7E, 0x5D, 0x29,
+    0xC8, 0x00, 0x00, 0x00, 0xC5, 0xC5, 0x80, 0xFF, 0x21, 0xFF, 0x41, 0x82, 0xFF, 0x01, 0x05, 0xFF,
+    0x21, 0xE6, 0x81, 0x10, 0x60, 0x00, 0x00, 0x9C, 0x60, 0xFF, 0x41, 0x8B, 0xFF, 0x01, 0x03, 0xFF,
+    0x41, 0xE6, 0x80, 0x94, 0x22, 0x00, 0x24, 0x83, 0x00, 0x00, 0x00, 0x10, 0xA2, 0x83, 0x00, 0x00,
+    0x03, 0x19, 0x25, 0x00, 0x00, 0x5C, 0xB5, 0x8E, 0xDF, 0x8C, 0x86, 0x9E, 0x04, 0x86, 0xBE, 0x86,
+    0x7D, 0x21, 0xE9, 0x00, 0x00, 0x11, 0x25, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x04, 0x08, 0xC4,
+    0x00, 0x41, 0x00, 0x00, 0x75, 0xFB, 0x8E, 0xDF, 0x84, 0x86, 0x9E, 0x06, 0x86, 0xBF, 0x7E, 0x3D,
+    0x21, 0x66, 0x00, 0x00, 0xC6, 0x59, 0xF7, 0xDF, 0xE7, 0x7E, 0x85, 0xEF, 0x9E, 0x04, 0xEF, 0xBF,
+    0x7C, 0x30, 0x00, 0x00, 0x53, 0xF2, 0x86, 0xBF, 0x91, 0x86, 0x9E, 0x05, 0x86, 0xBF, 0x43, 0x6F,
+    0x00, 0x00, 0x39, 0xE5, 0xE6, 0x60, 0xFF, 0x41, 0x84, 0xFF, 0x01, 0x05, 0xFF, 0x21, 0x7B, 0x80,
+    0x00, 0x00, 0x62, 0xA0, 0xFF, 0x01, 0xFF, 0x21, 0x8B, 0xFF, 0x01, 0x10, 0xF6, 0xE1, 0xFF, 0x21,
+    0xFF, 0x20, 0xE6, 0x80, 0xB5, 0x23, 0x7B, 0x84, 0x39, 0xC3, 0x08, 0xA2, 0x00, 0x00, 0x00, 0x01,
+    0x21, 0x23, 0x7B, 0x64, 0x73, 0x64, 0x00, 0x02, 0x00, 0x00, 0x7E, 0x1C, 0x8E, 0xDF, 0x8C, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x75, 0xFB, 0x00, 0x00, 0x00, 0x41, 0x08, 0xC4, 0x9E, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x03, 0x08, 0xE4, 0x00, 0x00, 0x6D, 0x38, 0x8E, 0xDF, 0x85, 0x86, 0x9E, 0x06, 0x86,
+    0xBF, 0x43, 0x70, 0x00, 0x00, 0x6B, 0x8E, 0xEF, 0xBE, 0xEF, 0xBE, 0xE7, 0x7E, 0x82, 0xEF, 0x9E,
+    0x06, 0xE7, 0x7D, 0xF7, 0xFF, 0xCE, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x59, 0x8E, 0xDF, 0x90,
+    0x86, 0x9E, 0x06, 0x8E, 0xDF, 0x75, 0xBA, 0x00, 0x00, 0x00, 0x04, 0xD6, 0x00, 0xFF, 0x41, 0xF6,
+    0xE1, 0x85, 0xFF, 0x01, 0x04, 0x8B, 0xE0, 0x00, 0x00, 0xDE, 0x40, 0xFF, 0x41, 0xF7, 0x01, 0x8B,
+    0xFF, 0x01, 0x0F, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x01, 0xFF, 0x21, 0xFF, 0x41, 0xFF, 0x21, 0xF6,
+    0xC0, 0xEE, 0x81, 0xE6, 0x61, 0xEE, 0x81, 0xEE, 0xA0, 0xFF, 0x20, 0x8C, 0x04, 0x00, 0x00, 0x4B,
+    0xB0, 0x86, 0xBF, 0x8D, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x65, 0x38, 0x00, 0x00, 0x08, 0xE4, 0x9F,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x03, 0x11, 0x25, 0x00, 0x00, 0x54, 0x33, 0x8E, 0xDF, 0x85, 0x86,
+    0x9E, 0x10, 0x8E, 0xDF, 0x75, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x94, 0xD3, 0xEF, 0xBF, 0xF7, 0xDF,
+    0xEF, 0xBE, 0xEF, 0x9E, 0xEF, 0xBE, 0xF7, 0xDF, 0xDF, 0x1C, 0x42, 0x6A, 0x00, 0x00, 0x32, 0x8C,
+    0x86, 0x9E, 0x86, 0xBE, 0x90, 0x86, 0x9E, 0x04, 0x8E, 0xDF, 0x5C, 0x53, 0x00, 0x00, 0x83, 0xC4,
+    0xFF, 0x20, 0x87, 0xFF, 0x01, 0x01, 0xF6, 0xE1, 0xEE, 0xC1, 0x8E, 0xFF, 0x01, 0x05, 0xAC, 0xE0,
+    0xC5, 0x80, 0xFF, 0x21, 0xF6, 0xE1, 0xF6, 0xE1, 0xFF, 0x01, 0x83, 0xFF, 0x21, 0x05, 0xFF, 0x61,
+    0xDE, 0x21, 0x00, 0x03, 0x00, 0x00, 0x75, 0xBA, 0x8E, 0xDF, 0x8D, 0x86, 0x9E, 0x03, 0x8E, 0xDF,
+    0x54, 0x33, 0x00, 0x00, 0x11, 0x25, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x02, 0x10, 0xE4, 0x00,
+    0x00, 0x32, 0xCD, 0x87, 0x86, 0x9E, 0x0E, 0x86, 0xDF, 0x54, 0x53, 0x00, 0x00, 0x00, 0x00, 0x73,
+    0xCF, 0xCE, 0x9A, 0xE7, 0x5D, 0xE7, 0x7D, 0xDF, 0x1C, 0xB5, 0xD7, 0x29, 0xA7, 0x00, 0x00, 0x00,
+    0x00, 0x75, 0xFB, 0x8E, 0xDF, 0x91, 0x86, 0x9E, 0x05, 0x86, 0xBF, 0x4B, 0x6F, 0x00, 0x00, 0xB5,
+    0x23, 0xFF, 0x41, 0xF7, 0x01, 0x87, 0xFF, 0x01, 0x00, 0xFF, 0x21, 0x8B, 0xFF, 0x01, 0x06, 0xF6,
+    0xE1, 0xFF, 0x41, 0xCD, 0xE0, 0x00, 0x00, 0x39, 0xA0, 0xF6, 0xE1, 0xFF, 0x21, 0x85, 0xFF, 0x01,
+    0x04, 0xFF, 0x21, 0x7B, 0x84, 0x00, 0x00, 0x4B, 0x6F, 0x86, 0xBF, 0x8F, 0x86, 0x9E, 0x02, 0x32,
+    0xCD, 0x00, 0x00, 0x08, 0xE4, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x04, 0x08, 0xA3, 0x00, 0x00,
+    0x10, 0xE4, 0x7E, 0x5D, 0x86, 0xBF, 0x86, 0x86, 0x9E, 0x01, 0x86, 0xBE, 0x54, 0x33, 0x82, 0x00,
+    0x00, 0x07, 0x3A, 0x08, 0x52, 0xCB, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x75, 0xBA,
+    0x8E, 0xDF, 0x91, 0x86, 0x9E, 0x81, 0x86, 0xBE, 0x04, 0x43, 0x0D, 0x00, 0x00, 0xC5, 0x83, 0xFF,
+    0x41, 0xF6, 0xE1, 0x87, 0xFF, 0x01, 0x00, 0xF7, 0x01, 0x8C, 0xFF, 0x01, 0x04, 0xFF, 0x21, 0x73,
+    0x40, 0x00, 0x00, 0x94, 0x40, 0xFF, 0x21, 0x84, 0xFF, 0x01, 0x06, 0xF6, 0xE1, 0xFF, 0x41, 0xCD,
+    0xA0, 0x00, 0x03, 0x10, 0x00, 0x75, 0xDA, 0x8E, 0xDF, 0x8D, 0x86, 0x9E, 0x04, 0x86, 0xBF, 0x7E,
+    0x5D, 0x08, 0xE4, 0x00, 0x00, 0x08, 0xA3, 0x9F, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03, 0x08, 0xC3,
+    0x00, 0x00, 0x75, 0xBA, 0x8E, 0xDF, 0x87, 0x86, 0x9E, 0x03, 0x86, 0xBF, 0x6D, 0x99, 0x3B, 0x0E,
+    0x10, 0x81, 0x82, 0x00, 0x00, 0x03, 0x29, 0xC7, 0x54, 0x13, 0x7E, 0x3C, 0x8E, 0xDF, 0x93, 0x86,
+    0x9E, 0x05, 0x86, 0xBF, 0x4B, 0x6F, 0x00, 0x00, 0xB5, 0x23, 0xFF, 0x41, 0xF6, 0xE1, 0x89, 0xFF,
+    0x01, 0x82, 0xFF, 0x21, 0x01, 0xFF, 0x01, 0xF7, 0x01, 0x83, 0xFF, 0x01, 0x07, 0xF7, 0x01, 0xFF,
+    0x01, 0xFF, 0x41, 0xB5, 0x20, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x40, 0xFF, 0x41, 0x84, 0xFF, 0x01,
+    0x05, 0xFF, 0x21, 0xF6, 0xC0, 0x39, 0xE4, 0x00, 0x00, 0x54, 0x12, 0x8E, 0xDF, 0x8E, 0x86, 0x9E,
+    0x03, 0x8E, 0xDF, 0x75, 0xBA, 0x00, 0x00, 0x08, 0xC3, 0xA0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x03,
+    0x10, 0xE4, 0x00, 0x00, 0x5C, 0xD6, 0x8E, 0xDF, 0x88, 0x86, 0x9E, 0x08, 0x8E, 0xDF, 0x86, 0xBE,
+    0x7E, 0x1C, 0x6D, 0x79, 0x6D, 0x58, 0x75, 0xBA, 0x7E, 0x5D, 0x8E, 0xDF, 0x86, 0xBF, 0x94, 0x86,
+    0x9E, 0x04, 0x8E, 0xDF, 0x5C, 0x53, 0x00, 0x00, 0x8B, 0xE4, 0xFF, 0x20, 0x89, 0xFF, 0x01, 0x10,
+    0xFF, 0x21, 0xEE, 0xA1, 0x83, 0x80, 0xB5, 0x20, 0xFF, 0x41, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x21, 0xFF, 0x41, 0xFF, 0x41, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xC0,
+    0xFF, 0x41, 0x85, 0xFF, 0x01, 0x05, 0xFF, 0x21, 0x8C, 0x03, 0x00, 0x00, 0x29, 0xA6, 0x7E, 0x5D,
+    0x86, 0xBF, 0x8E, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x5C, 0xD6, 0x00, 0x00, 0x10, 0xE4, 0xA0, 0x00,
+    0x00, 0xA0, 0x00, 0x00, 0x03, 0x11, 0x25, 0x00, 0x00, 0x43, 0x70, 0x86, 0xBF, 0x8A, 0x86, 0x9E,
+    0x00, 0x86, 0xBF, 0x82, 0x8E, 0xDF, 0x00, 0x86, 0xBF, 0x96, 0x86, 0x9E, 0x05, 0x8E, 0xDF, 0x6D,
+    0x99, 0x00, 0x00, 0x00, 0x04, 0xE6, 0x80, 0xFF, 0x21, 0x87, 0xFF, 0x01, 0x0F, 0xF6, 0xE1, 0xFF,
+    0x41, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x00, 0xDE, 0x20, 0xF6, 0xC1, 0xFF, 0x01, 0xFF,
+    0x01, 0xEE, 0xA1, 0xD6, 0x00, 0x83, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x83, 0xA0, 0x85, 0xFF, 0x01,
+    0x06, 0xF6, 0xE1, 0xFF, 0x41, 0xBD, 0x20, 0x00, 0x04, 0x00, 0x00, 0x6D, 0x79, 0x8E, 0xDF, 0x8F,
+    0x86, 0x9E, 0x03, 0x86, 0xBF, 0x43, 0x70, 0x00, 0x00, 0x11, 0x25, 0xA0, 0x00, 0x00, 0xA0, 0x00,
+    0x00, 0x04, 0x08, 0xE4, 0x00, 0x00, 0x00, 0x62, 0x7E, 0x3C, 0x86, 0xBF, 0xA5, 0x86, 0x9E, 0x05,
+    0x86, 0xBE, 0x86, 0x9E, 0x3A, 0x8A, 0x00, 0x00, 0x94, 0x03, 0xFF, 0x40, 0x8A, 0xFF, 0x01, 0x00,
+    0xA4, 0x80, 0x82, 0x00, 0x00, 0x03, 0x39, 0xC0, 0x6A, 0xE0, 0x6A, 0xE0, 0x31, 0x80, 0x82, 0x00,
+    0x00, 0x02, 0x9C, 0x60, 0xFF, 0x01, 0xFF, 0x21, 0x83, 0xFF, 0x01, 0x06, 0xF6, 0xE1, 0xFF, 0x41,
+    0xD5, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x54, 0x53, 0x8E, 0xDF, 0x8F, 0x86, 0x9E, 0x04, 0x86, 0xBF,
+    0x7E, 0x3C, 0x00, 0x41, 0x00, 0x00, 0x08, 0xE4, 0xA0, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x03, 0x11,
+    0x04, 0x00, 0x00, 0x5C, 0xB5, 0x8E, 0xDF, 0xA6, 0x86, 0x9E, 0x06, 0x8E, 0xDF, 0x6D, 0x79, 0x00,
+    0x00, 0x00, 0x04, 0xBD, 0x60, 0xFF, 0x41, 0xF6, 0xE1, 0x88, 0xFF, 0x01, 0x03, 0xFF, 0x21, 0xD5,
+    0xE0, 0x83, 0xA0, 0x29, 0x20, 0x83, 0x00, 0x00, 0x04, 0x31, 0x40, 0x83, 0xA0, 0xD5, 0xE0, 0xFF,
+    0x21, 0xFF, 0x21, 0x83, 0xFF, 0x01, 0x07, 0xF6, 0xE1, 0xFF, 0x41, 0xDE, 0x20, 0x00, 0x05, 0x00,
+    0x00, 0x43, 0x2E, 0x86, 0xBE, 0x86, 0xBE, 0x8F, 0x86, 0x9E, 0x03, 0x8E, 0xDF, 0x5C, 0xB5, 0x00,
+    0x00, 0x10, 0xE4, 0xA1, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x08, 0xE4,
+    0x7E, 0x5D, 0x86, 0xBF, 0xA6, 0x86, 0x9E, 0x05, 0x86, 0xBF, 0x4B, 0xF2, 0x00, 0x00, 0x00, 0x05,
+    0xCD, 0xA0, 0xFF, 0x41, 0x89, 0xFF, 0x01, 0x09, 0xFF, 0x41, 0xFF, 0x21, 0xEE, 0xA1, 0xDE, 0x21,
+    0xCD, 0xC0, 0xCD, 0xC0, 0xDE, 0x20, 0xEE, 0xA1, 0xFF, 0x21, 0xFF, 0x41, 0x85, 0xFF, 0x01, 0x06,
+    0xFF, 0x41, 0xD6, 0x00, 0x00, 0x05, 0x00, 0x00, 0x32, 0x6A, 0x86, 0x7D, 0x86, 0xBF, 0x8F, 0x86,
+    0x9E, 0x04, 0x8E, 0xBF, 0x7E, 0x5D, 0x08, 0xA3, 0x00, 0x00, 0x00, 0x62, 0xA1, 0x00, 0x00, 0xA2,
+    0x00, 0x00, 0x03, 0x08, 0xE4, 0x00, 0x00, 0x43, 0x90, 0x86, 0xBF, 0xA6, 0x86, 0x9E, 0x08, 0x86,
+    0xBE, 0x86, 0x9E, 0x43, 0x2E, 0x00, 0x00, 0x00, 0x05, 0xBD, 0x20, 0xFF, 0x41, 0xFF, 0x21, 0xF6,
+    0xE1, 0x88, 0xFF, 0x01, 0x00, 0xFF, 0x21, 0x83, 0xFF, 0x41, 0x02, 0xFF, 0x21, 0xFF, 0x01, 0xF6,
+    0xE1, 0x82, 0xFF, 0x01, 0x08, 0xF7, 0x01, 0xFF, 0x21, 0xFF, 0x41, 0xCD, 0xA0, 0x00, 0x05, 0x00,
+    0x00, 0x32, 0x4A, 0x7E, 0x5D, 0x8E, 0xDF, 0x8F, 0x86, 0x9E, 0x04, 0x86, 0xBE, 0x86, 0xBF, 0x43,
+    0x70, 0x00, 0x00, 0x08, 0xE4, 0xA2, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x04, 0x08, 0xE4, 0x00, 0x00,
+    0x5C, 0x74, 0x8E, 0xDF, 0x86, 0xBE, 0xA5, 0x86, 0x9E, 0x09, 0x86, 0xBF, 0x86, 0x9E, 0x43, 0x2E,
+    0x00, 0x00, 0x00, 0x04, 0x8C, 0x03, 0xEE, 0xA0, 0xFF, 0x41, 0xFF, 0x21, 0xF6, 0xE1, 0x87, 0xFF,
+    0x01, 0x83, 0xF6, 0xE1, 0x85, 0xFF, 0x01, 0x07, 0xFF, 0x41, 0xFF, 0x00, 0xA4, 0x82, 0x00, 0x04,
+    0x00, 0x00, 0x3A, 0xCC, 0x7E, 0x5D, 0x8E, 0xDF, 0x8F, 0x86, 0x9E, 0x04, 0x86, 0xBE, 0x8E, 0xDF,
+    0x5C, 0x74, 0x00, 0x00, 0x08, 0xE4, 0xA3, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x04, 0x08, 0xC3, 0x00,
+    0x00, 0x54, 0x54, 0x86, 0xBE, 0x8E, 0xDF, 0xA5, 0x86, 0x9E, 0x0B, 0x86, 0xBF, 0x86, 0x9E, 0x54,
+    0x53, 0x00, 0x00, 0x00, 0x00, 0x29, 0x84, 0xBD, 0x42, 0xF6, 0xE1, 0xFF, 0x41, 0xFF, 0x21, 0xFF,
+    0x01, 0xF6, 0xE1, 0x8A, 0xFF, 0x01, 0x0A, 0xF6, 0xE1, 0xFF, 0x01, 0xFF, 0x41, 0xFF, 0x21, 0xDE,
+    0x00, 0x62, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xD2, 0x86, 0x9E, 0x86, 0xBF, 0x8F, 0x86, 0x9E,
+    0x04, 0x8E, 0xDF, 0x86, 0xBF, 0x54, 0x54, 0x00, 0x00, 0x08, 0xC4, 0xA4, 0x00, 0x00, 0xA5, 0x00,
+    0x00, 0x05, 0x08, 0xC4, 0x00, 0x00, 0x3B, 0x2E, 0x7E, 0x1C, 0x8E, 0xDF, 0x8E, 0xDF, 0xA5, 0x86,
+    0x9E, 0x10, 0x86, 0xBF, 0x6D, 0x79, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x20, 0xB5, 0x20,
+    0xEE, 0xA0, 0xFF, 0x21, 0xFF, 0x41, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x01, 0xFF, 0x01, 0xF7, 0x01,
+    0xF6, 0xE1, 0xF6, 0xE1, 0x82, 0xFF, 0x01, 0x0B, 0xFF, 0x21, 0xFF, 0x41, 0xFF, 0x21, 0xDE, 0x20,
+    0x8B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x64, 0xF7, 0x86, 0xBF, 0x86, 0x9E, 0x86, 0x7E,
+    0x8D, 0x86, 0x9E, 0x81, 0x8E, 0xDF, 0x03, 0x7E, 0x1B, 0x3B, 0x2E, 0x00, 0x00, 0x08, 0xC4, 0xA5,
+    0x00, 0x00, 0xA6, 0x00, 0x00, 0x05, 0x08, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x33, 0x75, 0xFB,
+    0x86, 0x9E, 0xA5, 0x8E, 0xDF, 0x0B, 0x8F, 0x1F, 0x86, 0xBF, 0x65, 0x17, 0x3A, 0xAB, 0x00, 0x01,
+    0x00, 0x00, 0x10, 0x80, 0x8B, 0xC0, 0xC5, 0x80, 0xE6, 0x60, 0xF6, 0xE1, 0xFF, 0x21, 0x84, 0xFF,
+    0x41, 0x0A, 0xFF, 0x21, 0xFF, 0x01, 0xE6, 0x80, 0xBD, 0x60, 0x73, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x44, 0x54, 0x12, 0x7E, 0x5D, 0x8F, 0x1F, 0x8F, 0x8E, 0xDF, 0x05, 0x86, 0x9E, 0x75, 0xFB,
+    0x54, 0x33, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE4, 0xA6, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x06, 0x08,
+    0xC4, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x32, 0x8C, 0x4B, 0xF2, 0x5C, 0xD6, 0xA3, 0x64, 0xF7,
+    0x06, 0x64, 0xF6, 0x65, 0x17, 0x6D, 0x58, 0x5C, 0x95, 0x29, 0xA7, 0x20, 0xA0, 0x00, 0x01, 0x82,
+    0x00, 0x00, 0x08, 0x5A, 0x80, 0x83, 0xA0, 0x9C, 0x60, 0xB5, 0x20, 0xBD, 0x20, 0xBD, 0x20, 0xAC,
+    0xC0, 0x8B, 0xE0, 0x62, 0xC0, 0x82, 0x00, 0x00, 0x05, 0x18, 0xC2, 0x18, 0x00, 0x3B, 0x0E, 0x65,
+    0x38, 0x65, 0x38, 0x64, 0xF6, 0x8D, 0x64, 0xF7, 0x06, 0x5C, 0xD6, 0x4B, 0xF2, 0x32, 0x8C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xE4, 0xA7, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0x00, 0x61,
+    0x08, 0xE4, 0x00, 0x82, 0xAC, 0x00, 0x00, 0x03, 0x08, 0x40, 0x18, 0xC0, 0x21, 0x00, 0x08, 0x40,
+    0x88, 0x00, 0x00, 0x02, 0x08, 0x20, 0x21, 0x00, 0x18, 0xA0, 0x96, 0x00, 0x00, 0x02, 0x00, 0x82,
+    0x08, 0xE4, 0x00, 0x61, 0xA8, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x81, 0x11, 0x25, 0xA7, 0x11, 0x05,
+    0x00, 0x08, 0x82, 0x84, 0x00, 0x00, 0x03, 0x00, 0x20, 0x18, 0xC0, 0x21, 0x00, 0x29, 0x00, 0x82,
+    0x29, 0x20, 0x81, 0x29, 0x00, 0x01, 0x20, 0xE0, 0x00, 0x20, 0x84, 0x00, 0x00, 0x02, 0x08, 0xE4,
+    0x11, 0x05, 0x09, 0x04, 0x8E, 0x11, 0x05, 0x81, 0x11, 0x25, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xAB, 0x00, 0x00,
+};
+
+const AssetInfo assetManifest[] = {
+    { "baby-bath_172", 172, 172, ASSET_FORMAT_RGB565_RLE, 0, 12307, 0x677C900E },
+};
@@ -0,0 +1,41 @@
+#include "assets.h"
+
+/**
+ * @return Manifest entry, nullptr for an unknown ID
+ */
+const AssetInfo* assetInfo(AssetId id) {
+    if (id >= ASSET_COUNT) {
+        return nullptr;
+    }
+    return &assetManifest[id];
+}
+
+/**
+ * @return AssetId of the asset with this name, -1 if there is none
+ */
+int assetFind(const char* name) {
+    for (int i = 0; i < ASSET_COUNT; i++) {
+        if (strcmp(assetManifest[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Describe an RLE image asset for RleDecoder
+ * 
+ * @return false if the ID is unknown or the asset is not an RLE image
+ */
+bool assetImage(AssetId id, RleImage* image) {
+    const AssetInfo* info = assetInfo(id);
+    if (info == nullptr || info->format != ASSET_FORMAT_RGB565_RLE) {
+        return false;
+    }
+    image->width = info->width;
+    image->height = info->height;
+    image->size = info->size;
+    image->checksum = info->checksum;
+    image->data = assetData + info->offset;
+    return true;
+}
@@ -0,0 +1,91 @@
+#include "circuit_breaker.h"
+
+CircuitBreaker::CircuitBreaker(const char* name, int failureThreshold, unsigned long baseBackoffMs, unsigned long maxBackoffMs) {
+    this->name = name;
+    this->failureThreshold = failureThreshold;
+    this->baseBackoffMs = baseBackoffMs;
+    this->maxBackoffMs = maxBackoffMs;
+    totalFailures = 0;
+    reset();
+}
+
+/**
+ * @brief Close the breaker and forget the backoff (e.g. after a config change)
+ *
+ * The total failure count is kept for diagnostics.
+ */
+void CircuitBreaker::reset() {
+    state = CLOSED;
+    consecutiveFailures = 0;
+    backoffMs = baseBackoffMs;
+    openedAt = 0;
+}
+
+/**
+ * @brief Whether the endpoint may be contacted now
+ *
+ * Moves an open breaker to half-open once its backoff has elapsed.
+ */
+bool CircuitBreaker::allowRequest() {
+    if (state == OPEN) {
+        if (millis() - openedAt < backoffMs) {
+            return false;
+        }
+        state = HALF_OPEN;
+        Serial.printf("%s: circuit half-open, trying again\n", name);
+    }
+    return true;
+}
+
+void CircuitBreaker::recordSuccess() {
+    if (state != CLOSED) {
+        Serial.printf("%s: circuit closed after %d failures\n", name, consecutiveFailures);
+    }
+    reset();
+}
+
+void CircuitBreaker::recordFailure() {
+    consecutiveFailures++;
+    totalFailures++;
+
+    if (state == HALF_OPEN) {
+        // Trial failed: back off twice as long
+        unsigned long next = backoffMs * 2;
+        trip(next > maxBackoffMs ? maxBackoffMs : next);
+    } else if (state == CLOSED && consecutiveFailures >= failureThreshold) {
+        trip(baseBackoffMs);
+    }
+}
+
+void CircuitBreaker::trip(unsigned long backoff) {
+    state = OPEN;
+    backoffMs = backoff;
+    openedAt = millis();
+    Serial.printf("%s: circuit open after %d failures, retry in %lu s\n", name, consecutiveFailures, backoffMs / 1000);
+}
+
+/**
+ * @return Milliseconds until an open breaker allows a trial, 0 otherwise
+ */
+unsigned long CircuitBreaker::getRetryInMs() const {
+    if (state != OPEN) {
+        return 0;
+    }
+    unsigned long elapsed = millis() - openedAt;
+    return elapsed < backoffMs ? backoffMs - elapsed : 0;
+}
+
+const char* CircuitBreaker::getStateName() const {
+    return stateName(state);
+}
+
+const char* CircuitBreaker::stateName(State state) {
+    switch (state) {
+        case OPEN:
+            return "open";
+        case HALF_OPEN:
+            return "half-open";
+        default:
+            return "closed";
+    }
+}
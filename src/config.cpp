@@ -1,5 +1,6 @@
 #include "config.h"
 #include <string.h>
+#include <ctype.h>
 
 ConfigManager::ConfigManager() {
 }
@@ -17,23 +18,31 @@ void ConfigManager::setDefaults() {
     // Default Home Assistant settings
     strcpy(config.ha_url, "http://homeassistant.local:8123");
     strcpy(config.ha_token, "");
+    config.ha_batch_fetch = true;        // One template request per poll
+    config.ha_websocket = false;         // Polling only until push is enabled
+    strcpy(config.ha_cert_sha256, "");   // https certificate not pinned
     
-    // Default Entity IDs (empty - to be configured)
-    strcpy(config.entity_tank_temp, "");
-    strcpy(config.entity_out_pipe_temp, "");
-    strcpy(config.entity_heating_in_temp, "");
-    strcpy(config.entity_room_temp, "");
+    // Default sensors: the four classic roles, entities to be configured
+    const uint8_t defaultRoles[MAX_SENSORS] = { ROLE_TANK, ROLE_OUT_PIPE, ROLE_HEATING_IN, ROLE_ROOM };
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        config.sensors[i].role = defaultRoles[i];
+        config.sensors[i].entity_id[0] = '\0';
+    }
     
     // Default thresholds (Celsius)
-    config.min_tank_temp = 52.0;         // 52°C minimum for bath
-    config.min_out_pipe_temp = 38.0;     // 38°C minimum out pipe
+    config.min_tank_temp = 5200;         // 52°C minimum for bath
+    config.min_out_pipe_temp = 3800;     // 38°C minimum out pipe
     
     // Display settings
     config.screen_brightness = 80;
     config.celsius = true;
+    config.screen_dim_after = 10;
+    config.screen_sleep_after = 60;
     
     // Polling interval
     config.poll_interval = 10;           // 10 seconds
+    config.poll_min_interval = 2;        // Bath fill / heating
+    config.poll_max_interval = 120;      // Overnight
 }
 
 void ConfigManager::load() {
@@ -52,35 +61,56 @@ void ConfigManager::load() {
     // Load Home Assistant settings
     preferences.getString("ha_url", config.ha_url, sizeof(config.ha_url));
     preferences.getString("ha_token", config.ha_token, sizeof(config.ha_token));
+    config.ha_batch_fetch = preferences.getBool("ha_batch", true);
+    config.ha_websocket = preferences.getBool("ha_ws", false);
+    if (preferences.getString("ha_pin", config.ha_cert_sha256, sizeof(config.ha_cert_sha256)) == 0) {
+        config.ha_cert_sha256[0] = '\0';
+    }
     
-    // Load Entity IDs
-    preferences.getString("ent_tank", config.entity_tank_temp, sizeof(config.entity_tank_temp));
-    preferences.getString("ent_out", config.entity_out_pipe_temp, sizeof(config.entity_out_pipe_temp));
-    preferences.getString("ent_heat_in", config.entity_heating_in_temp, sizeof(config.entity_heating_in_temp));
-    preferences.getString("ent_room", config.entity_room_temp, sizeof(config.entity_room_temp));
+    // Load sensor slots, migrating the four fixed entity keys of older firmware
+    if (!preferences.isKey("s0_role")) {
+        migrateSensors();
+    } else {
+        for (int i = 0; i < MAX_SENSORS; i++) {
+            char key[12];
+            snprintf(key, sizeof(key), "s%d_role", i);
+            config.sensors[i].role = preferences.getUChar(key, ROLE_NONE);
+            snprintf(key, sizeof(key), "s%d_ent", i);
+            if (preferences.getString(key, config.sensors[i].entity_id, ENTITY_ID_MAX) == 0) {
+                if (preferences.isKey(key)) {
+                    Serial.printf("Sensor %d entity ID is longer than %d characters, not loaded\n",
+                                  i, ENTITY_ID_MAX - 1);
+                }
+                config.sensors[i].entity_id[0] = '\0';
+            }
+        }
+    }
     
     Serial.println("Loaded config:");
     Serial.print("  HA URL: ");
     Serial.println(config.ha_url);
     Serial.print("  Token len: ");
     Serial.println(strlen(config.ha_token));
-    Serial.print("  Tank entity: '");
-    Serial.print(config.entity_tank_temp);
-    Serial.println("'");
-    Serial.print("  Out entity: '");
-    Serial.print(config.entity_out_pipe_temp);
-    Serial.println("'");
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        if (strlen(config.sensors[i].entity_id) > 0) {
+            Serial.printf("  Sensor %d (role %d): '%s'\n", i, config.sensors[i].role, config.sensors[i].entity_id);
+        }
+    }
     
-    // Load thresholds
-    config.min_tank_temp = preferences.getFloat("min_tank", 52.0);
-    config.min_out_pipe_temp = preferences.getFloat("min_out", 38.0);
+    // Load thresholds (stored as float °C, kept for compatibility)
+    config.min_tank_temp = tempFromFloat(preferences.getFloat("min_tank", 52.0));
+    config.min_out_pipe_temp = tempFromFloat(preferences.getFloat("min_out", 38.0));
     
     // Load display settings
     config.screen_brightness = preferences.getInt("brightness", 80);
     config.celsius = preferences.getBool("celsius", true);
+    config.screen_dim_after = preferences.getInt("dim_after", 10);
+    config.screen_sleep_after = preferences.getInt("sleep_after", 60);
     
     // Load polling interval
     config.poll_interval = preferences.getInt("poll_int", 10);
+    config.poll_min_interval = preferences.getInt("poll_min", 2);
+    config.poll_max_interval = preferences.getInt("poll_max", 120);
 }
 
 void ConfigManager::save() {
@@ -91,23 +121,39 @@ void ConfigManager::save() {
     // Save Home Assistant settings
     preferences.putString("ha_url", config.ha_url);
     preferences.putString("ha_token", config.ha_token);
+    preferences.putBool("ha_batch", config.ha_batch_fetch);
+    preferences.putBool("ha_ws", config.ha_websocket);
+    preferences.putString("ha_pin", config.ha_cert_sha256);
     
-    // Save Entity IDs
-    preferences.putString("ent_tank", config.entity_tank_temp);
-    preferences.putString("ent_out", config.entity_out_pipe_temp);
-    preferences.putString("ent_heat_in", config.entity_heating_in_temp);
-    preferences.putString("ent_room", config.entity_room_temp);
+    saveSensors();
     
     // Save thresholds
-    preferences.putFloat("min_tank", config.min_tank_temp);
-    preferences.putFloat("min_out", config.min_out_pipe_temp);
+    preferences.putFloat("min_tank", tempToFloat(config.min_tank_temp));
+    preferences.putFloat("min_out", tempToFloat(config.min_out_pipe_temp));
     
     // Save display settings
     preferences.putInt("brightness", config.screen_brightness);
     preferences.putBool("celsius", config.celsius);
+    preferences.putInt("dim_after", config.screen_dim_after);
+    preferences.putInt("sleep_after", config.screen_sleep_after);
     
     // Save polling interval
     preferences.putInt("poll_int", config.poll_interval);
+    preferences.putInt("poll_min", config.poll_min_interval);
+    preferences.putInt("poll_max", config.poll_max_interval);
+}
+
+/**
+ * @brief Write the sensor slot keys (s<i>_role, s<i>_ent)
+ */
+void ConfigManager::saveSensors() {
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        char key[12];
+        snprintf(key, sizeof(key), "s%d_role", i);
+        preferences.putUChar(key, config.sensors[i].role);
+        snprintf(key, sizeof(key), "s%d_ent", i);
+        preferences.putString(key, config.sensors[i].entity_id);
+    }
 }
 
 void ConfigManager::setWiFi(const char* ssid, const char* password) {
@@ -120,23 +166,75 @@ void ConfigManager::setHA(const char* url, const char* token) {
     strncpy(config.ha_token, token, sizeof(config.ha_token) - 1);
 }
 
-void ConfigManager::setEntities(const char* tank, const char* outPipe, const char* heatIn, const char* room) {
-    strncpy(config.entity_tank_temp, tank, sizeof(config.entity_tank_temp) - 1);
-    strncpy(config.entity_out_pipe_temp, outPipe, sizeof(config.entity_out_pipe_temp) - 1);
-    strncpy(config.entity_heating_in_temp, heatIn, sizeof(config.entity_heating_in_temp) - 1);
-    strncpy(config.entity_room_temp, room, sizeof(config.entity_room_temp) - 1);
+void ConfigManager::setSensor(int slot, uint8_t role, const char* entityId) {
+    if (slot < 0 || slot >= MAX_SENSORS) {
+        return;
+    }
+    if (role >= ROLE_COUNT) {
+        Serial.print("Invalid sensor role: ");
+        Serial.println(role);
+        role = ROLE_OTHER;
+    }
+    SensorConfig& sensor = config.sensors[slot];
+    sensor.role = entityId[0] != '\0' ? role : ROLE_NONE;
+    strncpy(sensor.entity_id, entityId, ENTITY_ID_MAX - 1);
+    sensor.entity_id[ENTITY_ID_MAX - 1] = '\0';
 }
 
-void ConfigManager::setThresholds(float minTank, float minOutPipe) {
+/**
+ * @brief Convert the fixed tank/out/heating-in/room entity keys to sensor slots
+ * 
+ * Slots 0-3 take the old entities with their roles; the old keys are removed
+ * once the slots are saved. Runs in the middle of load(), so only the slot
+ * keys are written: a full save() would store the settings that are not
+ * loaded yet (thresholds, brightness, poll intervals) as zeros.
+ *
+ * getString() copies nothing if a value does not fit, so an entity that
+ * cannot be read leaves its slot empty and keeps its old key, rather than
+ * deleting the only copy.
+ */
+void ConfigManager::migrateSensors() {
+    const char* oldKeys[4] = { "ent_tank", "ent_out", "ent_heat_in", "ent_room" };
+    const uint8_t roles[4] = { ROLE_TANK, ROLE_OUT_PIPE, ROLE_HEATING_IN, ROLE_ROOM };
+    
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        config.sensors[i].role = ROLE_NONE;
+        config.sensors[i].entity_id[0] = '\0';
+    }
+    bool migrated[4] = { false, false, false, false };
+    for (int i = 0; i < 4; i++) {
+        config.sensors[i].role = roles[i];
+        if (!preferences.isKey(oldKeys[i])) {
+            continue;
+        }
+        if (preferences.getString(oldKeys[i], config.sensors[i].entity_id, ENTITY_ID_MAX) > 0) {
+            migrated[i] = true;
+        } else {
+            config.sensors[i].entity_id[0] = '\0';
+            Serial.printf("Migration: %s is longer than %d characters, kept, slot %d left empty\n",
+                          oldKeys[i], ENTITY_ID_MAX - 1, i);
+        }
+    }
+    
+    Serial.println("Migrating sensor entities to registry slots");
+    saveSensors();
+    for (int i = 0; i < 4; i++) {
+        if (migrated[i]) {
+            preferences.remove(oldKeys[i]);
+        }
+    }
+}
+
+void ConfigManager::setThresholds(TempCenti minTank, TempCenti minOutPipe) {
     // Validate temperature ranges (0-100°C reasonable for water system)
-    if (minTank >= 0.0 && minTank <= 100.0) {
+    if (minTank >= 0 && minTank <= 100 * TEMP_ONE_DEGREE) {
         config.min_tank_temp = minTank;
     } else {
         Serial.print("Invalid tank threshold: ");
         Serial.println(minTank);
     }
     
-    if (minOutPipe >= 0.0 && minOutPipe <= 100.0) {
+    if (minOutPipe >= 0 && minOutPipe <= 100 * TEMP_ONE_DEGREE) {
         config.min_out_pipe_temp = minOutPipe;
     } else {
         Serial.print("Invalid out pipe threshold: ");
@@ -155,3 +253,74 @@ void ConfigManager::setBrightness(int brightness) {
     }
     config.screen_brightness = brightness;
 }
+
+void ConfigManager::setScreenTimeouts(int dimAfter, int sleepAfter) {
+    // Minutes, 0 = never; dimming after the panel is already asleep is pointless
+    if (dimAfter < 0 || dimAfter > 1440 || sleepAfter < 0 || sleepAfter > 1440) {
+        Serial.printf("Invalid screen timeouts: dim %d, sleep %d\n", dimAfter, sleepAfter);
+        return;
+    }
+    if (sleepAfter > 0 && dimAfter >= sleepAfter) {
+        dimAfter = 0;
+        Serial.println("Dim timeout not before sleep timeout, dimming disabled");
+    }
+    config.screen_dim_after = dimAfter;
+    config.screen_sleep_after = sleepAfter;
+}
+
+void ConfigManager::setBatchFetch(bool enabled) {
+    config.ha_batch_fetch = enabled;
+}
+
+void ConfigManager::setWebSocket(bool enabled) {
+    config.ha_websocket = enabled;
+}
+
+void ConfigManager::setPollIntervals(int nominal, int minimum, int maximum) {
+    // Keep 1 s <= minimum <= nominal <= maximum <= 1 h
+    if (minimum < 1 || minimum > 3600 || maximum < minimum || maximum > 3600) {
+        Serial.print("Invalid poll interval range: ");
+        Serial.print(minimum);
+        Serial.print("-");
+        Serial.println(maximum);
+        return;
+    }
+    if (nominal < minimum) {
+        nominal = minimum;
+    } else if (nominal > maximum) {
+        nominal = maximum;
+    }
+    config.poll_interval = nominal;
+    config.poll_min_interval = minimum;
+    config.poll_max_interval = maximum;
+}
+
+void ConfigManager::setCertPin(const char* hexSha256) {
+    if (!normalizeCertPin(hexSha256, config.ha_cert_sha256, sizeof(config.ha_cert_sha256))) {
+        Serial.println("Invalid certificate pin, verification disabled");
+        config.ha_cert_sha256[0] = '\0';
+    }
+}
+
+/**
+ * @brief Normalize a SHA-256 fingerprint to 64 lowercase hex digits
+ * 
+ * Accepts the formats browsers and openssl print, e.g. "AB:CD:..." or
+ * "abcd...", ignoring colons and spaces. An empty input is valid (no pin).
+ * 
+ * @return false if the input is not empty and not 32 hex-encoded bytes
+ */
+bool ConfigManager::normalizeCertPin(const char* input, char* output, size_t outputSize) {
+    size_t len = 0;
+    for (const char* p = input; *p != '\0'; p++) {
+        if (*p == ':' || *p == ' ') {
+            continue;
+        }
+        if (!isxdigit((unsigned char)*p) || len >= 64 || len + 1 >= outputSize) {
+            return false;
+        }
+        output[len++] = tolower((unsigned char)*p);
+    }
+    output[len] = '\0';
+    return len == 0 || len == 64;
+}
@@ -1,5 +1,6 @@
 #include "display.h"
-#include "baby_bath_image.h"
+#include "assets.h"
+#include "render_profile.h"
 
 #define LGFX_USE_V1
 #include <LovyanGFX.hpp>
@@ -11,8 +12,203 @@
 // Display timing constants
 const unsigned long BATH_IMAGE_DISPLAY_TIME = 4000;   // 4 seconds
 const unsigned long ROOM_TEMP_DISPLAY_TIME = 2000;    // 2 seconds
+const unsigned long ROOM_IDLE_DISPLAY_TIME = 10000;   // Room page without hot water activity
+const unsigned long TREND_DISPLAY_TIME = 5000;        // 5 seconds
 const unsigned long ACTIVITY_TIMEOUT = 120000;        // 2 minutes
 
+// Backlight fades (LEDC hardware fades, the CPU is not involved)
+const unsigned long BACKLIGHT_FADE_MS = 500;          // Brightness setting changed
+const unsigned long BACKLIGHT_DIM_FADE_MS = 3000;     // Idle: slowly down to the dim level
+const unsigned long BACKLIGHT_SLEEP_FADE_MS = 1500;   // Out before the panel goes to sleep
+const unsigned long BACKLIGHT_WAKE_FADE_MS = 150;     // Activity: back up almost at once
+const int BACKLIGHT_DIM_PERCENT = 20;                 // Dim level, % of the brightness setting
+
+// Smallest change that counts as a new temperature (0.1°C)
+const TempCenti TEMP_CHANGE_MIN = 10;
+
+// Trend chart: 4 bpp palette sprite, one column per sample
+const uint16_t TREND_PALETTE[] = { TFT_BLACK, TFT_DARKGREY, TFT_RED, TFT_ORANGE, TFT_YELLOW };
+const uint8_t TREND_GRID = 1;         // Palette index of the grid lines
+const uint8_t TREND_FIRST_SERIES = 2; // Palette index of TREND_TANK, then one per series
+const int TREND_GRID_LINES = 4;       // Chart height divided in quarters
+const TempCenti TREND_STEP = 5 * TEMP_ONE_DEGREE;   // Range rounded to this
+const TempCenti TREND_MIN_RANGE = 10 * TEMP_ONE_DEGREE;
+
+// Every widget can add its old and its new rectangle
+const int MAX_DIRTY_RECTS = WIDGET_COUNT * 2;
+
+// Off-screen composition: a full-screen sprite would need 320 x 172 x 2 =
+// 110 KB, so dirty rectangles are rendered in bands of at most BAND_PIXELS
+// (2 x 15 KB, double buffered)
+const int BAND_ROWS = 24;
+const int BAND_PIXELS = SCREEN_WIDTH * BAND_ROWS;
+
+// Palette scenes: STOP, room temperature and the status pages only use
+// these colours, so they are composed in one full-screen indexed buffer
+// (320 x 172 at 4 bpp = 27.5 KB) and expanded to RGB565 band by band on
+// the way to the panel. Entries 0 and 1 equal the room glyph palette, so
+// glyph cells copy straight in.
+const uint16_t SCENE_PALETTE[] = {
+    TFT_BLACK, TFT_CYAN, TFT_WHITE, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_NAVY, TFT_DARKGREEN, TFT_GREEN
+};
+const int SCENE_COLORS = sizeof(SCENE_PALETTE) / sizeof(SCENE_PALETTE[0]);
+const int SCENE_BITS = 4;             // 2, 4 or 8 bpp
+const int SCENE_STRIDE = (SCREEN_WIDTH * SCENE_BITS + 7) / 8;
+static_assert(SCENE_COLORS <= (1 << SCENE_BITS), "SCENE_PALETTE does not fit in SCENE_BITS");
+
+// Heating indicator: 3 waves of 25 dots, 2 px apart, scrolling up both sides
+const int WAVE_COUNT = 3;
+const int WAVE_DOTS = 25;
+const int WAVE_DOT_STEP = 2;
+const int WAVE_SPACING = 60;          // Vertical distance between waves
+const int WAVE_PHASE = 20;            // Sine phase shift per wave, in rows
+const int WAVE_AMPLITUDE = 6;
+const int WAVE_MARGIN = 2;            // Distance of the wave trough from the screen edge
+const int WAVE_ROWS = 172 + (WAVE_COUNT - 1) * WAVE_PHASE;
+const int WAVE_DOT_RADIUS = 3;
+const int WAVE_DOT_SIZE = WAVE_DOT_RADIUS * 2 + 1;
+const uint16_t WAVE_DOT_TRANSPARENT = 0x0020;  // Key colour, never drawn
+const uint16_t WAVE_COLORS[3] = { TFT_RED, TFT_ORANGE, TFT_YELLOW };
+
+// Animation layer: the waves live in two side strips that are redrawn on
+// their own at ANIMATION_FPS; every scene keeps these strips black
+const unsigned long ANIMATION_FPS = 25;
+const unsigned long ANIMATION_FRAME_US = 1000000UL / ANIMATION_FPS;
+
+constexpr double WAVE_PI = 3.14159265358979323846;
+
+/**
+ * @brief Compile-time sine (Taylor series after range reduction)
+ */
+constexpr double constexprSin(double x) {
+    while (x > WAVE_PI) x -= 2 * WAVE_PI;
+    while (x < -WAVE_PI) x += 2 * WAVE_PI;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Heat wave profile, evaluated by the compiler
+ *
+ * xOffset is the distance from the screen edge for a wave row (screen row
+ * plus the wave's phase shift); colorIndex fades each wave from red through
+ * orange to yellow by thirds. Replaces ~150 soft-float sin() calls per frame.
+ */
+struct WaveTable {
+    uint8_t xOffset[WAVE_ROWS];
+    uint8_t colorIndex[WAVE_DOTS];
+    
+    constexpr WaveTable() : xOffset(), colorIndex() {
+        for (int row = 0; row < WAVE_ROWS; row++) {
+            xOffset[row] = (uint8_t)(WAVE_AMPLITUDE * constexprSin(row * 0.2) + WAVE_AMPLITUDE + WAVE_MARGIN);
+        }
+        for (int dot = 0; dot < WAVE_DOTS; dot++) {
+            int fadePercent = dot * WAVE_DOT_STEP * 100 / (WAVE_DOTS * WAVE_DOT_STEP);
+            colorIndex[dot] = fadePercent < 33 ? 0 : (fadePercent < 66 ? 1 : 2);
+        }
+    }
+};
+
+static constexpr WaveTable waveTable;
+
+/**
+ * @brief Scroll position of the heat waves, shared by scene and animation
+ */
+static int waveOffset() {
+    return (millis() / 60) % 172;  // Smooth upward scroll
+}
+
+/**
+ * @brief Rectangle clipped to the screen
+ */
+static DisplayRect makeRect(int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+    if (w < 0) w = 0;
+    if (h < 0) h = 0;
+    return { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+}
+
+static bool rectsOverlap(const DisplayRect& a, const DisplayRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static bool rectContains(const DisplayRect& outer, const DisplayRect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.w <= outer.x + outer.w && inner.y + inner.h <= outer.y + outer.h;
+}
+
+static bool sameRect(const DisplayRect& a, const DisplayRect& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+static int minInt(int a, int b) { return a < b ? a : b; }
+static int maxInt(int a, int b) { return a > b ? a : b; }
+
+static DisplayRect rectUnion(const DisplayRect& a, const DisplayRect& b) {
+    int x1 = minInt(a.x, b.x);
+    int y1 = minInt(a.y, b.y);
+    int x2 = maxInt(a.x + a.w, b.x + b.w);
+    int y2 = maxInt(a.y + a.h, b.y + b.h);
+    return makeRect(x1, y1, x2 - x1, y2 - y1);
+}
+
+static unsigned long overlapArea(const DisplayRect& a, const DisplayRect& b) {
+    int w = minInt(a.x + a.w, b.x + b.w) - maxInt(a.x, b.x);
+    int h = minInt(a.y + a.h, b.y + b.h) - maxInt(a.y, b.y);
+    return w > 0 && h > 0 ? (unsigned long)w * h : 0;
+}
+
+/**
+ * @brief Add a rectangle to the dirty list, merging it with any it overlaps
+ * 
+ * Overlapping regions would otherwise be sent to the panel twice.
+ */
+static void addDirtyRect(DisplayRect rects[], int& count, DisplayRect rect) {
+    if (rect.w == 0 || rect.h == 0) {
+        return;
+    }
+    int i = 0;
+    while (i < count) {
+        if (rectsOverlap(rects[i], rect)) {
+            rect = rectUnion(rects[i], rect);
+            rects[i] = rects[--count];
+            i = 0;  // The grown rectangle may now touch earlier ones
+        } else {
+            i++;
+        }
+    }
+    rects[count++] = rect;
+}
+
+// SCENE_SCREEN resolved at begin(): layout entry and fixed bounds per widget
+static const WidgetSpec* widgetSpecs[WIDGET_COUNT];
+static DisplayRect widgetBounds[WIDGET_COUNT];
+
+/**
+ * @brief Widgets that cover every pixel of their bounds
+ */
+static bool widgetIsOpaque(int widget) {
+    WidgetKind kind = widgetSpecs[widget]->kind;
+    return kind == KIND_IMAGE || kind == KIND_STRIP || kind == KIND_BIG_NUMBER || kind == KIND_SPARKLINE;
+}
+
+/**
+ * @brief Box of size w x h whose datum point is (x, y)
+ * 
+ * LovyanGFX datums: bits 0-1 left/centre/right, bits 2-3 top/middle/bottom.
+ */
+static DisplayRect anchorRect(uint8_t datum, int x, int y, int w, int h) {
+    return makeRect(x - (datum & 3) * w / 2, y - ((datum >> 2) & 3) * h / 2, w, h);
+}
+
 // LovyanGFX configuration for Waveshare ESP32-C6 1.47"
 class LGFX_ESP32C6 : public lgfx::LGFX_Device
 {
@@ -64,6 +260,252 @@ public:
 
 static LGFX_ESP32C6 tft;
 
+// Pre-rendered heat wave dots, one per fade colour
+static LGFX_Sprite waveDots[3];
+
+// Off-screen buffer for one heat wave side strip (20 x 172 x 2 = 6.9 KB)
+static LGFX_Sprite heatStrip;
+
+// Band back buffers (DMA capable) and a view that reshapes one of them to
+// the width of the rectangle being composed
+static LGFX_Sprite bandStore[2];
+static LGFX_Sprite bandView;
+static bool composeEnabled = false;
+
+// Indexed full-screen buffer of the palette scenes, and its palette as
+// byte-swapped RGB565 for the expansion into the band buffers
+static LGFX_Sprite sceneSprite;
+static uint16_t scenePaletteSwapped[1 << SCENE_BITS];
+static bool paletteEnabled = false;
+
+// Trend chart, kept up to date as samples arrive; the trend page only pushes it
+static LGFX_Sprite trendChart;
+static bool trendEnabled = false;
+
+// Where paintWidget() draws: the panel, bandView while composing in bands
+// or sceneSprite while composing a palette scene
+static LovyanGFX* canvas = &tft;
+
+/**
+ * @brief Colour argument for drawing on target
+ * 
+ * Palette sprites take palette indices instead of RGB565; a colour missing
+ * from SCENE_PALETTE draws as black there.
+ */
+static uint16_t ink(const LovyanGFX& target, uint16_t color) {
+    if (&target != &sceneSprite) {
+        return color;
+    }
+    for (int i = 0; i < SCENE_COLORS; i++) {
+        if (SCENE_PALETTE[i] == color) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Expand rows of sceneSprite to byte-swapped RGB565
+ */
+static void expandSceneRows(int x, int y, int w, int rows, uint16_t* out) {
+    const uint8_t* indices = (const uint8_t*)sceneSprite.getBuffer();
+    const uint8_t mask = (1 << SCENE_BITS) - 1;
+    for (int row = y; row < y + rows; row++) {
+        const uint8_t* line = indices + row * SCENE_STRIDE;
+        for (int bit = x * SCENE_BITS; bit < (x + w) * SCENE_BITS; bit += SCENE_BITS) {
+            *out++ = scenePaletteSwapped[(line[bit >> 3] >> (8 - SCENE_BITS - (bit & 7))) & mask];
+        }
+    }
+}
+
+/**
+ * @brief Send a rectangle of sceneSprite to the panel
+ * 
+ * Rows are expanded into the two band buffers in turn, so one band is
+ * expanded while the previous one is on the wire.
+ * 
+ * @return Number of DMA transfers
+ */
+static int pushSceneRect(const DisplayRect& rect) {
+    int rowsPerBand = BAND_PIXELS / rect.w;
+    int flip = 0;
+    int transfers = 0;
+    
+    tft.startWrite();
+    for (int y = rect.y; y < rect.y + rect.h; y += rowsPerBand) {
+        int rows = rect.y + rect.h - y;
+        if (rows > rowsPerBand) rows = rowsPerBand;
+        uint16_t* band = (uint16_t*)bandStore[flip].getBuffer();
+        RENDER_DRAW(PRIM_PANEL_PUSH, rect.w * rows,
+                    expandSceneRows(rect.x, y, rect.w, rows, band);
+                    tft.waitDMA();
+                    tft.pushImageDMA(rect.x, y, rect.w, rows, (const lgfx::swap565_t*)band));
+        transfers++;
+        flip ^= 1;
+    }
+    tft.endWrite();
+    return transfers;
+}
+
+// Bath image from the asset manifest, centered horizontally, and its
+// streaming decoder, which keeps its row between bands
+static RleImage bathImage;
+static RleDecoder bathDecoder;
+
+// One decoded image row for the direct (non-composed) path
+static uint16_t imageLine[SCREEN_WIDTH];
+
+/**
+ * @brief Decode the visible part of an RLE image into canvas
+ * 
+ * While composing, rows are expanded straight into the band buffer; on
+ * the panel each row goes out as one pushImage() from imageLine.
+ * 
+ * @param left Canvas x of the image's left edge
+ * @param top Canvas y of the image's top edge
+ */
+static void drawRleImage(RleDecoder& decoder, int left, int top) {
+    const RleImage* image = decoder.image();
+    int canvasWidth = canvas->width();
+    int skip = left < 0 ? -left : 0;
+    int x = left + skip;
+    int count = image->width - skip;
+    if (x + count > canvasWidth) count = canvasWidth - x;
+    if (count > SCREEN_WIDTH) count = SCREEN_WIDTH;
+    int firstRow = top < 0 ? -top : 0;
+    int endRow = canvas->height() - top;
+    if (endRow > image->height) endRow = image->height;
+    if (count <= 0 || firstRow >= endRow) {
+        return;
+    }
+    
+    decoder.seekRow(firstRow);
+    if (canvas == &bandView) {
+        uint16_t* band = (uint16_t*)bandView.getBuffer();
+        for (int row = firstRow; row < endRow; row++) {
+            RENDER_DRAW(PRIM_IMAGE, count, decoder.decodeRow(band + (row + top) * canvasWidth + x, skip, count));
+        }
+    } else {
+        for (int row = firstRow; row < endRow; row++) {
+            RENDER_DRAW(PRIM_IMAGE, count,
+                        decoder.decodeRow(imageLine, skip, count);
+                        canvas->pushImage(x, row + top, count, 1, imageLine));
+        }
+    }
+}
+
+// Room temperature glyphs, rasterised once at boot into 1 bpp sprites with
+// a two colour palette (a font 7 digit at size 2 is 64 x 96 = 768 bytes)
+const char ROOM_GLYPH_CHARS[] = "0123456789.-CF";
+const int ROOM_GLYPH_KINDS = sizeof(ROOM_GLYPH_CHARS) - 1;
+static LGFX_Sprite roomGlyphs[ROOM_GLYPH_KINDS];
+static int roomDigitHeight = 0;
+
+/**
+ * @return Index into roomGlyphs, -1 for a character without a glyph
+ */
+static int roomGlyphIndex(char c) {
+    const char* found = c != '\0' ? strchr(ROOM_GLYPH_CHARS, c) : nullptr;
+    return found != nullptr ? found - ROOM_GLYPH_CHARS : -1;
+}
+
+/**
+ * @brief Rasterise the room temperature characters once
+ * 
+ * Digits, point and minus come from the 7-segment font 7 at size 2. It has
+ * no letters, so the unit uses font 4 at size 2, top aligned with the
+ * digits. Every later temperature update only blits the cells whose
+ * character changed.
+ */
+static void buildRoomGlyphs() {
+    for (int i = 0; i < ROOM_GLYPH_KINDS; i++) {
+        char text[2] = { ROOM_GLYPH_CHARS[i], '\0' };
+        uint8_t font = (text[0] == 'C' || text[0] == 'F') ? 4 : 7;
+        
+        tft.setTextSize(2);
+        int w = tft.textWidth(text, font);
+        int h = tft.fontHeight(font);
+        tft.setTextSize(1);
+        if (font == 7) {
+            roomDigitHeight = h;
+        }
+        
+        LGFX_Sprite& glyph = roomGlyphs[i];
+        glyph.setColorDepth(1);
+        if (glyph.createSprite(w, h) == nullptr) {
+            Serial.printf("No memory for room glyph '%c'\n", text[0]);
+            continue;
+        }
+        glyph.createPalette();
+        glyph.setPaletteColor(0, TFT_BLACK);
+        glyph.setPaletteColor(1, TFT_CYAN);
+        glyph.fillSprite(0);
+        glyph.setTextColor(1, 0);   // Palette indices
+        glyph.setTextDatum(TL_DATUM);
+        glyph.setTextSize(2);
+        glyph.drawString(text, 0, 0, font);
+    }
+}
+
+/**
+ * @brief Screen rectangle a layout entry covers
+ * 
+ * Big numbers depend on their value and are laid out in layoutScene().
+ * 
+ * @param text Label text, measured in the entry's font
+ */
+static DisplayRect specBounds(const WidgetSpec& spec, const char* text) {
+    switch (spec.kind) {
+        case KIND_LABEL: {
+            if (text == nullptr) {
+                return makeRect(spec.x, spec.y, 0, 0);   // Text not known yet
+            }
+            tft.setTextSize(spec.size);
+            int w = tft.textWidth(text, spec.font);
+            int h = tft.fontHeight(spec.font);
+            tft.setTextSize(1);
+            // A pixel of slack for the datum rounding
+            DisplayRect box = anchorRect(spec.datum, spec.x, spec.y, w, h);
+            return makeRect(box.x - 1, box.y - 1, box.w + 2, box.h + 2);
+        }
+        case KIND_IMAGE: {
+            RleImage image = {};
+            assetImage((AssetId)spec.asset, &image);
+            return anchorRect(spec.datum, spec.x, spec.y, image.width, image.height);
+        }
+        case KIND_DISC: {
+            int extent = spec.radius + (spec.outline > 0 ? spec.outline - 1 : 0);
+            return makeRect(spec.x - extent, spec.y - extent, extent * 2 + 1, extent * 2 + 1);
+        }
+        case KIND_CHECK: {
+            int spread = spec.outline / 2;
+            return makeRect(spec.x - spec.radius, spec.y - spec.radius - spread,
+                            spec.radius * 2 + 1, (spec.radius + spread) * 2 + 1);
+        }
+        case KIND_STRIP:
+        case KIND_SPARKLINE:
+            return anchorRect(spec.datum, spec.x, spec.y, spec.w, spec.h);
+        default:
+            return makeRect(spec.x, spec.y, 0, 0);
+    }
+}
+
+/**
+ * @brief Bind every widget slot to its SCENE_SCREEN entry and fix its bounds
+ * 
+ * Runs once, after the fonts and the glyph cache are ready.
+ */
+static void resolveSceneLayout() {
+    for (int i = 0; i < SCENE_SCREEN.count; i++) {
+        const WidgetSpec& spec = SCENE_SCREEN.widgets[i];
+        int slots = spec.kind == KIND_BIG_NUMBER ? ROOM_GLYPHS : 1;
+        for (int slot = spec.widget; slot < spec.widget + slots && slot < WIDGET_COUNT; slot++) {
+            widgetSpecs[slot] = &spec;
+            widgetBounds[slot] = specBounds(spec, spec.text);
+        }
+    }
+}
+
 DisplayManager::DisplayManager() {
     tempData.tankTemp = 0;
     tempData.outPipeTemp = 0;
@@ -81,11 +523,31 @@ DisplayManager::DisplayManager() {
     tempData.lastHotWaterActivity = 0;
     bathReady = false;
     showingBathStatus = false;
-    showingBathImage = true;  // Start with bath image
+    rotationPage = PAGE_BATH_IMAGE;  // Start with bath image
     lastDisplayToggle = 0;
+    linkState = CircuitBreaker::CLOSED;
+    wavesVisible = false;
+    animationRunning = false;
+    lastFrameUs = 0;
+    memset(&animStats, 0, sizeof(animStats));
+    memset(drawnWidgets, 0, sizeof(drawnWidgets));
+    memset(sceneWidgets, 0, sizeof(sceneWidgets));
+    roomText[0] = '\0';
+    fullRedraw = true;
+    trendLow = 0;
+    trendHigh = 0;
+    trendPlotted = 0;
+    trendVersion = 0;
+    trendMaxText[0] = '\0';
+    trendMinText[0] = '\0';
+    backlightLevel = 200;
+    panelSleeping = false;
+    panelSleepPending = false;
+    panelSleepAt = 0;
+    memset(&renderStats, 0, sizeof(renderStats));
     previousBathReady = false;
-    minTankTemp = 52.0;
-    minOutPipeTemp = 38.0;
+    minTankTemp = 5200;
+    minOutPipeTemp = 3800;
     useCelsius = true;
     needsRedraw = true;
 }
@@ -98,8 +560,72 @@ void DisplayManager::begin(int brightness) {
     tft.setRotation(1);  // Horizontal mode (landscape)
     tft.fillScreen(TFT_BLACK);
     
+    ledcAttach(TFT_BL, 5000, 8);  // 5kHz, 8-bit resolution
+    power.activity(millis());
     setBrightness(brightness);
     
+    // Render the heat wave dots once; frames only blit them
+    for (int i = 0; i < 3; i++) {
+        waveDots[i].setColorDepth(16);
+        waveDots[i].createSprite(WAVE_DOT_SIZE, WAVE_DOT_SIZE);
+        waveDots[i].fillScreen(WAVE_DOT_TRANSPARENT);
+        waveDots[i].fillCircle(WAVE_DOT_RADIUS, WAVE_DOT_RADIUS, WAVE_DOT_RADIUS, WAVE_COLORS[i]);
+    }
+    heatStrip.setColorDepth(16);
+    heatStrip.createSprite(HEAT_STRIP_WIDTH, 172);
+    resolveSceneLayout();
+    if (!assetImage((AssetId)widgetSpecs[WIDGET_BATH_IMAGE]->asset, &bathImage)) {
+        Serial.println("Bath image asset missing");
+    }
+    bathDecoder.begin(&bathImage);
+    buildRoomGlyphs();
+    
+    const WidgetSpec& chart = *widgetSpecs[WIDGET_TREND_CHART];
+    trendChart.setColorDepth(4);
+    trendEnabled = trendChart.createSprite(chart.w, chart.h) != nullptr;
+    if (trendEnabled) {
+        trendChart.createPalette();
+        for (int i = 0; i < (int)(sizeof(TREND_PALETTE) / sizeof(TREND_PALETTE[0])); i++) {
+            trendChart.setPaletteColor(i, TREND_PALETTE[i]);
+        }
+        trendChart.fillSprite(0);
+    } else {
+        Serial.println("No memory for the trend chart, trend page disabled");
+    }
+    
+    // Without both band buffers the scene is drawn straight to the panel
+    for (int i = 0; i < 2; i++) {
+        bandStore[i].setColorDepth(16);
+    }
+    composeEnabled = bandStore[0].createSprite(SCREEN_WIDTH, BAND_ROWS) != nullptr &&
+                     bandStore[1].createSprite(SCREEN_WIDTH, BAND_ROWS) != nullptr;
+    if (!composeEnabled) {
+        bandStore[0].deleteSprite();
+        bandStore[1].deleteSprite();
+        Serial.println("No memory for band buffers, drawing scenes directly");
+    }
+    
+    // The palette scene buffer is expanded through the band buffers
+    sceneSprite.setColorDepth(SCENE_BITS);
+    paletteEnabled = composeEnabled && sceneSprite.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr;
+    if (paletteEnabled) {
+        sceneSprite.createPalette();
+        for (int i = 0; i < SCENE_COLORS; i++) {
+            sceneSprite.setPaletteColor(i, SCENE_PALETTE[i]);
+            scenePaletteSwapped[i] = (uint16_t)((SCENE_PALETTE[i] << 8) | (SCENE_PALETTE[i] >> 8));
+        }
+    } else {
+        sceneSprite.deleteSprite();
+        Serial.println("No memory for the palette scene buffer, composing all scenes in bands");
+    }
+    
+#ifdef WAVE_BENCHMARK
+    benchmarkHeatingIndicator();
+#endif
+#ifdef IMAGE_BENCHMARK
+    benchmarkBathImage();
+#endif
+    
     // LittleFS temporarily disabled due to LovyanGFX compilation issues
     // Will re-enable once library compatibility is fixed
     /*
@@ -120,43 +646,110 @@ void DisplayManager::setBrightness(int brightness) {
     if (brightness < 0) brightness = 0;
     if (brightness > 255) brightness = 255;
     
-    ledcAttach(TFT_BL, 5000, 8);  // 5kHz, 8-bit resolution
-    ledcWrite(TFT_BL, brightness);
+    backlightLevel = brightness;
+    applyPowerState(BACKLIGHT_FADE_MS);
     Serial.printf("Backlight set to %d\n", brightness);
 }
 
+/**
+ * @brief Idle times before dimming and before the panel sleeps, 0 = never
+ */
+void DisplayManager::setPowerTimeouts(unsigned long dimAfterMs, unsigned long sleepAfterMs) {
+    power.configure(dimAfterMs, sleepAfterMs);
+}
+
+/**
+ * @brief Fade the backlight from wherever it is (even mid-fade) to a level
+ */
+static void fadeBacklight(int level, unsigned long fadeMs) {
+    uint32_t current = ledcRead(TFT_BL);
+    if (current == (uint32_t)level) {
+        return;
+    }
+    if (fadeMs == 0 || !ledcFade(TFT_BL, current, level, fadeMs)) {
+        ledcWrite(TFT_BL, level);
+    }
+}
+
+/**
+ * @brief Drive backlight and panel to the current power state
+ * 
+ * The panel only enters sleep-in once the backlight has faded out
+ * (updatePower()), and leaves it before the backlight comes back.
+ */
+void DisplayManager::applyPowerState(unsigned long fadeMs) {
+    DisplayPower::State state = power.getState();
+    if (state == DisplayPower::ASLEEP) {
+        fadeBacklight(0, fadeMs);
+        panelSleepPending = true;
+        panelSleepAt = millis() + fadeMs;
+        return;
+    }
+    
+    panelSleepPending = false;
+    if (panelSleeping) {
+        tft.wakeup();
+        panelSleeping = false;
+    }
+    int level = backlightLevel;
+    if (state == DisplayPower::DIMMED) {
+        level = backlightLevel * BACKLIGHT_DIM_PERCENT / 100;
+    }
+    fadeBacklight(level, fadeMs);
+}
+
+/**
+ * @brief Follow the idle timeouts; called from refresh()
+ */
+void DisplayManager::updatePower() {
+    unsigned long now = millis();
+    if (power.update(now)) {
+        Serial.printf("Display %s\n", DisplayPower::stateName(power.getState()));
+        applyPowerState(power.getState() == DisplayPower::DIMMED ? BACKLIGHT_DIM_FADE_MS : BACKLIGHT_SLEEP_FADE_MS);
+    }
+    if (panelSleepPending && (long)(now - panelSleepAt) >= 0) {
+        tft.sleep();
+        panelSleeping = true;
+        panelSleepPending = false;
+    }
+}
+
+/**
+ * @brief Something worth looking at happened: wake the display at once
+ */
+void DisplayManager::noteActivity() {
+    if (power.activity(millis())) {
+        Serial.println("Display active");
+        applyPowerState(BACKLIGHT_WAKE_FADE_MS);
+    }
+}
+
 void DisplayManager::setTemperatureUnit(bool celsius) {
     useCelsius = celsius;
 }
 
-void DisplayManager::setThresholds(float minTank, float minOutPipe) {
+void DisplayManager::setThresholds(TempCenti minTank, TempCenti minOutPipe) {
     minTankTemp = minTank;
     minOutPipeTemp = minOutPipe;
 }
 
-float DisplayManager::convertTemp(float temp) {
+TempCenti DisplayManager::convertTemp(TempCenti temp) {
     if (useCelsius) {
         return temp;
     }
-    return (temp * 9.0 / 5.0) + 32.0;  // Convert to Fahrenheit
+    return tempToFahrenheit(temp);
 }
 
-const char* DisplayManager::getTempUnit() {
-    return useCelsius ? "C" : "F";
+/**
+ * @brief Format a temperature in the display unit, e.g. "21.5C"
+ */
+void DisplayManager::formatTemp(TempCenti temp, int decimals, char* buf, size_t size) {
+    size_t len = tempFormat(convertTemp(temp), buf, size, decimals);
+    snprintf(buf + len, size - len, "%s", getTempUnit());
 }
 
-void DisplayManager::drawHeader() {
-    // Draw room temperature in very large font at center
-    tft.setTextDatum(MC_DATUM);
-    if (tempData.roomValid) {
-        char buf[20];
-        snprintf(buf, sizeof(buf), "%.1f%s", convertTemp(tempData.roomTemp), getTempUnit());
-        tft.setTextColor(TFT_WHITE, TFT_BLACK);
-        tft.drawString(buf, 160, 86, 7);  // Font 7 is largest
-    } else {
-        tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
-        tft.drawString("--", 160, 86, 7);
-    }
+const char* DisplayManager::getTempUnit() {
+    return useCelsius ? "C" : "F";
 }
 
 void DisplayManager::drawTemperatures() {
@@ -164,163 +757,575 @@ void DisplayManager::drawTemperatures() {
     // Temperature info only shown when no bath decision yet
 }
 
-void DisplayManager::drawRoomTemperature() {
-    // Display large room temperature filling the screen
-    int centerX = 160;
-    int centerY = 86;
+void DisplayManager::drawHeatingIndicator() {
+    // Smooth wavy lines simulating heat waves rising on both sides
+    RENDER_SCENE(SCENE_HEATING);
+    int offset = waveOffset();
     
-    tft.fillScreen(TFT_BLACK);
+    const DisplayRect& left = widgetBounds[WIDGET_WAVES_LEFT];
+    composeHeatStrip(left.x, offset);
+    RENDER_DRAW(PRIM_SPRITE, left.w * left.h, heatStrip.pushSprite(&tft, left.x, left.y));
+    const DisplayRect& right = widgetBounds[WIDGET_WAVES_RIGHT];
+    composeHeatStrip(right.x, offset);
+    RENDER_DRAW(PRIM_SPRITE, right.w * right.h, heatStrip.pushSprite(&tft, right.x, right.y));
+}
+
+/**
+ * @brief Render one side strip of the heat waves into heatStrip
+ * 
+ * The strip is composed in RAM (black background, wave dots and, on the
+ * right, the link indicator it overlaps) and sent as a single window, so
+ * animation frames never flicker and never touch the main scene.
+ * 
+ * @param stripX Left edge of the strip on screen
+ * @param offset Scroll position of the waves
+ */
+void DisplayManager::composeHeatStrip(int stripX, int offset) {
+    bool rightSide = stripX > 0;
+    RENDER_DRAW(PRIM_FILL, HEAT_STRIP_WIDTH * SCREEN_HEIGHT, heatStrip.fillScreen(TFT_BLACK));
     
-    if (tempData.roomValid) {
-        // Draw extra large temperature - use setTextSize to scale up font 7
-        char buf[16];
-        float displayTemp = convertTemp(tempData.roomTemp);
-        snprintf(buf, sizeof(buf), "%.1f%s", displayTemp, getTempUnit());
-        
-        tft.setTextColor(TFT_CYAN, TFT_BLACK);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextSize(2);  // Double the size of font 7
-        tft.drawString(buf, centerX, centerY - 10, 7);
-        tft.setTextSize(1);  // Reset
+    for (int wave = 0; wave < WAVE_COUNT; wave++) {
+        int startY = (wave * WAVE_SPACING + offset) % (172 + WAVE_SPACING) - WAVE_SPACING;
         
-        // Label - bigger
-        tft.setTextColor(TFT_WHITE, TFT_BLACK);
-        tft.setTextSize(2);
-        tft.drawString("Room", centerX, centerY + 65, 4);
-        tft.setTextSize(1);
+        for (int dot = 0; dot < WAVE_DOTS; dot++) {
+            int y = startY + dot * WAVE_DOT_STEP;
+            if (y < 0) continue;
+            if (y >= 172) break;
+            
+            // Horizontal position and fade colour come from the compile-time table
+            int x = waveTable.xOffset[y + wave * WAVE_PHASE];
+            if (rightSide) x = 320 - x;
+            RENDER_DRAW(PRIM_SPRITE, WAVE_DOT_SIZE * WAVE_DOT_SIZE,
+                        waveDots[waveTable.colorIndex[dot]].pushSprite(&heatStrip, x - WAVE_DOT_RADIUS - stripX,
+                                                                       y - WAVE_DOT_RADIUS, WAVE_DOT_TRANSPARENT));
+        }
+    }
+    
+    if (rightSide && linkState != CircuitBreaker::CLOSED) {
+        LovyanGFX* scene = canvas;
+        canvas = &heatStrip;
+        paintWidget(WIDGET_LINK, stripX, 0);
+        canvas = scene;
+    }
+}
+
+/**
+ * @brief Advance the heating animation, independent of refresh()
+ * 
+ * Call on every loop() pass. Redraws only the two side strips, at most
+ * every ANIMATION_FRAME_US, and only while the current scene shows the
+ * heat waves. Frame intervals and render times feed AnimationStats.
+ */
+void DisplayManager::animate() {
+    if (!wavesVisible || power.getState() == DisplayPower::ASLEEP) {
+        animationRunning = false;
+        return;
+    }
+    
+    unsigned long now = micros();
+    if (animationRunning) {
+        unsigned long interval = now - lastFrameUs;
+        if (interval < ANIMATION_FRAME_US) {
+            return;
+        }
+        // Pacing: interval between frame starts while the animation runs
+        animStats.avgIntervalUs += ((long)interval - (long)animStats.avgIntervalUs) / 16;
+        if (interval > animStats.maxIntervalUs) {
+            animStats.maxIntervalUs = interval;
+        }
+        if (interval > ANIMATION_FRAME_US + ANIMATION_FRAME_US / 2) {
+            animStats.lateFrames++;
+        }
     } else {
-        // No room temp data yet
-        tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-        tft.setTextDatum(MC_DATUM);
-        tft.setTextSize(2);
-        tft.drawString("Waiting...", centerX, centerY, 4);
-        tft.setTextSize(1);
+        animStats.avgIntervalUs = ANIMATION_FRAME_US;
     }
+    animationRunning = true;
+    lastFrameUs = now;
+    
+    drawHeatingIndicator();
+    
+    unsigned long renderUs = micros() - now;
+    animStats.avgRenderUs += ((long)renderUs - (long)animStats.avgRenderUs) / 16;
+    animStats.frames++;
 }
 
-void DisplayManager::drawHeatingIndicator() {
-    // Draw smooth wavy lines simulating heat waves rising
-    // Much cleaner and more elegant animation
-    int offset = (millis() / 60) % 172;  // Smooth upward scroll
+#ifdef WAVE_BENCHMARK
+/**
+ * @brief Previous sin()/fillCircle() heat wave renderer, kept for comparison
+ */
+static void drawHeatingIndicatorReference() {
+    int offset = (millis() / 60) % 172;
     
-    // Draw wavy heat lines on left side
-    for (int wave = 0; wave < 3; wave++) {
-        int startY = (wave * 60 + offset) % (172 + 60) - 60;
-        
-        for (int y = startY; y < startY + 50; y += 2) {
-            if (y >= 0 && y < 172) {
-                // Create sine wave effect for horizontal position
-                int amplitude = 6;
-                int x = amplitude * sin((y + wave * 20) * 0.2) + amplitude + 2;
-                
-                // Color fades as it rises (older waves are dimmer)
-                uint16_t color;
-                float fade = (float)(y - startY) / 50.0;
-                if (fade < 0.33) color = TFT_RED;
-                else if (fade < 0.66) color = TFT_ORANGE;
-                else color = TFT_YELLOW;
-                
-                // Draw thick wavy line
-                tft.fillCircle(x, y, 3, color);
+    for (int side = 0; side < 2; side++) {
+        for (int wave = 0; wave < 3; wave++) {
+            int startY = (wave * 60 + offset) % (172 + 60) - 60;
+            
+            for (int y = startY; y < startY + 50; y += 2) {
+                if (y >= 0 && y < 172) {
+                    int amplitude = 6;
+                    int x = amplitude * sin((y + wave * 20) * 0.2) + amplitude + 2;
+                    if (side == 1) x = 320 - x;
+                    
+                    uint16_t color;
+                    float fade = (float)(y - startY) / 50.0;
+                    if (fade < 0.33) color = TFT_RED;
+                    else if (fade < 0.66) color = TFT_ORANGE;
+                    else color = TFT_YELLOW;
+                    
+                    tft.fillCircle(x, y, 3, color);
+                }
             }
         }
     }
+}
+
+/**
+ * @brief Time both heat wave renderers and print the average frame time
+ */
+void DisplayManager::benchmarkHeatingIndicator() {
+    const int FRAMES = 100;
     
-    // Draw wavy heat lines on right side (mirrored)
-    for (int wave = 0; wave < 3; wave++) {
-        int startY = (wave * 60 + offset) % (172 + 60) - 60;
-        
-        for (int y = startY; y < startY + 50; y += 2) {
-            if (y >= 0 && y < 172) {
-                int amplitude = 6;
-                int x = 320 - (amplitude * sin((y + wave * 20) * 0.2) + amplitude + 2);
-                
-                uint16_t color;
-                float fade = (float)(y - startY) / 50.0;
-                if (fade < 0.33) color = TFT_RED;
-                else if (fade < 0.66) color = TFT_ORANGE;
-                else color = TFT_YELLOW;
-                
-                tft.fillCircle(x, y, 3, color);
+    tft.fillScreen(TFT_BLACK);
+    unsigned long start = micros();
+    for (int i = 0; i < FRAMES; i++) {
+        drawHeatingIndicatorReference();
+    }
+    unsigned long referenceUs = (micros() - start) / FRAMES;
+    
+    tft.fillScreen(TFT_BLACK);
+    start = micros();
+    for (int i = 0; i < FRAMES; i++) {
+        drawHeatingIndicator();
+    }
+    unsigned long tableUs = (micros() - start) / FRAMES;
+    
+    tft.fillScreen(TFT_BLACK);
+    Serial.printf("Heat wave frame: sin/fillCircle %lu us, lookup table %lu us\n", referenceUs, tableUs);
+}
+#endif
+
+#ifdef IMAGE_BENCHMARK
+/**
+ * @brief Check the RLE bath image and time decoding and decode + push
+ * 
+ * "push only" sends the same bands without decoding, i.e. what the raw
+ * 59 KB array cost on the bus before.
+ */
+void DisplayManager::benchmarkBathImage() {
+    const RleImage& image = bathImage;
+    const int RUNS = 20;
+    
+    bathDecoder.seekRow(0);
+    uint32_t checksum = RLE_CHECKSUM_SEED;
+    for (int row = 0; row < image.height; row++) {
+        bathDecoder.decodeRow(imageLine, 0, image.width);
+        checksum = rleChecksum(checksum, imageLine, image.width);
+    }
+    
+    unsigned long start = micros();
+    for (int run = 0; run < RUNS; run++) {
+        bathDecoder.seekRow(0);
+        for (int row = 0; row < image.height; row++) {
+            bathDecoder.decodeRow(imageLine, 0, image.width);
+        }
+    }
+    unsigned long decodeUs = (micros() - start) / RUNS;
+    
+    memset(sceneWidgets, 0, sizeof(sceneWidgets));
+    sceneWidgets[WIDGET_BATH_IMAGE].visible = true;
+    sceneWidgets[WIDGET_BATH_IMAGE].bounds = widgetBounds[WIDGET_BATH_IMAGE];
+    DisplayRect rect = sceneWidgets[WIDGET_BATH_IMAGE].bounds;
+    
+    start = micros();
+    for (int run = 0; run < RUNS; run++) {
+        paintRegion(rect);
+    }
+    unsigned long paintUs = (micros() - start) / RUNS;
+    
+    unsigned long pushUs = 0;
+    if (composeEnabled) {
+        int rowsPerBand = BAND_PIXELS / rect.w;
+        start = micros();
+        for (int run = 0; run < RUNS; run++) {
+            tft.startWrite();
+            for (int y = 0; y < rect.h; y += rowsPerBand) {
+                int rows = rect.h - y < rowsPerBand ? rect.h - y : rowsPerBand;
+                tft.waitDMA();
+                tft.pushImageDMA(rect.x, y, rect.w, rows, (const lgfx::swap565_t*)bandStore[0].getBuffer());
             }
+            tft.endWrite();
         }
+        pushUs = (micros() - start) / RUNS;
     }
+    
+    memset(sceneWidgets, 0, sizeof(sceneWidgets));
+    memset(&renderStats, 0, sizeof(renderStats));
+    tft.fillScreen(TFT_BLACK);
+    Serial.printf("Bath image: RLE %lu of %lu bytes (%.1fx), checksum %s\n",
+                  (unsigned long)image.size, (unsigned long)image.width * image.height * 2,
+                  (float)image.width * image.height * 2 / image.size,
+                  checksum == image.checksum ? "ok" : "MISMATCH");
+    Serial.printf("Bath image frame: decode %lu us, decode+push %lu us, push only %lu us\n",
+                  decodeUs, paintUs, pushUs);
 }
+#endif
 
-void DisplayManager::drawStatus() {
-    // Draw large icon in center top area (landscape: 320x172)
-    int centerX = 160;
-    int centerY = 86;  // Center vertically (172/2)
+/**
+ * @brief Describe the current state as widgets (sceneWidgets)
+ * 
+ * Scenes: the STOP sign while the bath is not ready, alternating bath image
+ * and room temperature once it is, and the room temperature alone without
+ * recent hot water activity. The heat waves join the bath scenes while the
+ * heating runs; the link dot shows on all of them.
+ */
+void DisplayManager::layoutScene() {
+    memset(sceneWidgets, 0, sizeof(sceneWidgets));
     
-    if (bathReady) {
-        if (showingBathImage) {
-            // Display baby bath image from PROGMEM
-            tft.fillScreen(TFT_BLACK);
-            
-            // Image is 172x172, center it on screen (320x172)
-            int imageX = (320 - baby_bath_image_width) / 2;
-            int imageY = 0;
-            tft.pushImage(imageX, imageY, baby_bath_image_width, baby_bath_image_height, baby_bath_image);
-            
-            // Draw heating indicator - animated heat waves on sides
-            if (tempData.heatingActive) {
-                drawHeatingIndicator();
+    bool showImage = showingBathStatus && bathReady && rotationPage == PAGE_BATH_IMAGE;
+    bool showStop = showingBathStatus && !bathReady;
+    bool showTrend = !showStop && rotationPage == PAGE_TREND && trendAvailable();
+    
+    if (showImage) {
+        showWidget(WIDGET_BATH_IMAGE, 0);
+    } else if (showStop) {
+        showWidget(WIDGET_STOP_SIGN, 0);
+    } else if (showTrend) {
+        // The chart is drawn as samples arrive; here it is only placed
+        showWidget(WIDGET_TREND_CHART, trendVersion);
+        formatTemp(trendHigh, 0, trendMaxText, sizeof(trendMaxText));
+        formatTemp(trendLow, 0, trendMinText, sizeof(trendMinText));
+        showLabel(WIDGET_TREND_MAX, trendMaxText);
+        showLabel(WIDGET_TREND_MIN, trendMinText);
+        showWidget(WIDGET_TREND_TANK, 0);
+        showWidget(WIDGET_TREND_OUT_PIPE, 0);
+        showWidget(WIDGET_TREND_HEATING_IN, 0);
+        showWidget(WIDGET_TREND_SPAN, 0);
+    } else if (tempData.roomValid) {
+        // One cell per character, placed as a whole at the big number's
+        // datum; cells that keep their character and position are not redrawn
+        formatTemp(tempData.roomTemp, 1, roomText, sizeof(roomText));
+        int totalWidth = 0;
+        for (int i = 0; i < ROOM_GLYPHS && roomText[i] != '\0'; i++) {
+            int glyph = roomGlyphIndex(roomText[i]);
+            totalWidth += glyph >= 0 ? roomGlyphs[glyph].width() : 0;
+        }
+        const WidgetSpec& number = *widgetSpecs[WIDGET_ROOM_GLYPH];
+        DisplayRect run = anchorRect(number.datum, number.x, number.y, totalWidth, roomDigitHeight);
+        int x = run.x;
+        for (int i = 0; i < ROOM_GLYPHS && roomText[i] != '\0'; i++) {
+            int glyph = roomGlyphIndex(roomText[i]);
+            if (glyph < 0) {
+                continue;
             }
-        } else {
-            // Show room temperature
-            drawRoomTemperature();
-            
-            // Draw heating indicator on room temp screen too
-            if (tempData.heatingActive) {
-                drawHeatingIndicator();
+            WidgetState& cell = sceneWidgets[WIDGET_ROOM_GLYPH + i];
+            cell.visible = true;
+            cell.bounds = makeRect(x, run.y, roomGlyphs[glyph].width(), roomGlyphs[glyph].height());
+            cell.content = (uint8_t)roomText[i];
+            x += roomGlyphs[glyph].width();
+        }
+        showWidget(WIDGET_ROOM_LABEL, 0);
+    } else {
+        // No room temp data yet
+        showWidget(WIDGET_ROOM_WAITING, 0);
+    }
+    
+    // Heat waves on every bath status scene, content is animated separately
+    if (showingBathStatus && tempData.heatingActive) {
+        showWidget(WIDGET_WAVES_LEFT, 0);
+        showWidget(WIDGET_WAVES_RIGHT, 0);
+    }
+    
+    if (linkState != CircuitBreaker::CLOSED) {
+        showWidget(WIDGET_LINK, linkState);
+    }
+}
+
+/**
+ * @brief Put a fixed-bounds widget into the scene
+ * 
+ * @param content Anything its pixels depend on besides the layout entry
+ */
+void DisplayManager::showWidget(int widget, uint32_t content) {
+    sceneWidgets[widget].visible = true;
+    sceneWidgets[widget].bounds = widgetBounds[widget];
+    sceneWidgets[widget].content = content;
+}
+
+/**
+ * @brief Put a label whose text is only known at layout time into the scene
+ */
+void DisplayManager::showLabel(int widget, const char* text) {
+    // FNV-1a of the text, so a new text repaints the label
+    uint32_t hash = 2166136261u;
+    for (const char* c = text; *c != '\0'; c++) {
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    sceneWidgets[widget].visible = true;
+    sceneWidgets[widget].bounds = specBounds(*widgetSpecs[widget], text);
+    sceneWidgets[widget].content = hash;
+}
+
+/**
+ * @brief Draw one widget of the current scene into canvas
+ * 
+ * @param originX Screen x of the canvas's left edge
+ * @param originY Screen y of the canvas's top edge
+ */
+void DisplayManager::paintWidget(int widget, int originX, int originY) {
+    const WidgetSpec& spec = *widgetSpecs[widget];
+    RENDER_SCENE((RenderScene)spec.scene);
+    const char* text = spec.text;
+    uint16_t color = spec.color;
+    const DisplayRect* bounds = &widgetBounds[widget];
+    
+    if (spec.kind == KIND_BIG_NUMBER) {
+        text = &roomText[widget - spec.widget];
+        bounds = &sceneWidgets[widget].bounds;
+    } else if (widget == WIDGET_LINK) {
+        color = linkState == CircuitBreaker::OPEN ? TFT_RED : TFT_ORANGE;
+    } else if (widget == WIDGET_TREND_MAX || widget == WIDGET_TREND_MIN) {
+        text = widget == WIDGET_TREND_MAX ? trendMaxText : trendMinText;
+        bounds = &sceneWidgets[widget].bounds;
+    }
+    paintSpec(spec, *bounds, originX, originY, text, color);
+}
+
+/**
+ * @brief Draw a layout entry into canvas
+ * 
+ * @param bounds Screen rectangle of the entry (specBounds() or a big number cell)
+ * @param originX Screen x of the canvas's left edge
+ * @param originY Screen y of the canvas's top edge
+ * @param text Label or disc text; for a big number cell its character
+ * @param color Entry colour, for widgets whose colour follows state
+ */
+void DisplayManager::paintSpec(const WidgetSpec& spec, const DisplayRect& bounds, int originX, int originY,
+                               const char* text, uint16_t color) {
+    LovyanGFX& target = *canvas;
+    int x = spec.x - originX;
+    int y = spec.y - originY;
+    
+    switch (spec.kind) {
+        case KIND_LABEL:
+            target.setTextColor(ink(target, color), ink(target, spec.accent));
+            target.setTextDatum(spec.datum);
+            target.setTextSize(spec.size);
+            RENDER_DRAW(PRIM_TEXT, target.textWidth(text, spec.font) * target.fontHeight(spec.font),
+                        target.drawString(text, x, y, spec.font));
+            target.setTextSize(1);
+            break;
+        case KIND_BIG_NUMBER: {
+            // Cached font 7 glyph, the palette maps it to cyan on black
+            int glyph = roomGlyphIndex(text[0]);
+            if (glyph >= 0) {
+                RENDER_DRAW(PRIM_SPRITE, bounds.w * bounds.h,
+                            roomGlyphs[glyph].pushSprite(&target, bounds.x - originX, bounds.y - originY));
+            }
+            break;
+        }
+        case KIND_IMAGE:
+            drawRleImage(bathDecoder, bounds.x - originX, bounds.y - originY);
+            break;
+        case KIND_DISC:
+            RENDER_DRAW(PRIM_CIRCLE, renderCircleArea(spec.radius),
+                        target.fillCircle(x, y, spec.radius, ink(target, color)));
+            for (int ring = 0; ring < spec.outline; ring++) {
+                RENDER_DRAW(PRIM_CIRCLE, renderCircleOutline(spec.radius + ring),
+                            target.drawCircle(x, y, spec.radius + ring, ink(target, spec.accent)));
+            }
+            if (text != nullptr) {
+                target.setTextColor(ink(target, spec.accent), ink(target, color));
+                target.setTextDatum(MC_DATUM);
+                target.setTextSize(spec.size);
+                RENDER_DRAW(PRIM_TEXT, target.textWidth(text, spec.font) * target.fontHeight(spec.font),
+                            target.drawString(text, x, y, spec.font));
+                target.setTextSize(1);
             }
+            break;
+        case KIND_CHECK: {
+            // From (-r, 0) down to (-r/3, r) and up to (r, -2r/3); extra
+            // strokes alternate one pixel below and above
+            int r = spec.radius;
+            for (int stroke = 0; stroke < spec.outline; stroke++) {
+                int dy = (stroke + 1) / 2 * (stroke % 2 ? 1 : -1);
+                RENDER_DRAW(PRIM_LINE, renderLinePixels(x - r, y + dy, x - r / 3, y + r + dy),
+                            target.drawLine(x - r, y + dy, x - r / 3, y + r + dy, ink(target, color)));
+                RENDER_DRAW(PRIM_LINE, renderLinePixels(x - r / 3, y + r + dy, x + r, y - 2 * r / 3 + dy),
+                            target.drawLine(x - r / 3, y + r + dy, x + r, y - 2 * r / 3 + dy, ink(target, color)));
+            }
+            break;
         }
+        case KIND_STRIP:
+            composeHeatStrip(bounds.x, waveOffset());
+            RENDER_DRAW(PRIM_SPRITE, bounds.w * bounds.h,
+                        heatStrip.pushSprite(&target, bounds.x - originX, bounds.y - originY));
+            break;
+        case KIND_SPARKLINE:
+            RENDER_DRAW(PRIM_SPRITE, bounds.w * bounds.h,
+                        trendChart.pushSprite(&target, bounds.x - originX, bounds.y - originY));
+            break;
+    }
+}
+
+/**
+ * @brief Repaint one dirty rectangle: background, then every widget touching it
+ */
+void DisplayManager::paintRegion(const DisplayRect& rect) {
+    if (sceneFitsPalette()) {
+        paletteRegion(rect);
+    } else if (composeEnabled) {
+        composeRegion(rect);
     } else {
-        // Draw large octagon stop sign centered on screen
-        // Screen is 320x172, make circle smaller to fit with margin
-        int size = 80;  // Reduced radius to prevent bottom cutoff
-        int stopY = 86;  // Exact vertical center (172/2)
-        tft.fillCircle(centerX, stopY, size, TFT_RED);
-        tft.drawCircle(centerX, stopY, size, TFT_WHITE);
-        tft.drawCircle(centerX, stopY, size + 1, TFT_WHITE);
-        tft.drawCircle(centerX, stopY, size + 2, TFT_WHITE);
+        drawRegion(rect);
+    }
+}
+
+/**
+ * @return True if the scene can be composed in the palette buffer
+ * 
+ * The bath image and the heat waves need full RGB565 and the trend chart
+ * has a palette of its own; everything else sticks to SCENE_PALETTE.
+ */
+bool DisplayManager::sceneFitsPalette() const {
+    return paletteEnabled && !sceneWidgets[WIDGET_BATH_IMAGE].visible &&
+           !sceneWidgets[WIDGET_WAVES_LEFT].visible && !sceneWidgets[WIDGET_WAVES_RIGHT].visible &&
+           !sceneWidgets[WIDGET_TREND_CHART].visible;
+}
+
+/**
+ * @brief Compose a rectangle in the palette buffer, then push it expanded
+ * 
+ * Unlike band composition, every widget is drawn once per rectangle rather
+ * than once per band it touches.
+ */
+void DisplayManager::paletteRegion(const DisplayRect& rect) {
+    canvas = &sceneSprite;
+    sceneSprite.setClipRect(rect.x, rect.y, rect.w, rect.h);
+    RENDER_DRAW(PRIM_FILL, rect.w * rect.h,
+                sceneSprite.fillRect(rect.x, rect.y, rect.w, rect.h, ink(sceneSprite, SCENE_SCREEN.background)));
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        if (sceneWidgets[i].visible && rectsOverlap(sceneWidgets[i].bounds, rect)) {
+            paintWidget(i, 0, 0);
+        }
+    }
+    sceneSprite.clearClipRect();
+    canvas = &tft;
+    
+    renderStats.lastTransfers += pushSceneRect(rect);
+    renderStats.lastBytes += (unsigned long)rect.w * rect.h * 2;
+}
+
+/**
+ * @brief Compose a rectangle off-screen, band by band, and push it with DMA
+ * 
+ * Each band is rendered completely in RAM and sent as one window, so the
+ * panel never shows a half-drawn widget and a band costs one SPI
+ * transaction instead of one per primitive. The two buffers alternate:
+ * while one band is on the wire, the CPU renders the next into the other.
+ * Narrow rectangles get taller bands from the same buffer.
+ */
+void DisplayManager::composeRegion(const DisplayRect& rect) {
+    int rowsPerBand = BAND_PIXELS / rect.w;
+    int flip = 0;
+    
+    tft.startWrite();
+    for (int y = rect.y; y < rect.y + rect.h; y += rowsPerBand) {
+        int rows = rect.y + rect.h - y;
+        if (rows > rowsPerBand) rows = rowsPerBand;
+        DisplayRect bandRect = { rect.x, (int16_t)y, rect.w, (int16_t)rows };
         
-        // Draw STOP text - font 4 with proper centering
-        tft.setTextColor(TFT_WHITE, TFT_RED);
-        tft.setTextDatum(MC_DATUM);  // Middle center alignment
-        tft.setTextSize(2);  // Double size
-        tft.drawString("STOP", centerX, stopY, 4);  // Use stopY (86) for perfect centering
-        tft.setTextSize(1);  // Reset
+        bandView.setBuffer(bandStore[flip].getBuffer(), rect.w, rows, 16);
+        RENDER_DRAW(PRIM_FILL, rect.w * rows, bandView.fillSprite(SCENE_SCREEN.background));
+        canvas = &bandView;
+        for (int i = 0; i < WIDGET_COUNT; i++) {
+            if (sceneWidgets[i].visible && rectsOverlap(sceneWidgets[i].bounds, bandRect)) {
+                paintWidget(i, rect.x, y);
+            }
+        }
+        canvas = &tft;
         
-        // Draw heating indicator even when not ready - show heating progress
-        if (tempData.heatingActive) {
-            drawHeatingIndicator();
+        // The previous band must be out before the bus takes the next one
+        RENDER_DRAW(PRIM_PANEL_PUSH, rect.w * rows,
+                    tft.waitDMA();
+                    tft.pushImageDMA(rect.x, y, rect.w, rows, (const lgfx::swap565_t*)bandStore[flip].getBuffer()));
+        renderStats.lastBytes += (unsigned long)rect.w * rows * 2;
+        renderStats.lastTransfers++;
+        flip ^= 1;
+    }
+    tft.endWrite();  // Waits for the last band
+}
+
+/**
+ * @brief Fallback without band buffers: draw the rectangle on the panel
+ * 
+ * Drawing is clipped to the rectangle, so the panel only receives its
+ * pixels. SPI traffic is estimated as 2 bytes per pixel for the background
+ * fill (skipped when an opaque widget covers the rectangle) plus each
+ * widget's overlap with the rectangle, one transaction per widget.
+ */
+void DisplayManager::drawRegion(const DisplayRect& rect) {
+    unsigned long pixels = 0;
+    bool covered = false;
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        if (sceneWidgets[i].visible && widgetIsOpaque(i) && rectContains(sceneWidgets[i].bounds, rect)) {
+            covered = true;
         }
     }
+    
+    tft.setClipRect(rect.x, rect.y, rect.w, rect.h);
+    if (!covered) {
+        RENDER_DRAW(PRIM_FILL, rect.w * rect.h, tft.fillRect(rect.x, rect.y, rect.w, rect.h, SCENE_SCREEN.background));
+        pixels += (unsigned long)rect.w * rect.h;
+        renderStats.lastTransfers++;
+    }
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        if (sceneWidgets[i].visible && rectsOverlap(sceneWidgets[i].bounds, rect)) {
+            paintWidget(i, 0, 0);
+            pixels += overlapArea(sceneWidgets[i].bounds, rect);
+            renderStats.lastTransfers++;
+        }
+    }
+    tft.clearClipRect();
+    
+    renderStats.lastBytes += pixels * 2;
 }
 
-void DisplayManager::updateTemperature(int sensor, float value) {
+/**
+ * @brief Forget what the panel shows; the next refresh() repaints everything
+ * 
+ * Used by the full-screen status pages that draw outside the widget model.
+ */
+void DisplayManager::invalidate() {
+    fullRedraw = true;
+    needsRedraw = true;
+    wavesVisible = false;  // Keep the animation off the status page
+}
+
+/**
+ * @brief Feed a new reading for a sensor role (SensorRole)
+ */
+void DisplayManager::updateTemperature(uint8_t role, TempCenti value) {
     unsigned long now = millis();
     bool changed = false;
     bool wasBathReady = bathReady;
     
-    switch (sensor) {
-        case 0: // Tank
+    switch (role) {
+        case ROLE_TANK:
             // Check for significant change
-            if (abs(tempData.tankTemp - value) > 0.1) {
+            if (tempAbs(tempData.tankTemp - value) > TEMP_CHANGE_MIN) {
                 changed = true;
                 tempData.lastHotWaterActivity = now;  // Activity detected
             }
             
             // Detect if tank temperature is dropping (water is flowing)
             if (tempData.tankValid && now - tempData.lastTankUpdate > 10000) { // Check every 10+ seconds
-                float tempDiff = value - tempData.previousTankTemp;
+                TempCenti tempDiff = value - tempData.previousTankTemp;
                 // Tank is dropping if temp decreased by more than 0.3°C
-                if (tempDiff < -0.3) {
+                if (tempDiff < -30) {
                     tempData.tankDropping = true;
                     changed = true;
                     tempData.lastHotWaterActivity = now;  // Activity detected
-                } else if (tempDiff > 0.5) {
+                } else if (tempDiff > 50) {
                     // Tank is heating up again, reset dropping state
                     tempData.tankDropping = false;
                     changed = true;
@@ -334,27 +1339,30 @@ void DisplayManager::updateTemperature(int sensor, float value) {
             tempData.tankValid = true;
             tempData.lastTankUpdate = now;
             break;
-        case 1: // Out Pipe
-            if (abs(tempData.outPipeTemp - value) > 0.1) {
+        case ROLE_OUT_PIPE:
+            if (tempAbs(tempData.outPipeTemp - value) > TEMP_CHANGE_MIN) {
                 changed = true;
                 tempData.lastHotWaterActivity = now;  // Activity detected
             }
             tempData.outPipeTemp = value;
             tempData.outPipeValid = true;
             break;
-        case 2: // Heating In
-            if (abs(tempData.heatingInTemp - value) > 0.1) {
+        case ROLE_HEATING_IN:
+            if (tempAbs(tempData.heatingInTemp - value) > TEMP_CHANGE_MIN) {
                 changed = true;
                 tempData.lastHotWaterActivity = now;  // Activity detected
             }
             tempData.heatingInTemp = value;
             tempData.heatingInValid = true;
             break;
-        case 3: // Room
-            if (abs(tempData.roomTemp - value) > 0.1) changed = true;
+        case ROLE_ROOM:
+            if (tempAbs(tempData.roomTemp - value) > TEMP_CHANGE_MIN) changed = true;
             tempData.roomTemp = value;
             tempData.roomValid = true;
             break;
+        default:
+            // Roles without a place on screen (return pipe, other)
+            return;
     }
     tempData.lastUpdate = now;
     
@@ -372,7 +1380,7 @@ void DisplayManager::updateTemperature(int sensor, float value) {
         // or pipe cools down significantly
         if (bathReady) {
             // Stay ready unless tank gets too cold or pipe drops too much
-            bathReady = tankHot && tempData.outPipeTemp >= (minOutPipeTemp - 2.0);
+            bathReady = tankHot && tempData.outPipeTemp >= (minOutPipeTemp - 2 * TEMP_ONE_DEGREE);
         } else {
             // Become ready when tank is hot, water is flowing, and pipe is warm
             bathReady = tankHot && waterFlowing && pipeWarm;
@@ -393,13 +1401,19 @@ void DisplayManager::updateTemperature(int sensor, float value) {
         showingBathStatus = shouldShowBathStatus;
         needsRedraw = true;
     }
+    
+    // Hot water in use: keep the display awake, or wake it
+    if (shouldShowBathStatus) {
+        noteActivity();
+    }
 }
 
 void DisplayManager::updateBathStatus(bool ready) {
     if (ready && !bathReady) {
         // Just became ready - reset toggle to show bath image first
-        showingBathImage = true;
+        rotationPage = PAGE_BATH_IMAGE;
         lastDisplayToggle = millis();
+        noteActivity();
     }
     if (bathReady != ready) {
         needsRedraw = true;
@@ -414,89 +1428,240 @@ void DisplayManager::updateHeatingStatus(bool active) {
     tempData.heatingActive = active;
 }
 
-void DisplayManager::showConfigMode() {
-    tft.fillScreen(TFT_NAVY);
-    
-    // For horizontal display (320x172)
-    int centerX = 160;
-    int centerY = 70;
+void DisplayManager::updateLinkStatus(CircuitBreaker::State state) {
+    if (linkState != state) {
+        needsRedraw = true;
+    }
+    linkState = state;
+}
+
+/**
+ * @brief Record one trend sample (tank, out pipe, heating inlet)
+ * 
+ * Call every TREND_INTERVAL_MS. The chart scrolls by one column and only
+ * the new column is drawn; it is redrawn as a whole only when a value falls
+ * outside the current range or a sample was missed.
+ * 
+ * @param values Centi-degrees per TrendSeries, TEMP_INVALID without a reading
+ */
+void DisplayManager::addTrendSample(const TempCenti values[TREND_SERIES]) {
+    trend.add(values);
+    if (!trendEnabled) {
+        return;
+    }
+    RENDER_SCENE(SCENE_TREND);
     
-    // Draw gear icon
-    tft.fillCircle(centerX, centerY, 40, TFT_ORANGE);
-    tft.fillCircle(centerX, centerY, 25, TFT_NAVY);
+    const TrendSample& sample = trend.get(0);
+    bool inRange = trendHigh > trendLow;
+    for (int i = 0; i < TREND_SERIES; i++) {
+        int16_t value = sample.values[i];
+        if (value != TREND_NONE && (value < trendLow || value > trendHigh)) {
+            inRange = false;
+        }
+    }
     
-    // Draw config text at bottom
-    tft.setTextColor(TFT_WHITE, TFT_NAVY);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("CONFIG MODE", centerX, 128, 4);
-    tft.setTextDatum(BC_DATUM);
-    tft.drawString("Connect to: Water-Status-AP", centerX, 165, 2);
+    if (inRange && trendPlotted + 1 == trend.getAdded()) {
+        // Scroll one pixel left: 4 bpp rows, two pixels per byte, leftmost
+        // pixel in the high nibble
+        int width = trendChart.width();
+        int stride = (width * 4 + 7) / 8;
+        uint8_t* row = (uint8_t*)trendChart.getBuffer();
+        for (int y = 0; y < trendChart.height(); y++, row += stride) {
+            for (int i = 0; i < stride - 1; i++) {
+                row[i] = (uint8_t)((row[i] << 4) | (row[i + 1] >> 4));
+            }
+            row[stride - 1] = (uint8_t)(row[stride - 1] << 4);
+        }
+        plotTrendColumn(width - 1, trend.getCount() > 1 ? &trend.get(1) : nullptr, sample);
+        trendPlotted = trend.getAdded();
+    } else {
+        rebuildTrendChart();
+    }
+    trendVersion++;
+    needsRedraw = true;
 }
 
-void DisplayManager::showIPAddress(IPAddress ip) {
-    tft.fillScreen(TFT_DARKGREEN);
-    
-    int centerX = 160;
-    int centerY = 70;
+/**
+ * @brief Chart row of a temperature in the current range
+ */
+int DisplayManager::trendRow(TempCenti value) const {
+    int bottom = trendChart.height() - 1;
+    return bottom - (int)((value - trendLow) * bottom / (trendHigh - trendLow));
+}
+
+/**
+ * @brief Draw one chart column: background, grid, then each series as a
+ * vertical segment from the previous sample's row to this one's
+ */
+void DisplayManager::plotTrendColumn(int x, const TrendSample* previous, const TrendSample& sample) {
+    int height = trendChart.height();
+    RENDER_DRAW(PRIM_FILL, height, trendChart.fillRect(x, 0, 1, height, 0));
+    for (int line = 1; line < TREND_GRID_LINES; line++) {
+        RENDER_DRAW(PRIM_LINE, 1, trendChart.drawPixel(x, (height - 1) * line / TREND_GRID_LINES, TREND_GRID));
+    }
     
-    // Draw checkmark circle
-    tft.fillCircle(centerX, centerY, 40, TFT_GREEN);
-    tft.fillCircle(centerX, centerY, 35, TFT_DARKGREEN);
+    for (int i = 0; i < TREND_SERIES; i++) {
+        if (sample.values[i] == TREND_NONE) {
+            continue;
+        }
+        int y = trendRow(sample.values[i]);
+        int from = previous != nullptr && previous->values[i] != TREND_NONE ? trendRow(previous->values[i]) : y;
+        int top = minInt(y, from);
+        RENDER_DRAW(PRIM_LINE, maxInt(y, from) - top + 1,
+                    trendChart.fillRect(x, top, 1, maxInt(y, from) - top + 1, TREND_FIRST_SERIES + i));
+    }
+}
+
+/**
+ * @brief Fit the range to the whole history and redraw every column
+ * 
+ * The newest sample goes in the rightmost column; columns without a sample
+ * yet stay empty.
+ */
+void DisplayManager::rebuildTrendChart() {
+    TempCenti low = INT32_MAX;
+    TempCenti high = INT32_MIN;
+    for (int age = 0; age < trend.getCount(); age++) {
+        const TrendSample& sample = trend.get(age);
+        for (int i = 0; i < TREND_SERIES; i++) {
+            if (sample.values[i] != TREND_NONE) {
+                low = minInt(low, sample.values[i]);
+                high = maxInt(high, sample.values[i]);
+            }
+        }
+    }
+    if (low > high) {
+        low = 20 * TEMP_ONE_DEGREE;
+        high = 60 * TEMP_ONE_DEGREE;
+    }
     
-    // Draw checkmark
-    tft.drawLine(centerX - 15, centerY, centerX - 5, centerY + 15, TFT_GREEN);
-    tft.drawLine(centerX - 5, centerY + 15, centerX + 15, centerY - 10, TFT_GREEN);
-    tft.drawLine(centerX - 15, centerY + 1, centerX - 5, centerY + 16, TFT_GREEN);
-    tft.drawLine(centerX - 5, centerY + 16, centerX + 15, centerY - 9, TFT_GREEN);
-    tft.drawLine(centerX - 15, centerY - 1, centerX - 5, centerY + 14, TFT_GREEN);
-    tft.drawLine(centerX - 5, centerY + 14, centerX + 15, centerY - 11, TFT_GREEN);
+    // Whole TREND_STEP multiples around the data, at least TREND_MIN_RANGE
+    trendLow = low >= 0 ? low / TREND_STEP * TREND_STEP : -((-low + TREND_STEP - 1) / TREND_STEP * TREND_STEP);
+    trendHigh = trendLow + (high - trendLow + TREND_STEP - 1) / TREND_STEP * TREND_STEP;
+    if (trendHigh - trendLow < TREND_MIN_RANGE) {
+        trendHigh = trendLow + TREND_MIN_RANGE;
+    }
     
-    // Display IP address
-    tft.setTextColor(TFT_WHITE, TFT_DARKGREEN);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("WiFi Connected!", centerX, 128, 4);
+    int width = trendChart.width();
+    int columns = minInt(trend.getCount(), width);
+    RENDER_DRAW(PRIM_FILL, width * trendChart.height(), trendChart.fillSprite(0));
+    for (int age = columns - 1; age >= 0; age--) {
+        const TrendSample* previous = age + 1 < trend.getCount() ? &trend.get(age + 1) : nullptr;
+        plotTrendColumn(width - 1 - age, previous, trend.get(age));
+    }
+    trendPlotted = trend.getAdded();
+}
+
+bool DisplayManager::trendAvailable() const {
+    return trendEnabled && trend.getCount() >= 2;
+}
+
+/**
+ * @brief Page after the current one; the trend page only once it has data
+ */
+RotationPage DisplayManager::nextRotationPage() const {
+    switch (rotationPage) {
+        case PAGE_BATH_IMAGE:
+            return PAGE_ROOM;
+        case PAGE_ROOM:
+            if (trendAvailable()) {
+                return PAGE_TREND;
+            }
+            return showingBathStatus ? PAGE_BATH_IMAGE : PAGE_ROOM;
+        default:
+            return showingBathStatus ? PAGE_BATH_IMAGE : PAGE_ROOM;
+    }
+}
+
+/**
+ * @brief How long the current page stays up
+ */
+unsigned long DisplayManager::rotationPageTime() const {
+    switch (rotationPage) {
+        case PAGE_BATH_IMAGE:
+            return showingBathStatus ? BATH_IMAGE_DISPLAY_TIME : 0;   // Not shown: move on
+        case PAGE_TREND:
+            return TREND_DISPLAY_TIME;
+        default:
+            return showingBathStatus ? ROOM_TEMP_DISPLAY_TIME : ROOM_IDLE_DISPLAY_TIME;
+    }
+}
+
+
+/**
+ * @brief Where the full-screen status pages draw
+ * 
+ * The palette buffer when there is one, so a page reaches the panel in one
+ * piece (finishPage()) instead of primitive by primitive.
+ */
+static LovyanGFX& pageCanvas() {
+    if (paletteEnabled) {
+        return sceneSprite;
+    }
+    return tft;
+}
+
+static void finishPage() {
+    if (paletteEnabled) {
+        pushSceneRect(makeRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
+    }
+}
+
+/**
+ * @brief Draw a full-screen status page from its layout table
+ * 
+ * @param text Text of the labels without fixed text (the IP address)
+ */
+void DisplayManager::paintPage(const ScreenLayout& layout, const char* text) {
+    RENDER_SCENE(SCENE_STATUS_PAGE);
+    LovyanGFX& page = pageCanvas();
+    RENDER_DRAW(PRIM_FILL, SCREEN_WIDTH * SCREEN_HEIGHT, page.fillScreen(ink(page, layout.background)));
     
+    canvas = &page;
+    for (int i = 0; i < layout.count; i++) {
+        const WidgetSpec& spec = layout.widgets[i];
+        const char* entryText = spec.kind == KIND_LABEL && spec.text == nullptr ? text : spec.text;
+        paintSpec(spec, specBounds(spec, entryText), 0, 0, entryText, spec.color);
+    }
+    canvas = &tft;
+    finishPage();
+}
+
+void DisplayManager::showConfigMode() {
+    noteActivity();
+    invalidate();
+    paintPage(CONFIG_SCREEN, nullptr);
+}
+
+void DisplayManager::showIPAddress(IPAddress ip) {
+    noteActivity();
+    invalidate();
     char ipStr[20];
     sprintf(ipStr, "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
-    tft.setTextDatum(BC_DATUM);
-    tft.drawString(ipStr, centerX, 165, 4);
+    paintPage(WIFI_SCREEN, ipStr);
 }
 
 void DisplayManager::showStartupScreen(IPAddress ip) {
-    tft.fillScreen(TFT_DARKGREEN);
-    
-    int centerX = 160;
-    
-    // Draw checkmark circle
-    tft.fillCircle(centerX, 60, 40, TFT_GREEN);
-    tft.drawCircle(centerX, 60, 40, TFT_WHITE);
-    
-    // Draw checkmark
-    tft.drawLine(centerX - 15, 60, centerX - 5, 75, TFT_WHITE);
-    tft.drawLine(centerX - 5, 75, centerX + 15, 50, TFT_WHITE);
-    tft.drawLine(centerX - 15, 61, centerX - 5, 76, TFT_WHITE);
-    tft.drawLine(centerX - 5, 76, centerX + 15, 51, TFT_WHITE);
-    
-    // Display IP address
-    tft.setTextColor(TFT_WHITE, TFT_DARKGREEN);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("WiFi Connected!", centerX, 120, 4);
-    
+    noteActivity();
+    invalidate();
     char ipStr[20];
     sprintf(ipStr, "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
-    tft.setTextDatum(BC_DATUM);
-    tft.drawString(ipStr, centerX, 160, 4);
+    paintPage(STARTUP_SCREEN, ipStr);
 }
 
 void DisplayManager::refresh() {
-    // Check if we need to toggle bath/room display when bath is ready
-    if (bathReady && showingBathStatus) {
+    // Nothing is drawn while the panel sleeps; changes wait for the wakeup
+    updatePower();
+    if (power.getState() == DisplayPower::ASLEEP) {
+        return;
+    }
+    
+    // Rotate pages, except while the STOP sign is up
+    if (bathReady || !showingBathStatus) {
         unsigned long now = millis();
-        unsigned long toggleInterval = showingBathImage ? BATH_IMAGE_DISPLAY_TIME : ROOM_TEMP_DISPLAY_TIME;
-        
-        if (now - lastDisplayToggle > toggleInterval) {
+        if (now - lastDisplayToggle > rotationPageTime()) {
             lastDisplayToggle = now;
-            showingBathImage = !showingBathImage;
+            rotationPage = nextRotationPage();
             needsRedraw = true;
         }
     }
@@ -506,17 +1671,56 @@ void DisplayManager::refresh() {
         return;
     }
     
-    tft.fillScreen(TFT_BLACK);
-    drawHeader();
-    
     // Show bath status only if there's recent hot water activity
     // Otherwise show room temperature
-    if (showingBathStatus) {
-        drawStatus();
+    layoutScene();
+    
+    // Collect the old and new bounds of every widget that changed
+    DisplayRect dirty[MAX_DIRTY_RECTS];
+    int dirtyCount = 0;
+    if (fullRedraw) {
+        addDirtyRect(dirty, dirtyCount, makeRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
     } else {
-        drawRoomTemperature();
+        for (int i = 0; i < WIDGET_COUNT; i++) {
+            const WidgetState& was = drawnWidgets[i];
+            const WidgetState& now = sceneWidgets[i];
+            if (was.visible == now.visible &&
+                (!now.visible || (was.content == now.content && sameRect(was.bounds, now.bounds)))) {
+                continue;
+            }
+            if (was.visible) {
+                addDirtyRect(dirty, dirtyCount, was.bounds);
+            }
+            if (now.visible) {
+                addDirtyRect(dirty, dirtyCount, now.bounds);
+            }
+        }
+    }
+    
+    renderStats.lastBytes = 0;
+    renderStats.lastTransfers = 0;
+    for (int i = 0; i < dirtyCount; i++) {
+        paintRegion(dirty[i]);
+    }
+    renderStats.lastRects = dirtyCount;
+    if (dirtyCount > 0) {
+        if (renderStats.frames == 0) {
+            renderStats.avgBytes = renderStats.lastBytes;
+        } else {
+            renderStats.avgBytes += ((long)renderStats.lastBytes - (long)renderStats.avgBytes) / 16;
+        }
+        renderStats.frames++;
+        if (fullRedraw) {
+            renderStats.fullFrames++;
+        }
+        if (sceneFitsPalette()) {
+            renderStats.paletteFrames++;
+        }
     }
     
+    memcpy(drawnWidgets, sceneWidgets, sizeof(drawnWidgets));
+    wavesVisible = sceneWidgets[WIDGET_WAVES_LEFT].visible;
+    fullRedraw = false;
     needsRedraw = false;
 }
 
@@ -565,27 +1769,27 @@ void DisplayManager::drawBathtubIcon(int x, int y, int size, bool ready) {
 }
 
 void DisplayManager::drawThermometerBar(int x, int y, int width, int height, 
-                                        float temp, float minTemp, float maxTemp, uint16_t color) {
+                                        TempCenti temp, TempCenti minTemp, TempCenti maxTemp, uint16_t color) {
     // Draw border
     tft.drawRect(x, y, width, height, TFT_WHITE);
     
     // Calculate fill percentage
-    float percent = (temp - minTemp) / (maxTemp - minTemp);
+    int percent = (int)((temp - minTemp) * 100 / (maxTemp - minTemp));
     if (percent < 0) percent = 0;
-    if (percent > 1) percent = 1;
+    if (percent > 100) percent = 100;
     
     // Draw background
     tft.fillRect(x + 2, y + 2, width - 4, height - 4, TFT_BLACK);
     
     // Draw filled portion (from bottom up like mercury)
-    int fillHeight = (height - 4) * percent;
+    int fillHeight = (height - 4) * percent / 100;
     int fillY = y + height - 2 - fillHeight;
     
     // Color intensity based on temperature
     uint16_t fillColor = color;
-    if (percent < 0.3) {
+    if (percent < 30) {
         fillColor = TFT_BLUE; // Cold
-    } else if (percent > 0.7) {
+    } else if (percent > 70) {
         fillColor = TFT_RED; // Hot
     }
     
@@ -593,7 +1797,7 @@ void DisplayManager::drawThermometerBar(int x, int y, int width, int height,
     
     // Draw temperature number on top
     char buf[8];
-    snprintf(buf, sizeof(buf), "%.0f", convertTemp(temp));
+    tempFormat(convertTemp(temp), buf, sizeof(buf), 0);
     tft.setTextColor(TFT_WHITE, color);
     tft.setTextDatum(MC_DATUM);
     tft.setTextSize(1);
@@ -0,0 +1,83 @@
+#include "display_power.h"
+
+DisplayPower::DisplayPower() {
+    state = ACTIVE;
+    dimAfterMs = 0;
+    sleepAfterMs = 0;
+    lastActivity = 0;
+    stateSince = 0;
+    for (int i = 0; i < STATE_COUNT; i++) {
+        totalMs[i] = 0;
+    }
+    wakeups = 0;
+}
+
+void DisplayPower::configure(unsigned long dimAfter, unsigned long sleepAfter) {
+    dimAfterMs = dimAfter;
+    sleepAfterMs = sleepAfter;
+}
+
+void DisplayPower::enter(State next, unsigned long now) {
+    totalMs[state] += now - stateSince;
+    stateSince = now;
+    if (next == ACTIVE) {
+        wakeups++;
+    }
+    state = next;
+}
+
+/**
+ * @brief Note activity: restart the idle time and wake up
+ *
+ * @return True if the state changed (the display was dimmed or asleep)
+ */
+bool DisplayPower::activity(unsigned long now) {
+    lastActivity = now;
+    if (state == ACTIVE) {
+        return false;
+    }
+    enter(ACTIVE, now);
+    return true;
+}
+
+/**
+ * @brief Move to the state the idle time calls for
+ *
+ * Also undoes a state whose timeout was raised or disabled since.
+ *
+ * @return True if the state changed
+ */
+bool DisplayPower::update(unsigned long now) {
+    unsigned long idle = now - lastActivity;
+    State target = ACTIVE;
+    if (sleepAfterMs > 0 && idle >= sleepAfterMs) {
+        target = ASLEEP;
+    } else if (dimAfterMs > 0 && idle >= dimAfterMs) {
+        target = DIMMED;
+    }
+    if (target == state) {
+        return false;
+    }
+    enter(target, now);
+    return true;
+}
+
+/**
+ * @brief Total time in a state since boot, including the current period
+ */
+unsigned long DisplayPower::getSecondsIn(State s, unsigned long now) const {
+    uint64_t ms = totalMs[s];
+    if (s == state) {
+        ms += now - stateSince;
+    }
+    return (unsigned long)(ms / 1000);
+}
+
+const char* DisplayPower::stateName(State s) {
+    switch (s) {
+        case ACTIVE: return "active";
+        case DIMMED: return "dimmed";
+        case ASLEEP: return "asleep";
+        default: return "unknown";
+    }
+}
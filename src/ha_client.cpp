@@ -0,0 +1,655 @@
+#include "ha_client.h"
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <errno.h>
+
+// Per-request budget from connect to last body byte
+const unsigned long HA_REQUEST_TIMEOUT = 5000;
+
+// Circuit breaker: 3 failed requests in a row pause polling for 10 s,
+// doubling per failed retry up to 5 minutes
+const int HA_FAILURE_THRESHOLD = 3;
+const unsigned long HA_BACKOFF_BASE = 10000;
+const unsigned long HA_BACKOFF_MAX = 300000;
+
+HAClient::HAClient() : breaker("HA REST", HA_FAILURE_THRESHOLD, HA_BACKOFF_BASE, HA_BACKOFF_MAX) {
+    phase = PHASE_IDLE;
+    entityIndex = -1;
+    batched = false;
+    pollStart = 0;
+    pollDurationMs = 0;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        values[i] = TEMP_INVALID;
+        entities[i][0] = '\0';
+    }
+    token[0] = '\0';
+    port = 0;
+    secure = false;
+    hostIp = 0;
+    memset(&stats, 0, sizeof(stats));
+
+    reqState = REQ_IDLE;
+    sock = -1;
+    reqDeadline = 0;
+    sent = 0;
+    statusCode = 0;
+    contentLength = -1;
+    bodyRead = 0;
+    chunked = false;
+    keepAlive = false;
+    reusedConnection = false;
+    lineLen = 0;
+    bodyLen = 0;
+    parseState = false;
+}
+
+HAClient::~HAClient() {
+    closeSocket();
+}
+
+/**
+ * @brief Split an HA base URL into host, port, scheme and path prefix
+ *
+ * Accepts http(s)://host[:port][/prefix]. Any trailing slash is dropped from
+ * the prefix so "/api/..." can be appended directly.
+ */
+bool HAClient::parseUrl(const char* url, String& host, uint16_t& port, bool& secure, String& basePath) {
+    String s(url);
+    if (s.startsWith("https://")) {
+        secure = true;
+        port = 443;
+        s = s.substring(8);
+    } else if (s.startsWith("http://")) {
+        secure = false;
+        port = 80;
+        s = s.substring(7);
+    } else {
+        return false;
+    }
+
+    basePath = "";
+    int slash = s.indexOf('/');
+    if (slash >= 0) {
+        basePath = s.substring(slash);
+        s = s.substring(0, slash);
+        while (basePath.endsWith("/")) {
+            basePath = basePath.substring(0, basePath.length() - 1);
+        }
+    }
+
+    int colon = s.indexOf(':');
+    if (colon >= 0) {
+        port = s.substring(colon + 1).toInt();
+        s = s.substring(0, colon);
+    }
+
+    host = s;
+    return host.length() > 0 && port > 0;
+}
+
+/**
+ * @brief Build the /api/template request body for a batch read
+ *
+ * Renders "[{{ states('a') }},...]" for every non-empty entity ID. States
+ * are left as text so tempParse() sees the same input as with a state GET;
+ * "unavailable" stays recognisable instead of turning into a 0.0 reading.
+ * Returns an empty string if no entity is configured.
+ */
+String HAClient::buildBatchTemplate(const char* const entityIds[], int count) {
+    String templateBody = "{\"template\":\"[";
+    int requested = 0;
+    for (int i = 0; i < count; i++) {
+        if (strlen(entityIds[i]) == 0) {
+            continue;
+        }
+        if (requested > 0) templateBody += ",";
+        templateBody += "{{ states('";
+        templateBody += entityIds[i];
+        templateBody += "') }}";
+        requested++;
+    }
+    templateBody += "]\"}";
+    return requested > 0 ? templateBody : String("");
+}
+
+/**
+ * @brief Parse the rendered batch template, e.g. "[54.25, 38.1, unavailable, 21.5]"
+ *
+ * Values are assigned in order to the non-empty entity IDs; empty slots and
+ * non-numeric states are set to TEMP_INVALID. Returns false unless there
+ * was one list element per entity.
+ */
+bool HAClient::parseBatchValues(const char* text, const char* const entityIds[], TempCenti values[], int count) {
+    for (int i = 0; i < count; i++) {
+        values[i] = TEMP_INVALID;
+    }
+
+    const char* p = strchr(text, '[');
+    if (p == nullptr) {
+        return false;
+    }
+    p++;
+
+    for (int i = 0; i < count; i++) {
+        if (strlen(entityIds[i]) == 0) {
+            continue;
+        }
+        if (*p == '\0' || *p == ']') {
+            return false;
+        }
+        const char* end;
+        TempCenti value;
+        if (tempParse(p, &value, &end) && (*end == ',' || *end == ']' || *end == ' ')) {
+            values[i] = value;
+            p = end;
+        }
+
+        // Skip the rest of the element and the separator before the next one
+        while (*p != '\0' && *p != ',' && *p != ']') p++;
+        if (*p == ',') p++;
+        while (*p == ' ') p++;
+    }
+    return true;
+}
+
+/**
+ * @brief Start a non-blocking poll of all configured entities
+ *
+ * @return false if a poll is already running, HA is not configured, no
+ *         entity is set, the URL or certificate pin is malformed, or the
+ *         circuit breaker is open
+ */
+bool HAClient::startPoll(const Config& config) {
+    if (isBusy()) {
+        return false;
+    }
+    if (strlen(config.ha_url) == 0 || strlen(config.ha_token) == 0) {
+        return false;
+    }
+
+    String newHost;
+    uint16_t newPort;
+    bool newSecure;
+    if (!parseUrl(config.ha_url, newHost, newPort, newSecure, basePath)) {
+        return false;
+    }
+    if (newSecure && !tls.setPin(config.ha_cert_sha256)) {
+        Serial.println("HA: invalid certificate pin");
+        return false;
+    }
+
+    // A different server invalidates the open connection, address and TLS session
+    bool serverChanged = newHost != host || newPort != port || newSecure != secure;
+    if (serverChanged) {
+        closeSocket();
+        tls.forgetSession();
+        host = newHost;
+        port = newPort;
+        secure = newSecure;
+        hostIp = 0;
+        breaker.reset();
+    }
+    if (serverChanged || strcmp(token, config.ha_token) != 0) {
+        strncpy(token, config.ha_token, sizeof(token) - 1);
+        token[sizeof(token) - 1] = '\0';
+        fixedHeaders = "Host: " + host + ":" + String(port) + "\r\n";
+        fixedHeaders += "Authorization: Bearer ";
+        fixedHeaders += token;
+        fixedHeaders += "\r\nConnection: keep-alive\r\n";
+    }
+    const char* entityIds[SENSOR_COUNT];
+    bool anyEntity = false;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        strncpy(entities[i], config.sensors[i].entity_id, sizeof(entities[i]) - 1);
+        entities[i][sizeof(entities[i]) - 1] = '\0';
+        entityIds[i] = entities[i];
+        values[i] = TEMP_INVALID;
+        anyEntity = anyEntity || strlen(entities[i]) > 0;
+    }
+    if (!anyEntity) {
+        return false;
+    }
+    if (!breaker.allowRequest()) {
+        return false;
+    }
+
+    batched = false;
+    pollStart = millis();
+
+    if (config.ha_batch_fetch) {
+        phase = PHASE_BATCH;
+        beginRequest("POST", basePath + "/api/template", buildBatchTemplate(entityIds, SENSOR_COUNT), false);
+    } else {
+        phase = PHASE_ENTITIES;
+        entityIndex = -1;
+        nextEntity();
+    }
+    return true;
+}
+
+/**
+ * @brief Advance the running poll by one bounded slice
+ *
+ * @return true exactly once, on the call that completes the poll
+ */
+bool HAClient::step() {
+    if (phase == PHASE_IDLE) {
+        return false;
+    }
+
+    advanceRequest();
+    if (reqState != REQ_DONE && reqState != REQ_FAILED) {
+        return false;
+    }
+
+    bool ok = reqState == REQ_DONE;
+    bool gotResponse = statusCode != 0;
+    if (!ok || !keepAlive) {
+        closeSocket();
+    }
+    reqState = REQ_IDLE;
+
+    // Any non-5xx answer means the server is up, even a 404 for one entity
+    if (statusCode > 0 && statusCode < 500) {
+        breaker.recordSuccess();
+    } else {
+        breaker.recordFailure();
+        if (breaker.getState() == CircuitBreaker::OPEN) {
+            // Remaining entities would only wait for the same timeout
+            finishPoll();
+            return true;
+        }
+    }
+
+    if (phase == PHASE_BATCH) {
+        const char* entityIds[SENSOR_COUNT];
+        for (int i = 0; i < SENSOR_COUNT; i++) {
+            entityIds[i] = entities[i];
+        }
+        if (ok && parseBatchValues(body, entityIds, values, SENSOR_COUNT)) {
+            batched = true;
+            finishPoll();
+            return true;
+        }
+        if (!gotResponse) {
+            // Server unreachable - per-entity requests would fail the same way
+            finishPoll();
+            return true;
+        }
+        Serial.println("HA: batch request rejected, falling back to per-entity");
+        phase = PHASE_ENTITIES;
+        entityIndex = -1;
+    } else if (ok) {
+        const char* state = stateParser.getState();
+        // "unavailable", "unknown" and other non-numeric states stay invalid
+        TempCenti value;
+        if (tempParse(state, &value)) {
+            values[entityIndex] = value;
+        }
+    }
+
+    if (!nextEntity()) {
+        finishPoll();
+        return true;
+    }
+    return false;
+}
+
+void HAClient::cancel() {
+    closeSocket();
+    reqState = REQ_IDLE;
+    phase = PHASE_IDLE;
+}
+
+bool HAClient::nextEntity() {
+    for (entityIndex++; entityIndex < SENSOR_COUNT; entityIndex++) {
+        if (strlen(entities[entityIndex]) > 0) {
+            beginRequest("GET", basePath + "/api/states/" + entities[entityIndex], String(""), true);
+            return true;
+        }
+    }
+    return false;
+}
+
+void HAClient::finishPoll() {
+    pollDurationMs = millis() - pollStart;
+    phase = PHASE_IDLE;
+}
+
+void HAClient::beginRequest(const char* method, const String& path, const String& payload, bool stateRequest) {
+    request = String(method) + " " + path + " HTTP/1.1\r\n";
+    request += fixedHeaders;
+    if (payload.length() > 0) {
+        request += "Content-Type: application/json\r\n";
+        request += "Content-Length: " + String(payload.length()) + "\r\n";
+    }
+    request += "\r\n";
+    request += payload;
+
+    stats.requests++;
+    reusedConnection = connectionAlive();
+    if (reusedConnection) {
+        stats.reused++;
+        reqState = REQ_SEND;
+    } else {
+        closeSocket();
+        reqState = hostIp != 0 ? REQ_CONNECT : REQ_RESOLVE;
+    }
+    reqDeadline = millis() + HA_REQUEST_TIMEOUT;
+    sent = 0;
+    statusCode = 0;
+    contentLength = -1;
+    bodyRead = 0;
+    chunked = false;
+    keepAlive = true;
+    lineLen = 0;
+    bodyLen = 0;
+    body[0] = '\0';
+    parseState = stateRequest;
+    stateParser.reset();
+}
+
+void HAClient::closeSocket() {
+    if (sock >= 0) {
+        if (secure) {
+            tls.close();
+        }
+        close(sock);
+        sock = -1;
+    }
+}
+
+/**
+ * @brief TCP connection is up: start TLS for https, else send right away
+ */
+void HAClient::onConnected() {
+    if (!secure) {
+        reqState = REQ_SEND;
+    } else if (tls.begin(sock, host.c_str())) {
+        reqState = REQ_HANDSHAKE;
+    } else {
+        failRequest("TLS setup");
+    }
+}
+
+/**
+ * @return Bytes sent, HATls::IO_AGAIN or HATls::IO_ERROR
+ */
+int HAClient::transportSend(const char* data, size_t length) {
+    if (secure) {
+        return tls.write(data, length);
+    }
+    int n = send(sock, data, length, 0);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? HATls::IO_AGAIN : HATls::IO_ERROR;
+    }
+    return n;
+}
+
+/**
+ * @return Bytes received, 0 if the peer closed, HATls::IO_AGAIN or HATls::IO_ERROR
+ */
+int HAClient::transportRecv(char* data, size_t length) {
+    if (secure) {
+        return tls.read(data, length);
+    }
+    int n = recv(sock, data, length, 0);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? HATls::IO_AGAIN : HATls::IO_ERROR;
+    }
+    return n;
+}
+
+/**
+ * @brief Check that the kept-alive connection is still open and idle
+ *
+ * A FIN from the server (idle timeout) or unexpected leftover data both mean
+ * the connection cannot carry the next request.
+ */
+bool HAClient::connectionAlive() {
+    if (sock < 0) {
+        return false;
+    }
+    if (secure) {
+        return tls.isIdle();
+    }
+    char c;
+    int n = recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+void HAClient::failRequest(const char* reason) {
+    closeSocket();
+
+    // The server may close an idle connection just as the request goes out;
+    // retry once on a fresh connection if no response byte arrived yet
+    if (reusedConnection && statusCode == 0 && lineLen == 0 && strcmp(reason, "timeout") != 0) {
+        Serial.println("HA: kept-alive connection dropped by server, reconnecting");
+        reusedConnection = false;
+        stats.staleRetries++;
+        reqState = hostIp != 0 ? REQ_CONNECT : REQ_RESOLVE;
+        reqDeadline = millis() + HA_REQUEST_TIMEOUT;
+        sent = 0;
+        return;
+    }
+
+    Serial.print("HA: request failed (");
+    Serial.print(reason);
+    Serial.println(")");
+    reqState = REQ_FAILED;
+}
+
+void HAClient::advanceRequest() {
+    if ((long)(millis() - reqDeadline) >= 0) {
+        failRequest("timeout");
+        return;
+    }
+
+    switch (reqState) {
+        case REQ_RESOLVE: {
+            // Blocking DNS only before a new connection; IP literals return immediately
+            IPAddress ip;
+            if (!ip.fromString(host.c_str()) && !WiFi.hostByName(host.c_str(), ip)) {
+                failRequest("DNS");
+                return;
+            }
+            hostIp = (uint32_t)ip;
+            reqState = REQ_CONNECT;
+            break;
+        }
+
+        case REQ_CONNECT: {
+            sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            if (sock < 0) {
+                failRequest("socket");
+                return;
+            }
+            stats.handshakes++;
+            int flags = fcntl(sock, F_GETFL, 0);
+            fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+            int one = 1;
+            setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+            struct sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            addr.sin_addr.s_addr = hostIp;
+
+            int res = connect(sock, (struct sockaddr*)&addr, sizeof(addr));
+            if (res == 0) {
+                onConnected();
+            } else if (errno == EINPROGRESS) {
+                reqState = REQ_CONNECTING;
+            } else {
+                hostIp = 0;
+                failRequest("connect");
+            }
+            break;
+        }
+
+        case REQ_CONNECTING: {
+            // Poll for connect completion without waiting
+            fd_set wfds;
+            FD_ZERO(&wfds);
+            FD_SET(sock, &wfds);
+            struct timeval tv = { 0, 0 };
+            int res = select(sock + 1, nullptr, &wfds, nullptr, &tv);
+            if (res < 0) {
+                failRequest("select");
+            } else if (res > 0) {
+                int err = 0;
+                socklen_t len = sizeof(err);
+                getsockopt(sock, SOL_SOCKET, SO_ERROR, &err, &len);
+                if (err != 0) {
+                    hostIp = 0;
+                    failRequest("connect");
+                } else {
+                    onConnected();
+                }
+            }
+            break;
+        }
+
+        case REQ_HANDSHAKE: {
+            // Each call runs at most one handshake flight; a full handshake's
+            // key exchange is the longest single slice of a poll
+            HATls::HandshakeResult result = tls.handshake();
+            if (result == HATls::HS_DONE) {
+                reqState = REQ_SEND;
+            } else if (result == HATls::HS_FAILED) {
+                failRequest("TLS handshake");
+            }
+            break;
+        }
+
+        case REQ_SEND: {
+            int n = transportSend(request.c_str() + sent, request.length() - sent);
+            if (n < 0) {
+                if (n != HATls::IO_AGAIN) {
+                    failRequest("send");
+                }
+                return;
+            }
+            sent += n;
+            if (sent >= request.length()) {
+                reqState = REQ_HEADERS;
+            }
+            break;
+        }
+
+        case REQ_HEADERS:
+        case REQ_BODY: {
+            char buf[RECV_SLICE];
+            int n = transportRecv(buf, sizeof(buf));
+            if (n < 0) {
+                if (n != HATls::IO_AGAIN) {
+                    failRequest("recv");
+                }
+                return;
+            }
+            if (n == 0) {
+                // Peer closed: only a complete body of unknown length is fine
+                if (reqState == REQ_BODY && contentLength < 0 && !parseState) {
+                    reqState = REQ_DONE;
+                } else {
+                    failRequest("closed");
+                }
+                return;
+            }
+
+            int i = 0;
+            while (i < n && reqState == REQ_HEADERS) {
+                char c = buf[i++];
+                if (c == '\n') {
+                    if (lineLen > 0 && line[lineLen - 1] == '\r') lineLen--;
+                    line[lineLen] = '\0';
+                    handleHeaderLine();
+                    lineLen = 0;
+                } else if (lineLen < LINE_MAX) {
+                    line[lineLen++] = c;
+                }
+            }
+            if (reqState == REQ_BODY && i < n) {
+                handleBody(buf + i, n - i);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void HAClient::handleHeaderLine() {
+    if (statusCode == 0) {
+        // Status line: "HTTP/1.1 200 OK"
+        const char* space = strchr(line, ' ');
+        statusCode = space != nullptr ? atoi(space + 1) : -1;
+        keepAlive = strncmp(line, "HTTP/1.1", 8) == 0;
+        if (statusCode != 200) {
+            Serial.printf("HA: HTTP %d\n", statusCode);
+            failRequest("status");
+        }
+        return;
+    }
+
+    if (lineLen == 0) {
+        // End of headers
+        if (chunked) {
+            failRequest("chunked body");
+            return;
+        }
+        if (contentLength < 0) {
+            // Body ends when the server closes the connection
+            keepAlive = false;
+        }
+        reqState = contentLength == 0 ? REQ_DONE : REQ_BODY;
+        return;
+    }
+
+    if (strncasecmp(line, "Content-Length:", 15) == 0) {
+        contentLength = atol(line + 15);
+    } else if (strncasecmp(line, "Connection:", 11) == 0 &&
+               (strstr(line + 11, "close") != nullptr || strstr(line + 11, "Close") != nullptr)) {
+        keepAlive = false;
+    } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strstr(line, "chunked") != nullptr) {
+        chunked = true;
+    }
+}
+
+void HAClient::handleBody(const char* data, size_t length) {
+    bodyRead += length;
+
+    if (parseState) {
+        // Parse until the state is known, then only drain to Content-Length
+        if (stateParser.getResult() == HAStateParser::NEED_MORE) {
+            HAStateParser::Result result = stateParser.feed(data, length, nullptr);
+            if (result == HAStateParser::FAILED) {
+                reqState = REQ_FAILED;
+                return;
+            }
+            if (result == HAStateParser::DONE && (contentLength < 0 || contentLength - bodyRead > DRAIN_MAX)) {
+                // Cheaper to reconnect next time than to read the whole remainder
+                keepAlive = false;
+                reqState = REQ_DONE;
+                return;
+            }
+        }
+    } else {
+        size_t room = BODY_MAX - bodyLen;
+        size_t n = length < room ? length : room;
+        memcpy(body + bodyLen, data, n);
+        bodyLen += n;
+        body[bodyLen] = '\0';
+    }
+
+    if (contentLength >= 0 && bodyRead >= contentLength) {
+        // A state body that ended without a state value is a failure
+        if (parseState) {
+            reqState = stateParser.getResult() == HAStateParser::DONE ? REQ_DONE : REQ_FAILED;
+        } else {
+            reqState = REQ_DONE;
+        }
+    }
+}
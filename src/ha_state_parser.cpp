@@ -0,0 +1,137 @@
+#include "ha_state_parser.h"
+#include <string.h>
+
+HAStateParser::HAStateParser() {
+    reset();
+}
+
+void HAStateParser::reset() {
+    mode = SCAN;
+    result = NEED_MORE;
+    depth = 0;
+    escape = false;
+    expectKey = false;
+    stateKeySeen = false;
+    keyLen = 0;
+    stateLen = 0;
+    key[0] = '\0';
+    state[0] = '\0';
+}
+
+HAStateParser::Result HAStateParser::feed(const char* data, size_t length, size_t* consumed) {
+    size_t i = 0;
+    while (i < length && result == NEED_MORE) {
+        feed(data[i]);
+        i++;
+    }
+    if (consumed != nullptr) {
+        *consumed = i;
+    }
+    return result;
+}
+
+HAStateParser::Result HAStateParser::feed(char c) {
+    if (result != NEED_MORE) {
+        return result;
+    }
+
+    switch (mode) {
+        case IN_STRING:
+        case IN_KEY:
+        case IN_STATE:
+            if (escape) {
+                // Escaped character: keep it literally
+                escape = false;
+            } else if (c == '\\') {
+                escape = true;
+                return result;
+            } else if (c == '"') {
+                if (mode == IN_KEY) {
+                    key[keyLen] = '\0';
+                    stateKeySeen = strcmp(key, "state") == 0;
+                } else if (mode == IN_STATE) {
+                    state[stateLen] = '\0';
+                    result = DONE;
+                    return result;
+                }
+                mode = SCAN;
+                return result;
+            }
+
+            if (mode == IN_KEY) {
+                // Longer keys can't be "state"; stop storing but keep consuming
+                if (keyLen < MAX_KEY_LEN) {
+                    key[keyLen++] = c;
+                } else {
+                    key[0] = '\0';
+                }
+            } else if (mode == IN_STATE) {
+                if (stateLen >= MAX_STATE_LEN) {
+                    result = FAILED;
+                    return result;
+                }
+                state[stateLen++] = c;
+            }
+            return result;
+
+        case BEFORE_VALUE:
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ':') {
+                return result;
+            }
+            if (c == '"') {
+                mode = IN_STATE;
+                stateLen = 0;
+            } else {
+                // HA always reports state as a string
+                result = FAILED;
+            }
+            return result;
+
+        case SCAN:
+            break;
+    }
+
+    switch (c) {
+        case '{':
+        case '[':
+            depth++;
+            expectKey = (depth == 1 && c == '{');
+            break;
+        case '}':
+        case ']':
+            if (depth == 0) {
+                result = FAILED;
+                break;
+            }
+            depth--;
+            if (depth == 0) {
+                // Whole top-level object read without a state key
+                result = FAILED;
+            }
+            break;
+        case ',':
+            if (depth == 1) {
+                expectKey = true;
+                stateKeySeen = false;
+            }
+            break;
+        case ':':
+            if (depth == 1 && stateKeySeen) {
+                mode = BEFORE_VALUE;
+            }
+            break;
+        case '"':
+            if (depth == 1 && expectKey) {
+                mode = IN_KEY;
+                keyLen = 0;
+                expectKey = false;
+            } else {
+                mode = IN_STRING;
+            }
+            break;
+        default:
+            // Whitespace, numbers, literals, or anything before the body starts
+            break;
+    }
+    return result;
+}
@@ -0,0 +1,300 @@
+#include "ha_tls.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/sha256.h>
+
+HATls::HATls() {
+    configured = false;
+    active = false;
+    haveSession = false;
+    fd = -1;
+    pinHex[0] = '\0';
+    memset(pin, 0, sizeof(pin));
+    certSeen = false;
+    pinMatched = false;
+    handshakeStart = 0;
+    fullCount = 0;
+    fullTotalMs = 0;
+    resumedCount = 0;
+    resumedTotalMs = 0;
+    heapAtBegin = 0;
+    heapLow = 0;
+    fullHeapPeak = 0;
+    resumedHeapPeak = 0;
+
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_entropy_init(&entropy);
+    mbedtls_ctr_drbg_init(&drbg);
+    mbedtls_ssl_session_init(&session);
+}
+
+HATls::~HATls() {
+    close();
+    mbedtls_ssl_session_free(&session);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_ctr_drbg_free(&drbg);
+    mbedtls_entropy_free(&entropy);
+}
+
+/**
+ * @brief One-time setup of the shared SSL configuration
+ */
+bool HATls::setupConfig() {
+    if (configured) {
+        return true;
+    }
+
+    const char* personalization = "water-status";
+    if (mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy,
+                              (const unsigned char*)personalization, strlen(personalization)) != 0) {
+        Serial.println("TLS: DRBG seed failed");
+        return false;
+    }
+    if (mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                    MBEDTLS_SSL_PRESET_DEFAULT) != 0) {
+        Serial.println("TLS: config defaults failed");
+        return false;
+    }
+
+    // OPTIONAL runs the verify callback (pin check) without requiring a CA chain
+    mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_OPTIONAL);
+    mbedtls_ssl_conf_verify(&conf, verifyCert, this);
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+#if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    // Ask for smaller records; servers that ignore it still work
+    mbedtls_ssl_conf_max_frag_len(&conf, MBEDTLS_SSL_MAX_FRAG_LEN_4096);
+#endif
+
+    configured = true;
+    return true;
+}
+
+/**
+ * @brief Set the expected SHA-256 fingerprint of the server certificate
+ *
+ * @param hexSha256 64 lowercase hex digits, or "" to disable verification
+ * @return false if the pin is malformed (verification stays as it was)
+ *
+ * Changing the pin drops the cached session, since it was validated
+ * against the old one.
+ */
+bool HATls::setPin(const char* hexSha256) {
+    if (strcmp(hexSha256, pinHex) == 0) {
+        return true;
+    }
+
+    size_t len = strlen(hexSha256);
+    if (len != 0 && len != 64) {
+        return false;
+    }
+    uint8_t parsed[32];
+    for (size_t i = 0; i < len; i += 2) {
+        char byteHex[3] = { hexSha256[i], hexSha256[i + 1], '\0' };
+        char* end;
+        parsed[i / 2] = (uint8_t)strtoul(byteHex, &end, 16);
+        if (*end != '\0') {
+            return false;
+        }
+    }
+
+    memcpy(pin, parsed, sizeof(pin));
+    strcpy(pinHex, hexSha256);
+    forgetSession();
+    return true;
+}
+
+void HATls::forgetSession() {
+    if (haveSession) {
+        mbedtls_ssl_session_free(&session);
+        mbedtls_ssl_session_init(&session);
+        haveSession = false;
+    }
+}
+
+/**
+ * @brief Start a TLS connection on a connected non-blocking socket
+ *
+ * Offers the cached session, if any; call handshake() until it is done.
+ */
+bool HATls::begin(int sock, const char* host) {
+    close();
+    if (!setupConfig()) {
+        return false;
+    }
+
+    heapAtBegin = ESP.getFreeHeap();
+    heapLow = heapAtBegin;
+    mbedtls_ssl_init(&ssl);
+    if (mbedtls_ssl_setup(&ssl, &conf) != 0 || mbedtls_ssl_set_hostname(&ssl, host) != 0) {
+        Serial.println("TLS: setup failed (out of memory?)");
+        mbedtls_ssl_free(&ssl);
+        return false;
+    }
+    fd = sock;
+    mbedtls_ssl_set_bio(&ssl, this, bioSend, bioRecv, nullptr);
+    if (haveSession) {
+        mbedtls_ssl_set_session(&ssl, &session);
+    }
+    sampleHeap();
+
+    active = true;
+    certSeen = false;
+    pinMatched = false;
+    handshakeStart = millis();
+    return true;
+}
+
+/**
+ * @brief Advance the handshake as far as the socket allows
+ */
+HATls::HandshakeResult HATls::handshake() {
+    int ret = mbedtls_ssl_handshake(&ssl);
+    sampleHeap();
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        return HS_AGAIN;
+    }
+    if (ret != 0) {
+        Serial.printf("TLS: handshake failed (-0x%04x)\n", -ret);
+        forgetSession();
+        return HS_FAILED;
+    }
+
+    // The server certificate is only sent (and verified) on a full handshake
+    unsigned long elapsed = millis() - handshakeStart;
+    size_t heapUsed = heapAtBegin > heapLow ? heapAtBegin - heapLow : 0;
+    if (certSeen) {
+        if (pinHex[0] != '\0' && !pinMatched) {
+            Serial.println("TLS: server certificate does not match the pinned SHA-256");
+            forgetSession();
+            return HS_FAILED;
+        }
+        fullCount++;
+        fullTotalMs += elapsed;
+        fullHeapPeak = heapUsed > fullHeapPeak ? heapUsed : fullHeapPeak;
+    } else {
+        resumedCount++;
+        resumedTotalMs += elapsed;
+        resumedHeapPeak = heapUsed > resumedHeapPeak ? heapUsed : resumedHeapPeak;
+    }
+    Serial.printf("TLS: %s handshake in %lu ms, %u bytes heap\n", certSeen ? "full" : "resumed",
+                  elapsed, (unsigned)heapUsed);
+
+    // Keep the (possibly renewed) session for the next connection
+    forgetSession();
+    if (mbedtls_ssl_get_session(&ssl, &session) == 0) {
+        haveSession = true;
+    }
+    return HS_DONE;
+}
+
+/**
+ * @return Bytes read, 0 if the peer closed the connection, IO_AGAIN or IO_ERROR
+ */
+int HATls::read(char* buf, size_t length) {
+    int ret = mbedtls_ssl_read(&ssl, (unsigned char*)buf, length);
+    if (ret > 0) {
+        return ret;
+    }
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        return IO_AGAIN;
+    }
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+    if (ret == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET) {
+        return IO_AGAIN;
+    }
+#endif
+    if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY || ret == MBEDTLS_ERR_SSL_CONN_EOF) {
+        return 0;
+    }
+    return IO_ERROR;
+}
+
+/**
+ * @return Bytes written, IO_AGAIN or IO_ERROR
+ */
+int HATls::write(const char* buf, size_t length) {
+    int ret = mbedtls_ssl_write(&ssl, (const unsigned char*)buf, length);
+    if (ret >= 0) {
+        return ret;
+    }
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        return IO_AGAIN;
+    }
+    return IO_ERROR;
+}
+
+/**
+ * @brief Check that a kept-alive connection is still usable
+ *
+ * Processes pending non-application records (e.g. a late session ticket);
+ * application data, close_notify, EOF or errors mean it is not.
+ */
+bool HATls::isIdle() {
+    if (!active) {
+        return false;
+    }
+    char c;
+    return read(&c, 1) == IO_AGAIN;
+}
+
+/**
+ * @brief Send close_notify (best effort) and free the connection context
+ *
+ * The caller closes the socket; the cached session is kept.
+ */
+void HATls::close() {
+    if (!active) {
+        return;
+    }
+    mbedtls_ssl_close_notify(&ssl);
+    mbedtls_ssl_free(&ssl);
+    active = false;
+    fd = -1;
+}
+
+void HATls::sampleHeap() {
+    size_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < heapLow) {
+        heapLow = freeHeap;
+    }
+}
+
+int HATls::bioSend(void* ctx, const unsigned char* buf, size_t length) {
+    HATls* self = (HATls*)ctx;
+    int n = send(self->fd, buf, length, 0);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_NET_SEND_FAILED;
+    }
+    return n;
+}
+
+int HATls::bioRecv(void* ctx, unsigned char* buf, size_t length) {
+    HATls* self = (HATls*)ctx;
+    int n = recv(self->fd, buf, length, 0);
+    if (n < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_RECV_FAILED;
+    }
+    return n;
+}
+
+/**
+ * @brief Certificate callback, called per chain entry on full handshakes
+ *
+ * Without a CA chain every certificate is flagged as untrusted; the flags
+ * are cleared because trust comes from the pin (or is not checked at all).
+ */
+int HATls::verifyCert(void* ctx, mbedtls_x509_crt* crt, int depth, uint32_t* flags) {
+    HATls* self = (HATls*)ctx;
+    if (depth == 0) {
+        uint8_t digest[32];
+        mbedtls_sha256(crt->raw.p, crt->raw.len, digest, 0);
+        self->certSeen = true;
+        self->pinMatched = memcmp(digest, self->pin, sizeof(digest)) == 0;
+    }
+    *flags = 0;
+    return 0;
+}
@@ -0,0 +1,242 @@
+#include "ha_websocket.h"
+#include "ha_client.h"
+#include <ArduinoJson.h>
+
+// WebSocket timing constants
+const unsigned long WS_RECONNECT_INTERVAL = 10000;
+const unsigned long WS_PING_INTERVAL = 15000;
+const unsigned long WS_PONG_TIMEOUT = 5000;
+const unsigned long WS_SUBSCRIBE_TIMEOUT = 30000;  // Connect + auth + subscribe
+
+// Circuit breaker: 3 failed attempts pause push for 30 s, doubling up to 10 minutes
+const int WS_FAILURE_THRESHOLD = 3;
+const unsigned long WS_BACKOFF_BASE = 30000;
+const unsigned long WS_BACKOFF_MAX = 600000;
+
+HAWebSocket::HAWebSocket() : breaker("HA WebSocket", WS_FAILURE_THRESHOLD, WS_BACKOFF_BASE, WS_BACKOFF_MAX) {
+    onState = nullptr;
+    token[0] = '\0';
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        entities[i][0] = '\0';
+    }
+    running = false;
+    subscribed = false;
+    paused = false;
+    attemptStart = 0;
+    eventCount = 0;
+}
+
+void HAWebSocket::begin(const Config& config, StateCallback callback) {
+    stop();
+
+    if (strlen(config.ha_url) == 0 || strlen(config.ha_token) == 0) {
+        Serial.println("WebSocket: HA not configured");
+        return;
+    }
+
+    String host;
+    String basePath;
+    uint16_t port;
+    bool secure;
+    if (!HAClient::parseUrl(config.ha_url, host, port, secure, basePath)) {
+        Serial.print("WebSocket: invalid HA URL ");
+        Serial.println(config.ha_url);
+        return;
+    }
+
+    onState = callback;
+    strncpy(token, config.ha_token, sizeof(token) - 1);
+    token[sizeof(token) - 1] = '\0';
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        strncpy(entities[i], config.sensors[i].entity_id, sizeof(entities[i]) - 1);
+        entities[i][sizeof(entities[i]) - 1] = '\0';
+    }
+
+    String path = basePath + "/api/websocket";
+    Serial.printf("WebSocket: connecting to %s:%u%s%s\n", host.c_str(), port, path.c_str(), secure ? " (TLS)" : "");
+
+    client.onEvent([this](WStype_t type, uint8_t* payload, size_t length) {
+        handleEvent(type, payload, length);
+    });
+    if (secure) {
+        client.beginSSL(host.c_str(), port, path.c_str());
+    } else {
+        client.begin(host.c_str(), port, path.c_str());
+    }
+    client.setReconnectInterval(WS_RECONNECT_INTERVAL);
+    client.enableHeartbeat(WS_PING_INTERVAL, WS_PONG_TIMEOUT, 2);
+    breaker.reset();
+    paused = false;
+    attemptStart = millis();
+    running = true;
+}
+
+void HAWebSocket::stop() {
+    if (running) {
+        client.disconnect();
+    }
+    running = false;
+    subscribed = false;
+}
+
+void HAWebSocket::loop() {
+    if (!running) {
+        return;
+    }
+    if (paused) {
+        if (!breaker.allowRequest()) {
+            return;
+        }
+        // Half-open: let the library reconnect once
+        paused = false;
+        attemptStart = millis();
+    }
+
+    client.loop();
+
+    // Failed TCP connects raise no event; time out the whole attempt instead
+    if (!subscribed && millis() - attemptStart > WS_SUBSCRIBE_TIMEOUT) {
+        recordFailure("no subscription");
+    }
+}
+
+void HAWebSocket::recordFailure(const char* reason) {
+    attemptStart = millis();
+    breaker.recordFailure();
+    if (breaker.getState() == CircuitBreaker::OPEN && !paused) {
+        Serial.printf("WebSocket: %s, pausing push updates\n", reason);
+        paused = true;
+        subscribed = false;
+        client.disconnect();
+    }
+}
+
+void HAWebSocket::handleEvent(WStype_t type, uint8_t* payload, size_t length) {
+    switch (type) {
+        case WStype_CONNECTED:
+            Serial.println("WebSocket: connected");
+            break;
+        case WStype_DISCONNECTED:
+            if (subscribed) {
+                Serial.println("WebSocket: disconnected, falling back to polling");
+            }
+            subscribed = false;
+            if (!paused) {
+                recordFailure("disconnected");
+            }
+            break;
+        case WStype_TEXT:
+            handleMessage(payload, length);
+            break;
+        default:
+            break;
+    }
+}
+
+void HAWebSocket::handleMessage(const uint8_t* payload, size_t length) {
+    // Only keep the fields we need - event messages carry full entity
+    // states with attributes and can be several KB
+    StaticJsonDocument<192> filter;
+    filter["type"] = true;
+    filter["id"] = true;
+    filter["success"] = true;
+    filter["event"]["variables"]["trigger"]["entity_id"] = true;
+    filter["event"]["variables"]["trigger"]["to_state"]["state"] = true;
+
+    StaticJsonDocument<384> doc;
+    DeserializationError error = deserializeJson(doc, payload, length, DeserializationOption::Filter(filter));
+    if (error) {
+        Serial.print("WebSocket: JSON error ");
+        Serial.println(error.c_str());
+        return;
+    }
+
+    const char* msgType = doc["type"] | "";
+
+    if (strcmp(msgType, "auth_required") == 0) {
+        sendAuth();
+    } else if (strcmp(msgType, "auth_ok") == 0) {
+        Serial.println("WebSocket: authenticated");
+        sendSubscribe();
+    } else if (strcmp(msgType, "auth_invalid") == 0) {
+        // Retrying with the same token cannot succeed; leave polling in charge
+        Serial.println("WebSocket: invalid token, disabling push updates");
+        stop();
+    } else if (strcmp(msgType, "result") == 0) {
+        if ((doc["id"] | 0) == SUBSCRIBE_ID) {
+            subscribed = doc["success"] | false;
+            if (subscribed) {
+                breaker.recordSuccess();
+            }
+            Serial.println(subscribed ? "WebSocket: subscribed to state changes" : "WebSocket: subscribe failed");
+        }
+    } else if (strcmp(msgType, "event") == 0) {
+        JsonObjectConst trigger = doc["event"]["variables"]["trigger"];
+        const char* entityId = trigger["entity_id"] | "";
+        const char* state = trigger["to_state"]["state"] | "";
+
+        // "unavailable", "unknown" and other non-numeric states are dropped
+        TempCenti value;
+        if (!tempParse(state, &value)) {
+            return;
+        }
+
+        // Several slots may share an entity; each of them gets the value
+        bool matched = false;
+        for (int i = 0; i < SENSOR_COUNT; i++) {
+            if (strlen(entities[i]) > 0 && strcmp(entities[i], entityId) == 0) {
+                matched = true;
+                if (onState != nullptr) {
+                    onState(i, value);
+                }
+            }
+        }
+        if (matched) {
+            eventCount++;
+        }
+    }
+}
+
+void HAWebSocket::sendAuth() {
+    String msg = "{\"type\":\"auth\",\"access_token\":\"";
+    msg += token;
+    msg += "\"}";
+    client.sendTXT(msg);
+}
+
+/**
+ * @brief True if an earlier slot has the same entity, so it is subscribed once
+ */
+bool HAWebSocket::isDuplicate(int slot) const {
+    for (int i = 0; i < slot; i++) {
+        if (strcmp(entities[i], entities[slot]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HAWebSocket::sendSubscribe() {
+    // State trigger on the configured entities = filtered state_changed stream
+    String msg = "{\"id\":";
+    msg += SUBSCRIBE_ID;
+    msg += ",\"type\":\"subscribe_trigger\",\"trigger\":{\"platform\":\"state\",\"entity_id\":[";
+    bool first = true;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        if (strlen(entities[i]) == 0 || isDuplicate(i)) {
+            continue;
+        }
+        if (!first) msg += ",";
+        first = false;
+        msg += "\"";
+        msg += entities[i];
+        msg += "\"";
+    }
+    msg += "]}}";
+
+    if (first) {
+        Serial.println("WebSocket: no entities configured");
+        return;
+    }
+    client.sendTXT(msg);
+}
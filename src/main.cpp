@@ -6,9 +6,20 @@
 #include <ArduinoJson.h>
 #include <Adafruit_NeoPixel.h>
 #include <ArduinoOTA.h>
+#include <algorithm>
 #include "config.h"
 #include "display.h"
 #include "web_interface.h"
+#include "ha_websocket.h"
+#include "ha_client.h"
+#include "sensor_snapshot.h"
+#include "sensor_registry.h"
+#include "poll_scheduler.h"
+#include "temperature.h"
+#include "render_profile.h"
+#include "sensor_history.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 // RGB LED on Waveshare ESP32-C6 1.47" LCD
 #define RGB_LED_PIN 8
@@ -17,6 +28,7 @@ Adafruit_NeoPixel rgbLed(NUM_LEDS, RGB_LED_PIN, NEO_RGB + NEO_KHZ800);
 
 // Timing constants
 const unsigned long DISPLAY_UPDATE_INTERVAL = 1000;
+const unsigned long LOOP_IDLE_DELAY = 10;          // Short enough for the 25 FPS heat wave animation
 const unsigned long HEATING_CHECK_INTERVAL = 60000;  // Check heating every minute
 const unsigned long LED_FLASH_INTERVAL_NOT_READY = 500;
 const unsigned long LED_PULSE_INTERVAL_HEATING = 1000;
@@ -24,17 +36,30 @@ const unsigned long LED_UPDATE_INTERVAL_READY = 2000;
 const unsigned long TEST_STATE_CHANGE_INTERVAL = 3000;
 const unsigned long WIFI_RECONNECT_INTERVAL = 30000;
 const unsigned long HTTP_TIMEOUT = 5000;
+const unsigned long WS_RESYNC_INTERVAL = 300000;  // REST resync while push updates are live
+const unsigned long NETWORK_IDLE_DELAY = 50;      // Network task sleep between polls
+const unsigned long NETWORK_BUSY_DELAY = 5;       // Network task sleep while a poll is in flight
+const unsigned long RENDER_PROFILE_DUMP_INTERVAL = 60000;  // Serial dump with -D RENDER_PROFILER
+
+// Network task (same priority as the Arduino loop task)
+const uint32_t NETWORK_TASK_STACK = 8192;
+const UBaseType_t NETWORK_TASK_PRIORITY = 1;
 
 // Heating detection constants
-const float HEATING_TEMP_THRESHOLD = 0.5;  // Minimum °C increase to detect heating
-const float HEATING_TEMP_DECREASE = 1.0;   // °C decrease to detect heating stopped
+const TempCenti HEATING_TEMP_THRESHOLD = 50;   // Minimum increase per minute (0.5°C) to detect heating
+const TempCenti HEATING_TEMP_DECREASE = 100;   // Decrease per minute (1.0°C) to detect heating stopped
+const TempCenti POLL_NEAR_THRESHOLD = 200;     // Distance from a bath threshold (2.0°C) that speeds up polling
 
 // Global objects
 ConfigManager configManager;
 DisplayManager display;
 WebServer server(80);
 DNSServer dnsServer;
-HTTPClient http;
+HAWebSocket haSocket;
+HAClient haClient;
+SnapshotBuffer sensorSnapshot;
+SemaphoreHandle_t configMutex = nullptr;
+TaskHandle_t networkTaskHandle = nullptr;
 
 // AP mode settings
 const char* AP_SSID = "Water-Status-AP";
@@ -42,36 +67,83 @@ const byte DNS_PORT = 53;
 bool apMode = false;
 
 // Status variables
-bool wifiConnected = false;
-bool haConnected = false;
-unsigned long lastHAPoll = 0;
+volatile bool wifiConnected = false;
 unsigned long lastDisplayUpdate = 0;
 unsigned long lastWiFiCheck = 0;
 
-// Sensor temperatures
-float tankTemp = 0.0;
-float outPipeTemp = 0.0;
-float heatingInTemp = 0.0;
-float roomTemp = 0.0;
-float previousHeatingInTemp = 0.0;
+// Requests from the loop task to the network task
+volatile bool pollRequested = true;          // Poll now instead of waiting for the interval
+volatile bool networkConfigChanged = false;  // Reload Config and reconnect
+
+// Network task state - only touched by networkTask() and the functions it
+// calls; everyone else reads sensorSnapshot
+Config netConfig;
+bool haConnected = false;
+unsigned long lastHAPoll = 0;
+PollScheduler pollScheduler;
+
+// Poll latency counters (exposed on /status)
+unsigned long lastPollDurationMs = 0;
+unsigned long pollDurationTotalMs = 0;
+unsigned long pollCount = 0;
+bool lastPollBatched = false;
+
+// loop() pass duration, excluding the idle delay (exposed on /status)
+const int LOOP_SAMPLE_COUNT = 256;
+unsigned long loopSamplesUs[LOOP_SAMPLE_COUNT];
+int loopSampleIndex = 0;
+int loopSampleFill = 0;
+unsigned long loopMaxUs = 0;
+
+#ifdef RENDER_PROFILER
+unsigned long lastRenderProfileDump = 0;
+#endif
+
+// Sensor temperatures (network task)
+SensorRegistry sensorRegistry;
+TempCenti previousHeatingInTemp = TEMP_INVALID;
 unsigned long lastHeatingCheck = 0;
+bool netBathReady = false;
+bool netHeatingActive = false;
 
-// LED state for STOP flashing
+// LED state for STOP flashing (loop task, follows the snapshot or test mode)
 bool bathIsReady = false;
 bool heatingActive = false;
 unsigned long lastLedFlash = 0;
 bool ledOn = false;
 
+// Last snapshot handed to the display
+uint32_t appliedSnapshotVersion = 0;
+uint32_t appliedReadingCount[MAX_SENSORS] = { 0 };
+
+// Reading history of every sensor slot (loop task), sampled from the snapshot
+HistoryStore history;
+unsigned long lastHistorySample = 0;
+
+// Trend page samples, averaged from the history every TREND_INTERVAL_MS
+unsigned long lastTrendSample = 0;
+
 // Test mode for display verification
-bool testMode = false;
+volatile bool testMode = false;
 int testState = 0;
 unsigned long lastTestStateChange = 0;
 
 // Function declarations
 void setupWiFi();
 void setupOTA();
-void pollHomeAssistant();
-float fetchHAEntityState(const char* entityId);
+void applySensorReading(int sensor, TempCenti value);
+void finishHAPoll();
+void recordLoopDuration(unsigned long us);
+unsigned long loopP99Us();
+void applyPollResults(const TempCenti values[], bool batched, unsigned long durationMs);
+void updateDerivedState();
+void onHAStateChanged(int sensor, TempCenti value);
+void networkTask(void* param);
+void publishSnapshot();
+void applyNetworkConfig();
+void applySensorSnapshot(bool force);
+void recordHistorySample(unsigned long now);
+void recordTrendSample(unsigned long now);
 void startAPMode();
 void startWebServer();
 void handleRoot();
@@ -84,6 +156,15 @@ void handleNotFound();
 void handleHAEntities();
 void handleHATest();
 void handleDisplayTest();
+void handleHistory();
+#ifdef RENDER_PROFILER
+void handleRenderProfile();
+#endif
+TempCenti snapshotValue(const SensorSnapshot& snap, uint8_t role);
+String tempString(TempCenti value);
+#ifdef TEMP_BENCHMARK
+void runTemperatureBenchmark();
+#endif
 
 void setup() {
     Serial.begin(115200);
@@ -95,6 +176,10 @@ void setup() {
     Serial.println("========================================");
     Serial.flush();
     
+#ifdef TEMP_BENCHMARK
+    runTemperatureBenchmark();
+#endif
+    
     // Initialize RGB LED
     rgbLed.begin();
     rgbLed.setBrightness(255);
@@ -109,6 +194,7 @@ void setup() {
     
     // Initialize display
     display.begin(config.screen_brightness);
+    display.setPowerTimeouts(config.screen_dim_after * 60000UL, config.screen_sleep_after * 60000UL);
     display.setTemperatureUnit(config.celsius);
     display.setThresholds(config.min_tank_temp, config.min_out_pipe_temp);
     
@@ -127,8 +213,10 @@ void setup() {
         Serial.println("Starting web server...");
         startWebServer();
         
-        // Initial poll of Home Assistant
-        pollHomeAssistant();
+        // All Home Assistant traffic runs on its own task; it polls immediately
+        configMutex = xSemaphoreCreateMutex();
+        netConfig = configManager.getConfig();
+        xTaskCreate(networkTask, "network", NETWORK_TASK_STACK, nullptr, NETWORK_TASK_PRIORITY, &networkTaskHandle);
     } else {
         Serial.println("Starting AP mode...");
         startAPMode();
@@ -136,7 +224,208 @@ void setup() {
     }
 }
 
+/**
+ * @brief FreeRTOS task owning all Home Assistant communication
+ * 
+ * Runs WebSocket push updates and REST polling (only a slow resync while
+ * push is live) and publishes the results through sensorSnapshot. Network
+ * latency therefore never delays rendering, LED or web server in loop().
+ * A running non-blocking poll advances one bounded slice per pass.
+ */
+void networkTask(void* param) {
+    bool socketStarted = false;
+    CircuitBreaker::State publishedWsBreaker = CircuitBreaker::CLOSED;
+    applyNetworkConfig();
+    
+    for (;;) {
+        // Pick up configuration saved from the web interface
+        if (networkConfigChanged) {
+            networkConfigChanged = false;
+            xSemaphoreTake(configMutex, portMAX_DELAY);
+            netConfig = configManager.getConfig();
+            xSemaphoreGive(configMutex);
+            
+            haClient.cancel();
+            haSocket.stop();
+            socketStarted = false;
+            applyNetworkConfig();
+            pollRequested = true;
+        }
+        
+        if (wifiConnected && !testMode) {
+            // Push updates over WebSocket; REST polling stays as the fallback
+            if (netConfig.ha_websocket && !socketStarted) {
+                haSocket.begin(netConfig, onHAStateChanged);
+                socketStarted = true;
+            }
+            haSocket.loop();
+            if (haSocket.getBreaker().getState() != publishedWsBreaker) {
+                publishedWsBreaker = haSocket.getBreaker().getState();
+                publishSnapshot();
+            }
+            
+            if (haClient.isBusy()) {
+                if (haClient.step()) {
+                    finishHAPoll();
+                }
+            } else {
+                unsigned long pollInterval = haSocket.isSubscribed() ? WS_RESYNC_INTERVAL : pollScheduler.getInterval();
+                unsigned long now = millis();
+                
+                if (pollRequested || now - lastHAPoll > pollInterval) {
+                    pollRequested = false;
+                    lastHAPoll = now;
+                    // Not configured or circuit open: report HA as disconnected
+                    if (!haClient.startPoll(netConfig) && haConnected) {
+                        haConnected = false;
+                        publishSnapshot();
+                    }
+                }
+            }
+        }
+        
+        vTaskDelay(pdMS_TO_TICKS(haClient.isBusy() ? NETWORK_BUSY_DELAY : NETWORK_IDLE_DELAY));
+    }
+}
+
+/**
+ * @brief Apply a freshly loaded netConfig to the network task
+ * 
+ * Updates the sensor registry and sets the poll floor, nominal interval and
+ * ceiling. HAClient picks up URL, token and certificate pin changes itself
+ * on the next startPoll().
+ */
+void applyNetworkConfig() {
+    sensorRegistry.configure(netConfig);
+    pollScheduler.configure(netConfig.poll_min_interval * 1000UL,
+                            netConfig.poll_interval * 1000UL,
+                            netConfig.poll_max_interval * 1000UL);
+}
+
+/**
+ * @brief Publish the network task's current sensor state to all readers
+ */
+void publishSnapshot() {
+    SensorSnapshot snap;
+    sensorRegistry.copyReadings(snap.sensors);
+    snap.haConnected = haConnected;
+    snap.bathReady = netBathReady;
+    snap.heatingActive = netHeatingActive;
+    snap.pushActive = haSocket.isSubscribed();
+    snap.pushEvents = haSocket.getEventCount();
+    snap.lastPollBatched = lastPollBatched;
+    snap.lastPollMs = lastPollDurationMs;
+    snap.pollAvgMs = pollCount > 0 ? pollDurationTotalMs / pollCount : 0;
+    snap.pollCount = pollCount;
+    snap.pollIntervalMs = pollScheduler.getInterval();
+    
+    const HAConnectionStats& clientStats = haClient.getStats();
+    snap.haRequests = clientStats.requests;
+    snap.haReused = clientStats.reused;
+    snap.haHandshakes = clientStats.handshakes;
+    const HATls& tls = haClient.getTls();
+    snap.tlsFull = tls.getFullCount();
+    snap.tlsResumed = tls.getResumedCount();
+    snap.tlsFullAvgMs = tls.getFullAvgMs();
+    snap.tlsResumedAvgMs = tls.getResumedAvgMs();
+    snap.tlsFullHeap = tls.getFullHeapPeak();
+    snap.tlsResumedHeap = tls.getResumedHeapPeak();
+    
+    const CircuitBreaker& restBreaker = haClient.getBreaker();
+    snap.restBreaker = restBreaker.getState();
+    snap.restFailures = restBreaker.getConsecutiveFailures();
+    snap.restFailuresTotal = restBreaker.getTotalFailures();
+    snap.restRetryInMs = restBreaker.getRetryInMs();
+    const CircuitBreaker& wsBreaker = haSocket.getBreaker();
+    snap.wsBreaker = wsBreaker.getState();
+    snap.wsFailures = wsBreaker.getConsecutiveFailures();
+    sensorSnapshot.publish(snap);
+}
+
+/**
+ * @brief Hand new readings from the network task to the display and LED
+ * 
+ * Runs on the loop task, so DisplayManager is only ever touched by one task.
+ * Only sensors with a new reading since the last call are forwarded, and
+ * only the primary slot of each role (see SensorRegistry::primarySlot).
+ * 
+ * @param force Re-apply bath/heating state even if nothing was published
+ */
+void applySensorSnapshot(bool force) {
+    if (!force && sensorSnapshot.getVersion() == appliedSnapshotVersion) {
+        return;
+    }
+    
+    SensorSnapshot snap;
+    appliedSnapshotVersion = sensorSnapshot.read(snap);
+    
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        const SensorReading& reading = snap.sensors[i];
+        if (reading.readingCount == appliedReadingCount[i]) {
+            continue;
+        }
+        appliedReadingCount[i] = reading.readingCount;
+        if (reading.valid && SensorRegistry::primarySlot(snap.sensors, reading.role) == i) {
+            display.updateTemperature(reading.role, reading.value);
+        }
+    }
+    
+    bathIsReady = snap.bathReady;
+    heatingActive = snap.heatingActive;
+    display.updateBathStatus(bathIsReady);
+    display.updateHeatingStatus(heatingActive);
+    
+    // Worst endpoint wins: open (red) over half-open (orange) over closed
+    CircuitBreaker::State link = CircuitBreaker::CLOSED;
+    if (snap.restBreaker == CircuitBreaker::OPEN || snap.wsBreaker == CircuitBreaker::OPEN) {
+        link = CircuitBreaker::OPEN;
+    } else if (snap.restBreaker == CircuitBreaker::HALF_OPEN || snap.wsBreaker == CircuitBreaker::HALF_OPEN) {
+        link = CircuitBreaker::HALF_OPEN;
+    }
+    display.updateLinkStatus(link);
+}
+
+/**
+ * @brief Append the current reading of every sensor slot to the history
+ */
+void recordHistorySample(unsigned long now) {
+    SensorSnapshot snap;
+    sensorSnapshot.read(snap);
+    
+    TempCenti values[MAX_SENSORS];
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        values[i] = snap.sensors[i].valid ? snap.sensors[i].value : TEMP_INVALID;
+    }
+    history.record(values, now);
+}
+
+/**
+ * @brief Append the tank, out pipe and heating inlet averages since the last trend sample
+ * 
+ * Each series comes from the history of its role's primary slot, so a
+ * short spike between two trend samples still moves the line.
+ */
+void recordTrendSample(unsigned long now) {
+    SensorSnapshot snap;
+    sensorSnapshot.read(snap);
+    
+    const uint8_t roles[TREND_SERIES] = { ROLE_TANK, ROLE_OUT_PIPE, ROLE_HEATING_IN };
+    uint32_t from = history.sequenceAt(now - TREND_INTERVAL_MS);
+    TempCenti values[TREND_SERIES];
+    for (int i = 0; i < TREND_SERIES; i++) {
+        int slot = SensorRegistry::primarySlot(snap.sensors, roles[i]);
+        HistoryBucket bucket;
+        values[i] = TEMP_INVALID;
+        if (slot >= 0 && history.get(slot).downsample(from, history.getSequence(), 1, &bucket) > 0) {
+            values[i] = bucket.mean;
+        }
+    }
+    display.addTrendSample(values);
+}
+
 void loop() {
+    unsigned long loopStart = micros();
+    
     // Handle AP mode
     if (apMode) {
         dnsServer.processNextRequest();
@@ -150,16 +439,9 @@ void loop() {
         ArduinoOTA.handle();
     }
     
-    // Poll Home Assistant periodically
-    if (wifiConnected && !testMode) {
-        Config config = configManager.getConfig();
-        unsigned long pollInterval = config.poll_interval * 1000UL;
-        unsigned long now = millis();
-        
-        if (now - lastHAPoll > pollInterval) {
-            lastHAPoll = now;
-            pollHomeAssistant();
-        }
+    // Pick up readings published by the network task
+    if (!testMode) {
+        applySensorSnapshot(false);
     }
     
     // Test mode - cycle through display states
@@ -181,9 +463,6 @@ void loop() {
                 case 1:  // Bath ready - bath image (no heating)
                     bathIsReady = true;
                     heatingActive = false;
-                    tankTemp = 55.0;
-                    outPipeTemp = 42.0;
-                    roomTemp = 22.5;
                     display.updateBathStatus(true);
                     display.updateHeatingStatus(false);
                     Serial.println("Test: Bath ready (no heating)");
@@ -198,8 +477,7 @@ void loop() {
                 case 3:  // Room temperature display
                     bathIsReady = true;
                     heatingActive = true;
-                    roomTemp = 23.8;
-                    display.updateTemperature(3, roomTemp);
+                    display.updateTemperature(ROLE_ROOM, 2380);
                     Serial.println("Test: Room temperature");
                     break;
             }
@@ -222,12 +500,32 @@ void loop() {
         setupWiFi();
     }
     
+    // Test mode drives the display with fake states, keep them out of the history
+    if (!testMode && now - lastHistorySample >= HISTORY_INTERVAL_MS) {
+        lastHistorySample = now;
+        recordHistorySample(now);
+    }
+    if (!testMode && now - lastTrendSample >= TREND_INTERVAL_MS) {
+        lastTrendSample = now;
+        recordTrendSample(now);
+    }
+    
     // Update display periodically
     if (now - lastDisplayUpdate > DISPLAY_UPDATE_INTERVAL) {
         lastDisplayUpdate = now;
         display.refresh();
     }
     
+    // Heat wave side strips run at their own frame rate
+    display.animate();
+    
+#ifdef RENDER_PROFILER
+    if (now - lastRenderProfileDump > RENDER_PROFILE_DUMP_INTERVAL) {
+        lastRenderProfileDump = now;
+        renderProfilePrint();
+    }
+#endif
+    
     // LED feedback based on state
     if (!bathIsReady) {
         // Flash LED red when STOP (not ready)
@@ -263,7 +561,33 @@ void loop() {
         }
     }
     
-    delay(100);
+    recordLoopDuration(micros() - loopStart);
+    
+    delay(LOOP_IDLE_DELAY);
+}
+
+/**
+ * @brief Record one loop() pass duration for the max/p99 latency metrics
+ */
+void recordLoopDuration(unsigned long us) {
+    loopSamplesUs[loopSampleIndex] = us;
+    loopSampleIndex = (loopSampleIndex + 1) % LOOP_SAMPLE_COUNT;
+    if (loopSampleFill < LOOP_SAMPLE_COUNT) loopSampleFill++;
+    if (us > loopMaxUs) loopMaxUs = us;
+}
+
+/**
+ * @brief 99th percentile loop() pass duration over the last LOOP_SAMPLE_COUNT passes
+ */
+unsigned long loopP99Us() {
+    if (loopSampleFill == 0) {
+        return 0;
+    }
+    unsigned long sorted[LOOP_SAMPLE_COUNT];
+    memcpy(sorted, loopSamplesUs, loopSampleFill * sizeof(unsigned long));
+    int rank = (loopSampleFill * 99) / 100;
+    std::nth_element(sorted, sorted + rank, sorted + loopSampleFill);
+    return sorted[rank];
 }
 
 /**
@@ -367,141 +691,38 @@ void setupWiFi() {
 }
 
 /**
- * @brief Fetch temperature from a single Home Assistant entity
- * 
- * @param entityId The entity ID to fetch (e.g., "sensor.tank_temperature")
- * @return float The temperature value, or 0.0 if fetch failed or entity unavailable
- * 
- * Uses string-based parsing to extract the "state" field from JSON response.
- * This avoids ArduinoJson memory allocation issues with large responses.
- * Enables HTTP connection reuse for better performance.
+ * @brief Complete a non-blocking poll started with haClient.startPoll()
  */
-float fetchHAEntityState(const char* entityId) {
-    if (strlen(entityId) == 0) {
-        return 0.0;
-    }
-    
-    Config config = configManager.getConfig();
-    
-    if (strlen(config.ha_url) == 0 || strlen(config.ha_token) == 0) {
-        return 0.0;
-    }
-    
-    String url = String(config.ha_url) + "/api/states/" + entityId;
-    
-    Serial.print("    Fetching: ");
-    Serial.println(url);
-    
-    http.begin(url);
-    http.addHeader("Authorization", String("Bearer ") + config.ha_token);
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(HTTP_TIMEOUT);
-    http.setReuse(true);  // Enable connection reuse for better performance
-    
-    int httpCode = http.GET();
-    float temperature = 0.0;
-    
-    Serial.print("    HTTP code: ");
-    Serial.println(httpCode);
-    
-    if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        Serial.print("    Response length: ");
-        Serial.println(payload.length());
-        
-        // Simple string extraction for "state" field - more reliable than JSON parsing
-        // Format: {"entity_id":"...","state":"54.25","attributes":...}
-        int stateStart = payload.indexOf("\"state\":\"");
-        if (stateStart > 0) {
-            stateStart += 9;  // Skip past "state":"
-            int stateEnd = payload.indexOf("\"", stateStart);
-            if (stateEnd > stateStart) {
-                String stateStr = payload.substring(stateStart, stateEnd);
-                Serial.print("    State string: '");
-                Serial.print(stateStr);
-                Serial.println("'");
-                
-                if (stateStr != "unavailable" && stateStr != "unknown") {
-                    temperature = stateStr.toFloat();
-                    Serial.print("    Parsed temp: ");
-                    Serial.println(temperature);
-                }
-            }
-        }
-    } else {
-        Serial.print("HA fetch error for ");
-        Serial.print(entityId);
-        Serial.print(": ");
-        Serial.println(httpCode);
+void finishHAPoll() {
+    TempCenti values[MAX_SENSORS];
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        values[i] = haClient.getValue(i);
     }
-    
-    http.end();
-    return temperature;
+    applyPollResults(values, haClient.wasBatched(), haClient.getPollDuration());
 }
 
 /**
- * @brief Poll all configured temperature sensors from Home Assistant
+ * @brief Apply one poll's readings to the sensor state and publish the result
  * 
- * Fetches current state of all configured temperature entities via HA REST API.
- * Uses string parsing instead of JSON to avoid memory allocation issues.
- * Updates display and checks bath readiness after fetching all sensors.
- * 
- * Also performs heating activity detection by comparing temperature changes
- * over 60 second intervals.
+ * @param values Fetched value per registry slot, TEMP_INVALID if the fetch failed
+ * @param batched true if the values came from a single template request
+ * @param durationMs Wall time of the poll
  */
-void pollHomeAssistant() {
-    Config config = configManager.getConfig();
-    
-    Serial.println("Polling Home Assistant...");
-    Serial.print("  HA URL: ");
-    Serial.println(config.ha_url);
-    Serial.print("  Token length: ");
-    Serial.println(strlen(config.ha_token));
+void applyPollResults(const TempCenti values[], bool batched, unsigned long durationMs) {
+    lastPollDurationMs = durationMs;
+    lastPollBatched = batched;
+    pollCount++;
+    pollDurationTotalMs += lastPollDurationMs;
+    Serial.printf("  Poll took %lu ms (%s)\n", lastPollDurationMs, batched ? "batch" : "per-entity");
     
     bool anySuccess = false;
-    
-    // Fetch tank temperature
-    Serial.print("  Tank entity: '");
-    Serial.print(config.entity_tank_temp);
-    Serial.println("'");
-    if (strlen(config.entity_tank_temp) > 0) {
-        float temp = fetchHAEntityState(config.entity_tank_temp);
-        if (temp != 0.0 || tankTemp == 0.0) {
-            tankTemp = temp;
-            display.updateTemperature(0, tankTemp);
-            anySuccess = true;
-        }
-    }
-    
-    // Fetch out pipe temperature
-    Serial.print("  Out pipe entity: '");
-    Serial.print(config.entity_out_pipe_temp);
-    Serial.println("'");
-    if (strlen(config.entity_out_pipe_temp) > 0) {
-        float temp = fetchHAEntityState(config.entity_out_pipe_temp);
-        if (temp != 0.0 || outPipeTemp == 0.0) {
-            outPipeTemp = temp;
-            display.updateTemperature(1, outPipeTemp);
-            anySuccess = true;
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        if (!sensorRegistry.isUsed(i)) {
+            continue;
         }
-    }
-    
-    // Fetch heating in temperature
-    if (strlen(config.entity_heating_in_temp) > 0) {
-        float temp = fetchHAEntityState(config.entity_heating_in_temp);
-        if (temp != 0.0 || heatingInTemp == 0.0) {
-            heatingInTemp = temp;
-            display.updateTemperature(2, heatingInTemp);
-            anySuccess = true;
-        }
-    }
-    
-    // Fetch room temperature
-    if (strlen(config.entity_room_temp) > 0) {
-        float temp = fetchHAEntityState(config.entity_room_temp);
-        if (temp != 0.0 || roomTemp == 0.0) {
-            roomTemp = temp;
-            display.updateTemperature(3, roomTemp);
+        // Keep the last good reading if this fetch failed
+        if (values[i] != TEMP_INVALID) {
+            applySensorReading(i, values[i]);
             anySuccess = true;
         }
     }
@@ -511,32 +732,72 @@ void pollHomeAssistant() {
     Serial.print("Any success: ");
     Serial.println(anySuccess ? "YES" : "NO");
     
+    updateDerivedState();
+}
+
+/**
+ * @brief Store a new reading for one sensor slot
+ * 
+ * The display picks it up from the next published snapshot.
+ * 
+ * @param sensor Registry slot (Config::sensors index)
+ * @param value Temperature in centi-degrees °C
+ */
+void applySensorReading(int sensor, TempCenti value) {
+    sensorRegistry.setValue(sensor, value);
+}
+
+/**
+ * @brief Push-update callback from the Home Assistant WebSocket client
+ */
+void onHAStateChanged(int sensor, TempCenti value) {
+    if (testMode) {
+        return;
+    }
+    char buf[16];
+    tempFormat(value, buf, sizeof(buf), 2);
+    Serial.printf("HA push: sensor %d = %s\n", sensor, buf);
+    applySensorReading(sensor, value);
+    haConnected = true;
+    updateDerivedState();
+}
+
+/**
+ * @brief Recompute heating activity and bath readiness, then publish a snapshot
+ * 
+ * Shared by REST polling and WebSocket push updates. Heating detection
+ * compares heating-in temperature changes over 60 second intervals.
+ */
+void updateDerivedState() {
+    const Config& config = netConfig;
+    TempCenti tankTemp = sensorRegistry.valueOf(ROLE_TANK);
+    TempCenti outPipeTemp = sensorRegistry.valueOf(ROLE_OUT_PIPE);
+    TempCenti heatingInTemp = sensorRegistry.valueOf(ROLE_HEATING_IN);
+    
     // Detect heating activity (heating in temp increased significantly)
     unsigned long now = millis();
     if (now - lastHeatingCheck > HEATING_CHECK_INTERVAL) {
-        // Only compare if we have valid readings (not initial 0.0) and enough time has passed
-        if (previousHeatingInTemp > 0.0 && heatingInTemp > 0.0 && lastHeatingCheck > 0) {
-            float tempDiff = heatingInTemp - previousHeatingInTemp;
+        // Only compare if we have valid readings and enough time has passed
+        if (previousHeatingInTemp != TEMP_INVALID && heatingInTemp != TEMP_INVALID && lastHeatingCheck > 0) {
+            TempCenti tempDiff = heatingInTemp - previousHeatingInTemp;
             
             // Calculate rate of change per minute
-            float minutesElapsed = (now - lastHeatingCheck) / 60000.0;
-            float ratePerMinute = tempDiff / minutesElapsed;
+            unsigned long elapsedMs = now - lastHeatingCheck;
+            TempCenti ratePerMinute = (TempCenti)((int64_t)tempDiff * 60000 / elapsedMs);
             
             if (ratePerMinute > HEATING_TEMP_THRESHOLD) {
-                heatingActive = true;
-                Serial.print("Heating ACTIVE detected: +");
-                Serial.print(tempDiff, 2);
-                Serial.print("°C in ");
-                Serial.print(minutesElapsed, 1);
-                Serial.println(" min");
+                netHeatingActive = true;
+                char buf[16];
+                tempFormat(tempDiff, buf, sizeof(buf), 2);
+                Serial.printf("Heating ACTIVE detected: +%s°C in %lu s\n", buf, elapsedMs / 1000);
             } else if (ratePerMinute < -HEATING_TEMP_DECREASE) {
-                heatingActive = false;
+                netHeatingActive = false;
                 Serial.println("Heating INACTIVE (temp dropping)");
             }
         }
         
         // Update previous reading only if current reading is valid
-        if (heatingInTemp > 0.0) {
+        if (heatingInTemp != TEMP_INVALID) {
             previousHeatingInTemp = heatingInTemp;
         }
         lastHeatingCheck = now;
@@ -545,21 +806,40 @@ void pollHomeAssistant() {
     // Check bath readiness with flexible logic:
     // If out pipe meets threshold → ready
     // OR if out pipe is colder than tank, check tank threshold → ready
-    bathIsReady = (outPipeTemp >= config.min_out_pipe_temp) || 
+    netBathReady = (outPipeTemp >= config.min_out_pipe_temp) || 
                   (outPipeTemp < tankTemp && tankTemp >= config.min_tank_temp);
-    display.updateBathStatus(bathIsReady);
-    display.updateHeatingStatus(heatingActive);
     Serial.print("Bath ready: ");
-    Serial.println(bathIsReady ? "YES" : "NO");
-    Serial.print("  Tank: "); Serial.print(tankTemp); Serial.print(" >= "); Serial.println(config.min_tank_temp);
-    Serial.print("  OutPipe: "); Serial.print(outPipeTemp); Serial.print(" >= "); Serial.println(config.min_out_pipe_temp);
+    Serial.println(netBathReady ? "YES" : "NO");
+    char tempBuf[16];
+    char limitBuf[16];
+    tempFormat(tankTemp, tempBuf, sizeof(tempBuf), 2);
+    tempFormat(config.min_tank_temp, limitBuf, sizeof(limitBuf), 2);
+    Serial.printf("  Tank: %s >= %s\n", tempBuf, limitBuf);
+    tempFormat(outPipeTemp, tempBuf, sizeof(tempBuf), 2);
+    tempFormat(config.min_out_pipe_temp, limitBuf, sizeof(limitBuf), 2);
+    Serial.printf("  OutPipe: %s >= %s\n", tempBuf, limitBuf);
     Serial.print("  OutPipe < Tank: "); Serial.println(outPipeTemp < tankTemp ? "YES" : "NO");
-    Serial.print("  Heating active: "); Serial.println(heatingActive ? "YES" : "NO");
+    Serial.print("  Heating active: "); Serial.println(netHeatingActive ? "YES" : "NO");
+    
+    // Poll faster while temperatures move or the bath state may flip
+    bool nearThreshold = (outPipeTemp != TEMP_INVALID && tempAbs(outPipeTemp - config.min_out_pipe_temp) < POLL_NEAR_THRESHOLD) ||
+                         (tankTemp != TEMP_INVALID && tempAbs(tankTemp - config.min_tank_temp) < POLL_NEAR_THRESHOLD);
+    TempCenti temps[PollScheduler::SENSOR_COUNT];
+    for (int i = 0; i < PollScheduler::SENSOR_COUNT; i++) {
+        const SensorReading& reading = sensorRegistry.get(i).reading;
+        temps[i] = reading.valid ? reading.value : TEMP_INVALID;
+    }
+    pollScheduler.update(temps, nearThreshold);
+    tempFormat(pollScheduler.getMaxSlope(), tempBuf, sizeof(tempBuf), 2);
+    Serial.printf("  Poll interval: %lu ms (slope %s °C/min)\n", pollScheduler.getInterval(), tempBuf);
+    
+    publishSnapshot();
 }
 
 // Fetch list of temperature sensors from Home Assistant
 void handleHAEntities() {
     Config config = configManager.getConfig();
+    HTTPClient http;
     
     // Get from POST body for security
     String ha_url = server.arg("ha_url");
@@ -722,6 +1002,7 @@ void handleHAEntities() {
 // Test HA connection
 void handleHATest() {
     Config config = configManager.getConfig();
+    HTTPClient http;
     
     // Get credentials from POST body, not URL params (security)
     String ha_url = server.arg("ha_url");
@@ -902,6 +1183,7 @@ void handleNotFound() {
  * - Status API (GET /status)
  * - HA integration (POST /ha/test, POST /ha/entities)
  * - Display test mode (GET /display-test)
+ * - Draw call profile (GET /debug/render, with -D RENDER_PROFILER)
  * 
  * All sensitive operations use POST to avoid token exposure in logs.
  */
@@ -913,6 +1195,10 @@ void startWebServer() {
     server.on("/ha/entities", HTTP_POST, handleHAEntities);  // POST for security
     server.on("/ha/test", HTTP_POST, handleHATest);          // POST for security
     server.on("/display-test", handleDisplayTest);
+    server.on("/history", handleHistory);
+#ifdef RENDER_PROFILER
+    server.on("/debug/render", handleRenderProfile);
+#endif
     server.begin();
     Serial.println("Web server started on port 80");
     Serial.print("Access at: http://");
@@ -921,6 +1207,8 @@ void startWebServer() {
 
 void handleConfig() {
     Config config = configManager.getConfig();
+    SensorSnapshot snap;
+    sensorSnapshot.read(snap);
     
     String html = "<!DOCTYPE html><html lang='en'><head>";
     html += "<meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'>";
@@ -954,10 +1242,13 @@ void handleConfig() {
     
     html += "<div class='section'>";
     html += "<h2>📊 Current Temperatures <span id='ha-conn' style='font-size:12px;'></span></h2>";
-    html += "<div class='temp-display'>Room: <span class='temp-value' id='t-room'>" + String(roomTemp, 1) + "°C</span></div>";
-    html += "<div class='temp-display'>Tank: <span class='temp-value' id='t-tank'>" + String(tankTemp, 1) + "°C</span></div>";
-    html += "<div class='temp-display'>Out Pipe: <span class='temp-value' id='t-out'>" + String(outPipeTemp, 1) + "°C</span></div>";
-    html += "<div class='temp-display'>Heating In: <span class='temp-value' id='t-hin'>" + String(heatingInTemp, 1) + "°C</span></div>";
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        if (strlen(config.sensors[i].entity_id) == 0) {
+            continue;
+        }
+        html += "<div class='temp-display'>" + String(SensorRegistry::roleLabel(config.sensors[i].role)) + ": ";
+        html += "<span class='temp-value' id='t-" + String(i) + "'>" + tempString(snap.sensors[i].value) + "°C</span></div>";
+    }
     html += "</div>";
     
     html += "<form method='POST' action='/save'>";
@@ -969,6 +1260,18 @@ void handleConfig() {
     html += "<input type='text' name='ha_url' id='ha_url' value='" + String(config.ha_url) + "' placeholder='http://homeassistant.local:8123'></div>";
     html += "<div class='form-group'><label>Long-Lived Access Token:</label>";
     html += "<input type='text' name='ha_token' id='ha_token' value='" + String(config.ha_token) + "' placeholder='Your HA token'></div>";
+    html += "<div class='form-group'><label>Certificate SHA-256 (https only, optional):</label>";
+    html += "<input type='text' name='ha_pin' value='" + String(config.ha_cert_sha256) + "' placeholder='AB:CD:... (empty = not verified)'></div>";
+    html += "<div class='form-group'><label>Fetch Mode:</label>";
+    html += "<select name='fetch_mode'>";
+    html += "<option value='batch'" + String(config.ha_batch_fetch ? " selected" : "") + ">Batch (one template request)</option>";
+    html += "<option value='single'" + String(config.ha_batch_fetch ? "" : " selected") + ">Per entity</option>";
+    html += "</select></div>";
+    html += "<div class='form-group'><label>Update Mode:</label>";
+    html += "<select name='update_mode'>";
+    html += "<option value='poll'" + String(config.ha_websocket ? "" : " selected") + ">Polling</option>";
+    html += "<option value='push'" + String(config.ha_websocket ? " selected" : "") + ">Push (WebSocket, polling fallback)</option>";
+    html += "</select></div>";
     html += "<button type='button' class='btn btn-secondary' onclick='testHA()'>🔌 Test Connection</button>";
     html += "<button type='button' class='btn btn-secondary' onclick='loadEntities()'>📥 Load Sensors</button>";
     html += "<button type='button' class='btn btn-secondary' onclick='testDisplay()'>🎨 Test Display</button>";
@@ -978,53 +1281,49 @@ void handleConfig() {
     html += "<h2>📡 Temperature Sensors</h2>";
     html += "<p style='color:#666;font-size:12px;'>Click 'Load Sensors' above to populate dropdowns from Home Assistant</p>";
     
-    // Tank temp
-    html += "<div class='form-group'><label>Tank Temperature:</label>";
-    html += "<select name='entity_tank' id='entity_tank'><option value=''>-- Select sensor --</option>";
-    if (strlen(config.entity_tank_temp) > 0) {
-        html += "<option value='" + String(config.entity_tank_temp) + "' selected>" + String(config.entity_tank_temp) + "</option>";
-    }
-    html += "</select></div>";
-    
-    // Out pipe temp
-    html += "<div class='form-group'><label>Out Pipe Temperature:</label>";
-    html += "<select name='entity_out' id='entity_out'><option value=''>-- Select sensor --</option>";
-    if (strlen(config.entity_out_pipe_temp) > 0) {
-        html += "<option value='" + String(config.entity_out_pipe_temp) + "' selected>" + String(config.entity_out_pipe_temp) + "</option>";
-    }
-    html += "</select></div>";
-    
-    // Heating in temp
-    html += "<div class='form-group'><label>Heating In Temperature:</label>";
-    html += "<select name='entity_heat_in' id='entity_heat_in'><option value=''>-- Select sensor --</option>";
-    if (strlen(config.entity_heating_in_temp) > 0) {
-        html += "<option value='" + String(config.entity_heating_in_temp) + "' selected>" + String(config.entity_heating_in_temp) + "</option>";
-    }
-    html += "</select></div>";
-    
-    // Room temp
-    html += "<div class='form-group'><label>Room Temperature:</label>";
-    html += "<select name='entity_room' id='entity_room'><option value=''>-- Select sensor --</option>";
-    if (strlen(config.entity_room_temp) > 0) {
-        html += "<option value='" + String(config.entity_room_temp) + "' selected>" + String(config.entity_room_temp) + "</option>";
+    html += "<p style='color:#666;font-size:12px;'>Tank and Out Pipe decide bath readiness, Heating In detects heating</p>";
+    
+    // One role + entity pair per registry slot
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        const SensorConfig& sensor = config.sensors[i];
+        String slot = String(i);
+        html += "<div class='form-group'><label>Sensor " + String(i + 1) + ":</label>";
+        html += "<select name='sensor_role_" + slot + "'>";
+        for (uint8_t role = ROLE_NONE; role < ROLE_COUNT; role++) {
+            html += "<option value='" + String(role) + "'" + String(sensor.role == role ? " selected" : "") + ">";
+            html += String(SensorRegistry::roleLabel(role)) + "</option>";
+        }
+        html += "</select>";
+        html += "<select name='sensor_entity_" + slot + "' class='entity-select' style='margin-top:5px;'><option value=''>-- Select sensor --</option>";
+        if (strlen(sensor.entity_id) > 0) {
+            html += "<option value='" + String(sensor.entity_id) + "' selected>" + String(sensor.entity_id) + "</option>";
+        }
+        html += "</select></div>";
     }
-    html += "</select></div>";
     html += "</div>";
     
     html += "<div class='section'>";
     html += "<h2>🌡️ Temperature Thresholds</h2>";
     html += "<div class='form-group'><label>Min Tank Temp (°C):</label>";
-    html += "<input type='text' inputmode='decimal' pattern='[0-9]*[.]?[0-9]*' name='min_tank' value='" + String(config.min_tank_temp, 1) + "'></div>";
+    html += "<input type='text' inputmode='decimal' pattern='[0-9]*[.]?[0-9]*' name='min_tank' value='" + tempString(config.min_tank_temp) + "'></div>";
     html += "<div class='form-group'><label>Min Out Pipe Temp (°C):</label>";
-    html += "<input type='text' inputmode='decimal' pattern='[0-9]*[.]?[0-9]*' name='min_out' value='" + String(config.min_out_pipe_temp, 1) + "'></div>";
+    html += "<input type='text' inputmode='decimal' pattern='[0-9]*[.]?[0-9]*' name='min_out' value='" + tempString(config.min_out_pipe_temp) + "'></div>";
     html += "<div class='form-group'><label>Poll Interval (seconds):</label>";
-    html += "<input type='number' name='poll_interval' value='" + String(config.poll_interval) + "' min='5' max='300'></div>";
+    html += "<input type='number' name='poll_interval' value='" + String(config.poll_interval) + "' min='1' max='3600'></div>";
+    html += "<div class='form-group'><label>Fastest Poll (seconds, temperatures changing):</label>";
+    html += "<input type='number' name='poll_min' value='" + String(config.poll_min_interval) + "' min='1' max='3600'></div>";
+    html += "<div class='form-group'><label>Slowest Poll (seconds, readings flat):</label>";
+    html += "<input type='number' name='poll_max' value='" + String(config.poll_max_interval) + "' min='1' max='3600'></div>";
     html += "</div>";
     
     html += "<div class='section'>";
     html += "<h2>🔆 Display Settings</h2>";
     html += "<div class='form-group'><label>Screen Brightness (0-255):</label>";
     html += "<input type='number' name='brightness' value='" + String(config.screen_brightness) + "' min='0' max='255'></div>";
+    html += "<div class='form-group'><label>Dim After (minutes without hot water, 0 = never):</label>";
+    html += "<input type='number' name='dim_after' value='" + String(config.screen_dim_after) + "' min='0' max='1440'></div>";
+    html += "<div class='form-group'><label>Screen Off After (minutes without hot water, 0 = never):</label>";
+    html += "<input type='number' name='sleep_after' value='" + String(config.screen_sleep_after) + "' min='0' max='1440'></div>";
     html += "</div>";
     
     html += "<button type='submit' class='btn'>💾 Save Configuration</button>";
@@ -1054,14 +1353,13 @@ void handleConfig() {
     html += "  fetch('/ha/entities',{method:'POST',body:formData}).then(r=>r.json()).then(d=>{";
     html += "    if(d.error){status.className='status error';status.innerHTML='❌ '+d.error;return;}";
     html += "    status.className='status success';status.innerHTML='✅ Found '+d.entities.length+' temperature sensors';";
-    html += "    var selects=['entity_tank','entity_out','entity_heat_in','entity_room'];";
-    html += "    selects.forEach(id=>{";
-    html += "      var sel=document.getElementById(id);";
+    html += "    document.querySelectorAll('.entity-select').forEach(sel=>{";
     html += "      var cur=sel.value;";
     html += "      sel.innerHTML='<option value=\"\">-- Select sensor --</option>';";
     html += "      d.entities.forEach(e=>{";
     html += "        var opt=document.createElement('option');";
     html += "        opt.value=e.id;opt.text=e.name+' ('+e.state+e.unit+')';";
+    html += "        if(e.id.length>" + String(ENTITY_ID_MAX - 1) + "){opt.disabled=true;opt.text+=' - ID too long';}";
     html += "        if(e.id===cur)opt.selected=true;";
     html += "        sel.appendChild(opt);";
     html += "      });";
@@ -1077,10 +1375,10 @@ void handleConfig() {
     html += "}";
     html += "function updateTemps(){";
     html += "  fetch('/status').then(r=>r.json()).then(d=>{";
-    html += "    document.getElementById('t-room').innerText=d.roomTemp.toFixed(1)+'°C';";
-    html += "    document.getElementById('t-tank').innerText=d.tankTemp.toFixed(1)+'°C';";
-    html += "    document.getElementById('t-out').innerText=d.outPipeTemp.toFixed(1)+'°C';";
-    html += "    document.getElementById('t-hin').innerText=d.heatingInTemp.toFixed(1)+'°C';";
+    html += "    d.sensors.forEach(s=>{";
+    html += "      var el=document.getElementById('t-'+s.slot);";
+    html += "      if(el)el.innerText=s.valid?s.value.toFixed(1)+'°C':'--';";
+    html += "    });";
     html += "    document.getElementById('ha-conn').innerHTML='<span style=\"color:#4CAF50\">● Live</span>';";
     html += "  }).catch(e=>{";
     html += "    document.getElementById('ha-conn').innerHTML='<span style=\"color:#f44336\">● Error</span>';";
@@ -1099,23 +1397,39 @@ void handleSaveConfig() {
     // Update Home Assistant settings
     server.arg("ha_url").toCharArray(config.ha_url, sizeof(config.ha_url));
     server.arg("ha_token").toCharArray(config.ha_token, sizeof(config.ha_token));
+    config.ha_batch_fetch = server.arg("fetch_mode") != "single";
+    config.ha_websocket = server.arg("update_mode") == "push";
+    if (!ConfigManager::normalizeCertPin(server.arg("ha_pin").c_str(), config.ha_cert_sha256, sizeof(config.ha_cert_sha256))) {
+        server.send(400, "text/html", "<html><body><h1>Error: Invalid certificate SHA-256 (64 hex digits)</h1></body></html>");
+        return;
+    }
     
-    // Update entity IDs
-    server.arg("entity_tank").toCharArray(config.entity_tank_temp, sizeof(config.entity_tank_temp));
-    server.arg("entity_out").toCharArray(config.entity_out_pipe_temp, sizeof(config.entity_out_pipe_temp));
-    server.arg("entity_heat_in").toCharArray(config.entity_heating_in_temp, sizeof(config.entity_heating_in_temp));
-    server.arg("entity_room").toCharArray(config.entity_room_temp, sizeof(config.entity_room_temp));
+    // Update sensor slots
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        long role = server.arg("sensor_role_" + String(i)).toInt();
+        if (role < ROLE_NONE || role >= ROLE_COUNT) {
+            server.send(400, "text/html", "<html><body><h1>Error: Invalid sensor role</h1></body></html>");
+            return;
+        }
+        config.sensors[i].role = (uint8_t)role;
+        String entity = server.arg("sensor_entity_" + String(i));
+        if (entity.length() > ENTITY_ID_MAX - 1) {
+            server.send(400, "text/html", "<html><body><h1>Error: Sensor entity ID longer than " + String(ENTITY_ID_MAX - 1) + " characters</h1></body></html>");
+            return;
+        }
+        entity.toCharArray(config.sensors[i].entity_id, sizeof(config.sensors[i].entity_id));
+    }
     
     // Update thresholds and settings with validation
-    float minTank = server.arg("min_tank").toFloat();
-    float minOut = server.arg("min_out").toFloat();
+    TempCenti minTank;
+    TempCenti minOut;
     
     // Validate temperature thresholds
-    if (minTank < 0.0 || minTank > 100.0) {
+    if (!tempParse(server.arg("min_tank").c_str(), &minTank) || minTank < 0 || minTank > 100 * TEMP_ONE_DEGREE) {
         server.send(400, "text/html", "<html><body><h1>Error: Invalid tank threshold (0-100°C)</h1></body></html>");
         return;
     }
-    if (minOut < 0.0 || minOut > 100.0) {
+    if (!tempParse(server.arg("min_out").c_str(), &minOut) || minOut < 0 || minOut > 100 * TEMP_ONE_DEGREE) {
         server.send(400, "text/html", "<html><body><h1>Error: Invalid out pipe threshold (0-100°C)</h1></body></html>");
         return;
     }
@@ -1123,28 +1437,55 @@ void handleSaveConfig() {
     config.min_tank_temp = minTank;
     config.min_out_pipe_temp = minOut;
     
-    config.poll_interval = server.arg("poll_interval").toInt();
-    if (config.poll_interval < 5) config.poll_interval = 5;
-    if (config.poll_interval > 300) config.poll_interval = 300;
+    int pollInterval = server.arg("poll_interval").toInt();
+    int pollMin = server.arg("poll_min").toInt();
+    int pollMax = server.arg("poll_max").toInt();
+    if (pollMin < 1 || pollMax < pollMin || pollMax > 3600) {
+        server.send(400, "text/html", "<html><body><h1>Error: Invalid poll range (1-3600 s, fastest &lt;= slowest)</h1></body></html>");
+        return;
+    }
     
     // Update display settings
     config.screen_brightness = server.arg("brightness").toInt();
     if (config.screen_brightness < 0) config.screen_brightness = 0;
     if (config.screen_brightness > 255) config.screen_brightness = 255;
     
-    // Save to NVS
+    int dimAfter = server.arg("dim_after").toInt();
+    int sleepAfter = server.arg("sleep_after").toInt();
+    if (dimAfter < 0 || dimAfter > 1440 || sleepAfter < 0 || sleepAfter > 1440) {
+        server.send(400, "text/html", "<html><body><h1>Error: Invalid screen timeouts (0-1440 minutes)</h1></body></html>");
+        return;
+    }
+    
+    // Save to NVS (the network task copies the config under the same lock)
+    xSemaphoreTake(configMutex, portMAX_DELAY);
     configManager.setHA(config.ha_url, config.ha_token);
-    configManager.setEntities(config.entity_tank_temp, config.entity_out_pipe_temp, 
-                              config.entity_heating_in_temp,
-                              config.entity_room_temp);
+    configManager.setBatchFetch(config.ha_batch_fetch);
+    configManager.setWebSocket(config.ha_websocket);
+    configManager.setCertPin(config.ha_cert_sha256);
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        // Another entity's readings must not continue this slot's history
+        if (strcmp(configManager.getConfig().sensors[i].entity_id, config.sensors[i].entity_id) != 0) {
+            history.clear(i);
+        }
+        configManager.setSensor(i, config.sensors[i].role, config.sensors[i].entity_id);
+    }
     configManager.setThresholds(config.min_tank_temp, config.min_out_pipe_temp);
     configManager.setBrightness(config.screen_brightness);
+    configManager.setScreenTimeouts(dimAfter, sleepAfter);
+    configManager.setPollIntervals(pollInterval, pollMin, pollMax);
     configManager.save();
+    xSemaphoreGive(configMutex);
     
     // Apply changes immediately without reboot
     display.setBrightness(config.screen_brightness);
+    display.setPowerTimeouts(configManager.getConfig().screen_dim_after * 60000UL,
+                             configManager.getConfig().screen_sleep_after * 60000UL);
     display.setThresholds(config.min_tank_temp, config.min_out_pipe_temp);
     
+    // Network task reconnects with the new server, token and entities
+    networkConfigChanged = true;
+    
     String html = "<!DOCTYPE html><html><head>";
     html += "<meta charset='UTF-8'>";
     html += "<meta http-equiv='refresh' content='2;url=/'>";
@@ -1158,19 +1499,109 @@ void handleSaveConfig() {
     server.send(200, "text/html", html);
 }
 
+/**
+ * @brief Value of the primary sensor of a role in a snapshot, TEMP_INVALID if none
+ */
+TempCenti snapshotValue(const SensorSnapshot& snap, uint8_t role) {
+    int slot = SensorRegistry::primarySlot(snap.sensors, role);
+    return slot >= 0 && snap.sensors[slot].valid ? snap.sensors[slot].value : TEMP_INVALID;
+}
+
+/**
+ * @brief Temperature as a JSON/HTML number with one decimal, 0.0 if invalid
+ */
+String tempString(TempCenti value) {
+    char buf[16];
+    tempFormat(value == TEMP_INVALID ? 0 : value, buf, sizeof(buf), 1);
+    return String(buf);
+}
+
 void handleStatus() {
+    // Consistent copy of the network task's state, read without blocking it
+    SensorSnapshot snap;
+    sensorSnapshot.read(snap);
+    Config config = configManager.getConfig();
+    unsigned long now = millis();
+    
     Serial.println("Status request - sending temps:");
-    Serial.print("  roomTemp="); Serial.println(roomTemp);
-    Serial.print("  tankTemp="); Serial.println(tankTemp);
-    Serial.print("  outPipeTemp="); Serial.println(outPipeTemp);
+    Serial.print("  roomTemp="); Serial.println(tempString(snapshotValue(snap, ROLE_ROOM)));
+    Serial.print("  tankTemp="); Serial.println(tempString(snapshotValue(snap, ROLE_TANK)));
+    Serial.print("  outPipeTemp="); Serial.println(tempString(snapshotValue(snap, ROLE_OUT_PIPE)));
     
     String json = "{";
-    json += "\"roomTemp\":" + String(roomTemp, 1) + ",";
-    json += "\"tankTemp\":" + String(tankTemp, 1) + ",";
-    json += "\"outPipeTemp\":" + String(outPipeTemp, 1) + ",";
-    json += "\"heatingInTemp\":" + String(heatingInTemp, 1) + ",";
+    json += "\"roomTemp\":" + tempString(snapshotValue(snap, ROLE_ROOM)) + ",";
+    json += "\"tankTemp\":" + tempString(snapshotValue(snap, ROLE_TANK)) + ",";
+    json += "\"outPipeTemp\":" + tempString(snapshotValue(snap, ROLE_OUT_PIPE)) + ",";
+    json += "\"heatingInTemp\":" + tempString(snapshotValue(snap, ROLE_HEATING_IN)) + ",";
+    json += "\"sensors\":[";
+    bool first = true;
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        const SensorReading& reading = snap.sensors[i];
+        if (strlen(config.sensors[i].entity_id) == 0) {
+            continue;
+        }
+        if (!first) json += ",";
+        first = false;
+        json += "{\"slot\":" + String(i);
+        json += ",\"role\":\"" + String(SensorRegistry::roleName(reading.role)) + "\"";
+        json += ",\"entity\":\"" + String(config.sensors[i].entity_id) + "\"";
+        json += ",\"valid\":" + String(reading.valid ? "true" : "false");
+        json += ",\"value\":" + tempString(reading.value);
+        json += ",\"ageMs\":" + String(reading.valid ? now - reading.updatedAt : 0);
+        const SensorHistory& slotHistory = history.get(i);
+        json += ",\"historyHours\":" + String((slotHistory.getEnd() - slotHistory.getFirst()) * (HISTORY_INTERVAL_MS / 1000) / 3600.0, 1) + "}";
+    }
+    json += "],";
     json += "\"wifiConnected\":" + String(wifiConnected ? "true" : "false") + ",";
-    json += "\"haConnected\":" + String(haConnected ? "true" : "false");
+    json += "\"haConnected\":" + String(snap.haConnected ? "true" : "false") + ",";
+    json += "\"pollMode\":\"" + String(snap.lastPollBatched ? "batch" : "per-entity") + "\",";
+    json += "\"pollMs\":" + String(snap.lastPollMs) + ",";
+    json += "\"pollAvgMs\":" + String(snap.pollAvgMs) + ",";
+    json += "\"pollCount\":" + String(snap.pollCount) + ",";
+    json += "\"pollIntervalMs\":" + String(snap.pollIntervalMs) + ",";
+    json += "\"haRequests\":" + String(snap.haRequests) + ",";
+    json += "\"haReuseRate\":" + String(snap.haRequests > 0 ? 100.0 * snap.haReused / snap.haRequests : 0.0, 1) + ",";
+    json += "\"haHandshakes\":" + String(snap.haHandshakes) + ",";
+    json += "\"tlsFull\":" + String(snap.tlsFull) + ",";
+    json += "\"tlsFullAvgMs\":" + String(snap.tlsFullAvgMs) + ",";
+    json += "\"tlsResumed\":" + String(snap.tlsResumed) + ",";
+    json += "\"tlsResumedAvgMs\":" + String(snap.tlsResumedAvgMs) + ",";
+    json += "\"tlsFullHeap\":" + String(snap.tlsFullHeap) + ",";
+    json += "\"tlsResumedHeap\":" + String(snap.tlsResumedHeap) + ",";
+    json += "\"heapFree\":" + String(ESP.getFreeHeap()) + ",";
+    json += "\"heapMinFree\":" + String(ESP.getMinFreeHeap()) + ",";
+    json += "\"haPush\":" + String(snap.pushActive ? "true" : "false") + ",";
+    json += "\"pushEvents\":" + String(snap.pushEvents) + ",";
+    json += "\"restBreaker\":\"" + String(CircuitBreaker::stateName((CircuitBreaker::State)snap.restBreaker)) + "\",";
+    json += "\"restFailures\":" + String(snap.restFailures) + ",";
+    json += "\"restFailuresTotal\":" + String(snap.restFailuresTotal) + ",";
+    json += "\"restRetryInMs\":" + String(snap.restRetryInMs) + ",";
+    json += "\"wsBreaker\":\"" + String(CircuitBreaker::stateName((CircuitBreaker::State)snap.wsBreaker)) + "\",";
+    json += "\"wsFailures\":" + String(snap.wsFailures) + ",";
+    const AnimationStats& anim = display.getAnimationStats();
+    json += "\"animFrames\":" + String(anim.frames) + ",";
+    json += "\"animFps\":" + String(anim.avgIntervalUs > 0 ? 1000000.0 / anim.avgIntervalUs : 0.0, 1) + ",";
+    json += "\"animLateFrames\":" + String(anim.lateFrames) + ",";
+    json += "\"animMaxGapMs\":" + String(anim.maxIntervalUs / 1000) + ",";
+    json += "\"animRenderUs\":" + String(anim.avgRenderUs) + ",";
+    const RenderStats& render = display.getRenderStats();
+    json += "\"renderFrames\":" + String(render.frames) + ",";
+    json += "\"renderFullFrames\":" + String(render.fullFrames) + ",";
+    json += "\"renderPaletteFrames\":" + String(render.paletteFrames) + ",";
+    json += "\"spiBytesLast\":" + String(render.lastBytes) + ",";
+    json += "\"spiBytesAvg\":" + String(render.avgBytes) + ",";
+    json += "\"spiTransfersLast\":" + String(render.lastTransfers) + ",";
+    const DisplayPower& power = display.getPower();
+    unsigned long powerNow = millis();
+    json += "\"displayPower\":\"" + String(DisplayPower::stateName(power.getState())) + "\",";
+    json += "\"displayActiveS\":" + String(power.getSecondsIn(DisplayPower::ACTIVE, powerNow)) + ",";
+    json += "\"displayDimmedS\":" + String(power.getSecondsIn(DisplayPower::DIMMED, powerNow)) + ",";
+    json += "\"displayAsleepS\":" + String(power.getSecondsIn(DisplayPower::ASLEEP, powerNow)) + ",";
+    json += "\"displayWakeups\":" + String(power.getWakeups()) + ",";
+    json += "\"trendSamples\":" + String(display.getTrend().getCount()) + ",";
+    json += "\"historyBytes\":" + String((unsigned long)history.getBytesUsed()) + ",";
+    json += "\"loopMaxUs\":" + String(loopMaxUs) + ",";
+    json += "\"loopP99Us\":" + String(loopP99Us());
     json += "}";
     
     server.send(200, "application/json", json);
@@ -1188,15 +1619,11 @@ void handleDisplayTest() {
     
     // When exiting test mode, immediately return to production
     if (!testMode) {
-        // Reset heating state (will be detected properly on next poll)
-        heatingActive = false;
+        // Ask the network task for fresh sensor data
+        pollRequested = true;
         
-        // Force immediate HA poll to get real sensor data
-        pollHomeAssistant();
-        
-        // Force display update with actual data
-        display.updateBathStatus(bathIsReady);
-        display.updateHeatingStatus(heatingActive);
+        // Force display update with the latest real data
+        applySensorSnapshot(true);
         
         // Force immediate display refresh to clear test state
         display.refresh();
@@ -1205,3 +1632,131 @@ void handleDisplayTest() {
     }
 }
 
+/**
+ * @brief Downsampled history of one sensor slot
+ * 
+ * GET /history?slot=0&minutes=60&points=60 splits the last minutes into
+ * points buckets, oldest first, with the mean, min and max reading of each
+ * (null where the slot had no reading).
+ */
+void handleHistory() {
+    const int MAX_POINTS = 240;
+    long slot = server.arg("slot").toInt();
+    long minutes = server.hasArg("minutes") ? server.arg("minutes").toInt() : 60;
+    long points = server.hasArg("points") ? server.arg("points").toInt() : 60;
+    if (slot < 0 || slot >= MAX_SENSORS || minutes < 1 || minutes > 2880 || points < 1 || points > MAX_POINTS) {
+        server.send(400, "application/json", "{\"error\":\"slot 0-7, minutes 1-2880, points 1-240\"}");
+        return;
+    }
+    
+    static HistoryBucket buckets[MAX_POINTS];
+    uint32_t to = history.getSequence();
+    uint32_t from = history.sequenceAt(millis() - minutes * 60000UL);
+    int count = history.get(slot).downsample(from, to, points, buckets);
+    
+    String means = "[";
+    String mins = "[";
+    String maxes = "[";
+    for (int i = 0; i < count; i++) {
+        if (i > 0) {
+            means += ",";
+            mins += ",";
+            maxes += ",";
+        }
+        bool valid = buckets[i].samples > 0;
+        means += valid ? tempString(buckets[i].mean) : String("null");
+        mins += valid ? tempString(buckets[i].min) : String("null");
+        maxes += valid ? tempString(buckets[i].max) : String("null");
+    }
+    
+    String json = "{\"slot\":" + String(slot);
+    json += ",\"intervalMs\":" + String(HISTORY_INTERVAL_MS);
+    json += ",\"samples\":" + String(to - from);
+    json += ",\"mean\":" + means + "]";
+    json += ",\"min\":" + mins + "]";
+    json += ",\"max\":" + maxes + "]}";
+    
+    server.send(200, "application/json", json);
+}
+
+#ifdef RENDER_PROFILER
+/**
+ * @brief One profiler counter as a JSON object
+ */
+String renderCounterJson(const char* name, const RenderCounter& counter) {
+    String json = "{\"name\":\"" + String(name) + "\"";
+    json += ",\"calls\":" + String(counter.calls);
+    json += ",\"pixels\":" + String(counter.pixels);
+    json += ",\"us\":" + String(counter.us) + "}";
+    return json;
+}
+
+/**
+ * @brief Draw call counts, pixels and time per primitive and per scene
+ * 
+ * GET /debug/render?reset=1 returns the counters and starts over.
+ */
+void handleRenderProfile() {
+    String json = "{\"periodMs\":" + String(millis() - renderProfile.sinceMs);
+    json += ",\"primitives\":[";
+    for (int i = 0; i < PRIM_COUNT; i++) {
+        if (i > 0) json += ",";
+        json += renderCounterJson(renderPrimitiveName(i), renderProfile.primitives[i]);
+    }
+    json += "],\"scenes\":[";
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        if (i > 0) json += ",";
+        json += renderCounterJson(renderSceneName(i), renderProfile.scenes[i]);
+    }
+    json += "]}";
+    
+    server.send(200, "application/json", json);
+    
+    if (server.hasArg("reset")) {
+        renderProfileReset();
+    }
+}
+#endif
+
+#ifdef TEMP_BENCHMARK
+/**
+ * @brief Compare CPU cycles of the old float temperature path with TempCenti
+ * 
+ * Build with -D TEMP_BENCHMARK; results are printed once at boot. Each
+ * path parses a state string, checks it against the last value, converts
+ * it to Fahrenheit and formats it for the display, as one reading did.
+ */
+void runTemperatureBenchmark() {
+    const int ITERATIONS = 1000;
+    const char* states[4] = { "54.25", "38.1", "21.63", "-3.5" };
+    char buf[16];
+    volatile int sink = 0;
+    
+    uint32_t start = ESP.getCycleCount();
+    float lastFloat = 0.0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        float value = String(states[i & 3]).toFloat();
+        if (abs(lastFloat - value) > 0.1) sink++;
+        lastFloat = value;
+        float fahrenheit = (value * 9.0 / 5.0) + 32.0;
+        snprintf(buf, sizeof(buf), "%.1f", fahrenheit);
+        sink += buf[0];
+    }
+    uint32_t floatCycles = ESP.getCycleCount() - start;
+    
+    start = ESP.getCycleCount();
+    TempCenti lastCenti = 0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        TempCenti value = 0;
+        tempParse(states[i & 3], &value);
+        if (tempAbs(lastCenti - value) > 10) sink++;
+        lastCenti = value;
+        tempFormat(tempToFahrenheit(value), buf, sizeof(buf), 1);
+        sink += buf[0];
+    }
+    uint32_t fixedCycles = ESP.getCycleCount() - start;
+    
+    Serial.printf("Temperature benchmark (%d readings): float %lu cycles/reading, fixed-point %lu cycles/reading\n",
+                  ITERATIONS, (unsigned long)(floatCycles / ITERATIONS), (unsigned long)(fixedCycles / ITERATIONS));
+}
+#endif
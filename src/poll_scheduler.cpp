@@ -0,0 +1,79 @@
+#include "poll_scheduler.h"
+
+// Slope thresholds in centi-degrees per minute
+const TempCenti FAST_SLOPE = 50;  // 0.5 °C/min, bath fill / heating: poll at the floor
+const TempCenti FLAT_SLOPE = 5;   // 0.05 °C/min, nothing moving: back off
+const unsigned long MIN_SLOPE_WINDOW = 1000;  // Ignore readings closer than 1 s
+
+PollScheduler::PollScheduler() {
+    floorMs = 2000;
+    nominalMs = 10000;
+    ceilingMs = 120000;
+    interval = nominalMs;
+    maxSlope = 0;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        lastTemps[i] = TEMP_INVALID;
+    }
+    lastUpdate = 0;
+    hasLast = false;
+}
+
+void PollScheduler::configure(unsigned long floor, unsigned long nominal, unsigned long ceiling) {
+    floorMs = floor;
+    ceilingMs = ceiling < floor ? floor : ceiling;
+    nominalMs = nominal;
+    nominalMs = clamp(nominalMs);
+    interval = clamp(interval);
+}
+
+unsigned long PollScheduler::clamp(unsigned long ms) const {
+    if (ms < floorMs) return floorMs;
+    if (ms > ceilingMs) return ceilingMs;
+    return ms;
+}
+
+/**
+ * @brief Feed the latest readings and recompute the interval
+ *
+ * @param temps Current value per sensor slot, TEMP_INVALID = no valid reading
+ * @param nearThreshold Tank or out pipe is close to its bath threshold
+ */
+void PollScheduler::update(const TempCenti temps[], bool nearThreshold) {
+    unsigned long now = millis();
+    unsigned long elapsed = now - lastUpdate;
+
+    if (hasLast && elapsed < MIN_SLOPE_WINDOW) {
+        return;
+    }
+
+    // Steepest change across all sensors with two valid readings
+    TempCenti slope = 0;
+    if (hasLast) {
+        for (int i = 0; i < SENSOR_COUNT; i++) {
+            if (temps[i] != TEMP_INVALID && lastTemps[i] != TEMP_INVALID) {
+                TempCenti s = (TempCenti)((int64_t)tempAbs(temps[i] - lastTemps[i]) * 60000 / elapsed);
+                if (s > slope) slope = s;
+            }
+        }
+    }
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        lastTemps[i] = temps[i];
+    }
+    lastUpdate = now;
+    maxSlope = slope;
+
+    if (!hasLast) {
+        hasLast = true;
+        interval = nominalMs;
+    } else if (slope >= FAST_SLOPE) {
+        interval = floorMs;
+    } else if (nearThreshold) {
+        unsigned long halved = interval / 2;
+        interval = halved < nominalMs ? halved : nominalMs;
+    } else if (slope < FLAT_SLOPE) {
+        interval = interval * 2;
+    } else {
+        interval = nominalMs;
+    }
+    interval = clamp(interval);
+}
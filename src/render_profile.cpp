@@ -0,0 +1,71 @@
+#include "render_profile.h"
+
+#ifdef RENDER_PROFILER
+
+RenderProfile renderProfile;
+
+static RenderScene currentScene = SCENE_FRAME;
+
+static const char* PRIMITIVE_NAMES[PRIM_COUNT] = {
+    "fill", "circle", "line", "text", "image", "sprite", "panelPush"
+};
+
+static const char* SCENE_NAMES[SCENE_COUNT] = {
+    "frame", "stop", "bathImage", "roomTemp", "heating", "trend", "link", "statusPage"
+};
+
+static void addTo(RenderCounter& counter, unsigned long pixels, unsigned long us) {
+    counter.calls++;
+    counter.pixels += pixels;
+    counter.us += us;
+}
+
+void renderProfileRecord(RenderPrimitive primitive, unsigned long pixels, unsigned long us) {
+    addTo(renderProfile.primitives[primitive], pixels, us);
+    addTo(renderProfile.scenes[currentScene], pixels, us);
+}
+
+void renderProfileReset() {
+    memset(&renderProfile, 0, sizeof(renderProfile));
+    renderProfile.sinceMs = millis();
+}
+
+const char* renderPrimitiveName(int primitive) {
+    return primitive >= 0 && primitive < PRIM_COUNT ? PRIMITIVE_NAMES[primitive] : "?";
+}
+
+const char* renderSceneName(int scene) {
+    return scene >= 0 && scene < SCENE_COUNT ? SCENE_NAMES[scene] : "?";
+}
+
+static void printCounter(const char* name, const RenderCounter& counter) {
+    if (counter.calls == 0) {
+        return;
+    }
+    Serial.printf("  %-11s %8lu calls %10lu px %9lu us %7lu us/call\n",
+                  name, counter.calls, counter.pixels, counter.us, counter.us / counter.calls);
+}
+
+/**
+ * @brief Dump the counters since the last reset to serial
+ */
+void renderProfilePrint() {
+    Serial.printf("Render profile, last %lu s:\n", (millis() - renderProfile.sinceMs) / 1000);
+    for (int i = 0; i < PRIM_COUNT; i++) {
+        printCounter(renderPrimitiveName(i), renderProfile.primitives[i]);
+    }
+    Serial.println(" by scene:");
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        printCounter(renderSceneName(i), renderProfile.scenes[i]);
+    }
+}
+
+RenderSceneScope::RenderSceneScope(RenderScene scene) : previous(currentScene) {
+    currentScene = scene;
+}
+
+RenderSceneScope::~RenderSceneScope() {
+    currentScene = previous;
+}
+
+#endif
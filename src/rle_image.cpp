@@ -0,0 +1,91 @@
+#include "rle_image.h"
+#include <string.h>
+
+RleDecoder::RleDecoder() : img(nullptr), pos(nullptr), row(0) {
+}
+
+void RleDecoder::begin(const RleImage* image) {
+    img = image;
+    rewind();
+}
+
+void RleDecoder::rewind() {
+    pos = img != nullptr ? img->data : nullptr;
+    row = 0;
+}
+
+/**
+ * @brief Move to the start of a row, skipping tokens without decoding them
+ */
+void RleDecoder::seekRow(int target) {
+    if (img == nullptr || target >= img->height) {
+        return;
+    }
+    if (target < row) {
+        rewind();
+    }
+    while (row < target) {
+        int x = 0;
+        while (x < img->width) {
+            uint8_t header = *pos++;
+            int n = (header & 0x7F) + 1;
+            pos += (header & 0x80) ? 2 : n * 2;
+            x += n;
+        }
+        row++;
+    }
+}
+
+/**
+ * @brief Decode the current row and advance to the next
+ *
+ * @param out Receives pixels [skip, skip + count) of the row
+ * @param skip Pixels to drop at the left (clipping)
+ * @param count Pixels to write
+ */
+void RleDecoder::decodeRow(uint16_t* out, int skip, int count) {
+    if (img == nullptr || row >= img->height) {
+        return;
+    }
+    int end = skip + count;
+    int x = 0;
+    while (x < img->width) {
+        uint8_t header = *pos++;
+        int n = (header & 0x7F) + 1;
+        
+        // Part of this token inside [skip, end)
+        int from = x > skip ? x : skip;
+        int to = x + n < end ? x + n : end;
+        
+        if (header & 0x80) {
+            if (from < to) {
+                uint16_t value = pos[0] | (pos[1] << 8);
+                for (int i = from; i < to; i++) {
+                    out[i - skip] = value;
+                }
+            }
+            pos += 2;
+        } else {
+            if (from < to) {
+                memcpy(out + (from - skip), pos + (from - x) * 2, (to - from) * 2);
+            }
+            pos += n * 2;
+        }
+        x += n;
+    }
+    row++;
+}
+
+/**
+ * @brief FNV-1a over the little-endian bytes of decoded pixels
+ *
+ * Start with RLE_CHECKSUM_SEED; the result after the last row must equal
+ * RleImage::checksum (computed by the generator from the source PNG).
+ */
+uint32_t rleChecksum(uint32_t hash, const uint16_t* pixels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        hash = (hash ^ (pixels[i] & 0xFF)) * 16777619UL;
+        hash = (hash ^ (pixels[i] >> 8)) * 16777619UL;
+    }
+    return hash;
+}
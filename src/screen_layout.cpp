@@ -0,0 +1,80 @@
+#include "screen_layout.h"
+#include "asset_ids.h"
+#include "trend_history.h"
+
+#define LGFX_USE_V1
+#include <LovyanGFX.hpp>
+
+const int STOP_RADIUS = 80;
+
+// Trend page: legend on top, axis labels left of the chart, span below
+const int TREND_CHART_X = 40;
+const int TREND_CHART_Y = 24;
+const int TREND_CHART_HEIGHT = 124;
+
+static const WidgetSpec SCENE_WIDGETS[] = {
+    inSlot(WIDGET_BATH_IMAGE, SCENE_BATH_IMAGE, imageSpec(TC_DATUM, SCREEN_CENTER_X, 0, ASSET_BABY_BATH_172)),
+    inSlot(WIDGET_STOP_SIGN, SCENE_STOP,
+           discSpec(SCREEN_CENTER_X, SCREEN_CENTER_Y, STOP_RADIUS, 3, TFT_RED, TFT_WHITE, "STOP", 4, 2)),
+    inSlot(WIDGET_ROOM_WAITING, SCENE_ROOM_TEMP,
+           labelSpec(MC_DATUM, SCREEN_CENTER_X, SCREEN_CENTER_Y, "Waiting...", 4, 2, TFT_YELLOW, TFT_BLACK)),
+    inSlot(WIDGET_ROOM_GLYPH, SCENE_ROOM_TEMP, bigNumberSpec(MC_DATUM, SCREEN_CENTER_X, SCREEN_CENTER_Y - 10)),
+    inSlot(WIDGET_ROOM_LABEL, SCENE_ROOM_TEMP,
+           labelSpec(MC_DATUM, SCREEN_CENTER_X, SCREEN_CENTER_Y + 65, "Room", 4, 2, TFT_WHITE, TFT_BLACK)),
+    inSlot(WIDGET_TREND_CHART, SCENE_TREND,
+           sparklineSpec(TL_DATUM, TREND_CHART_X, TREND_CHART_Y, TREND_SAMPLES, TREND_CHART_HEIGHT)),
+    inSlot(WIDGET_TREND_MAX, SCENE_TREND,
+           labelSpec(TR_DATUM, TREND_CHART_X - 4, TREND_CHART_Y, nullptr, 2, 1, TFT_WHITE, TFT_BLACK)),
+    inSlot(WIDGET_TREND_MIN, SCENE_TREND,
+           labelSpec(BR_DATUM, TREND_CHART_X - 4, TREND_CHART_Y + TREND_CHART_HEIGHT, nullptr, 2, 1,
+                     TFT_WHITE, TFT_BLACK)),
+    inSlot(WIDGET_TREND_TANK, SCENE_TREND,
+           labelSpec(TL_DATUM, TREND_CHART_X, 4, "Tank", 2, 1, TFT_RED, TFT_BLACK)),
+    inSlot(WIDGET_TREND_OUT_PIPE, SCENE_TREND,
+           labelSpec(TL_DATUM, TREND_CHART_X + 60, 4, "Out pipe", 2, 1, TFT_ORANGE, TFT_BLACK)),
+    inSlot(WIDGET_TREND_HEATING_IN, SCENE_TREND,
+           labelSpec(TL_DATUM, TREND_CHART_X + 140, 4, "Heating in", 2, 1, TFT_YELLOW, TFT_BLACK)),
+    inSlot(WIDGET_TREND_SPAN, SCENE_TREND,
+           labelSpec(BC_DATUM, TREND_CHART_X + TREND_SAMPLES / 2, SCREEN_HEIGHT - 2, "Last 6 h", 2, 1,
+                     TFT_WHITE, TFT_BLACK)),
+    inSlot(WIDGET_WAVES_LEFT, SCENE_HEATING, stripSpec(TL_DATUM, 0, 0, HEAT_STRIP_WIDTH, SCREEN_HEIGHT)),
+    inSlot(WIDGET_WAVES_RIGHT, SCENE_HEATING,
+           stripSpec(TR_DATUM, SCREEN_WIDTH, 0, HEAT_STRIP_WIDTH, SCREEN_HEIGHT)),
+    // Colour follows the breaker: red = backing off, orange = retrying
+    inSlot(WIDGET_LINK, SCENE_LINK, discSpec(310, 10, 6, 1, TFT_RED, TFT_WHITE)),
+};
+static_assert(sizeof(SCENE_WIDGETS) / sizeof(SCENE_WIDGETS[0]) == WIDGET_COUNT - ROOM_GLYPHS + 1,
+              "SCENE_WIDGETS needs one entry per DisplayWidget");
+
+const ScreenLayout SCENE_SCREEN = { TFT_BLACK, SCENE_WIDGETS, sizeof(SCENE_WIDGETS) / sizeof(SCENE_WIDGETS[0]) };
+
+// Gear icon
+static const WidgetSpec CONFIG_WIDGETS[] = {
+    discSpec(SCREEN_CENTER_X, 70, 40, 0, TFT_ORANGE, TFT_ORANGE),
+    discSpec(SCREEN_CENTER_X, 70, 25, 0, TFT_NAVY, TFT_NAVY),
+    labelSpec(MC_DATUM, SCREEN_CENTER_X, 128, "CONFIG MODE", 4, 1, TFT_WHITE, TFT_NAVY),
+    labelSpec(BC_DATUM, SCREEN_CENTER_X, 165, "Connect to: Water-Status-AP", 2, 1, TFT_WHITE, TFT_NAVY),
+};
+
+const ScreenLayout CONFIG_SCREEN = { TFT_NAVY, CONFIG_WIDGETS, sizeof(CONFIG_WIDGETS) / sizeof(CONFIG_WIDGETS[0]) };
+
+// Checkmark in a ring
+static const WidgetSpec WIFI_WIDGETS[] = {
+    discSpec(SCREEN_CENTER_X, 70, 40, 0, TFT_GREEN, TFT_GREEN),
+    discSpec(SCREEN_CENTER_X, 70, 35, 0, TFT_DARKGREEN, TFT_DARKGREEN),
+    checkSpec(SCREEN_CENTER_X, 70, 15, 3, TFT_GREEN),
+    labelSpec(MC_DATUM, SCREEN_CENTER_X, 128, "WiFi Connected!", 4, 1, TFT_WHITE, TFT_DARKGREEN),
+    labelSpec(BC_DATUM, SCREEN_CENTER_X, 165, nullptr, 4, 1, TFT_WHITE, TFT_DARKGREEN),
+};
+
+const ScreenLayout WIFI_SCREEN = { TFT_DARKGREEN, WIFI_WIDGETS, sizeof(WIFI_WIDGETS) / sizeof(WIFI_WIDGETS[0]) };
+
+// Checkmark on a filled disc
+static const WidgetSpec STARTUP_WIDGETS[] = {
+    discSpec(SCREEN_CENTER_X, 60, 40, 1, TFT_GREEN, TFT_WHITE),
+    checkSpec(SCREEN_CENTER_X, 60, 15, 2, TFT_WHITE),
+    labelSpec(MC_DATUM, SCREEN_CENTER_X, 120, "WiFi Connected!", 4, 1, TFT_WHITE, TFT_DARKGREEN),
+    labelSpec(BC_DATUM, SCREEN_CENTER_X, 160, nullptr, 4, 1, TFT_WHITE, TFT_DARKGREEN),
+};
+
+const ScreenLayout STARTUP_SCREEN = { TFT_DARKGREEN, STARTUP_WIDGETS, sizeof(STARTUP_WIDGETS) / sizeof(STARTUP_WIDGETS[0]) };
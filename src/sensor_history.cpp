@@ -0,0 +1,301 @@
+#include "sensor_history.h"
+
+// Block codes, see SensorHistory
+const uint8_t CODE_DELTA_ZERO = 100;
+const int DELTA_MAX = 100;          // Centi-degrees either way
+const uint8_t CODE_REPEAT = 200;    // + count
+const int REPEAT_MAX = 50;
+const uint8_t CODE_NONE = 251;
+const uint8_t CODE_ABSOLUTE = 252;
+
+static TempCenti toCenti(int16_t value) {
+    return value == HISTORY_NONE ? TEMP_INVALID : value;
+}
+
+SensorHistory::SensorHistory() {
+    clear(0);
+}
+
+/**
+ * @brief Drop all samples; the next one appended gets sequence number next
+ */
+void SensorHistory::clear(uint32_t next) {
+    oldest = 0;
+    blockCount = 0;
+    end = next;
+    last = HISTORY_NONE;
+    runAt = -1;
+}
+
+/**
+ * @brief Append the next sample, TEMP_INVALID without a reading
+ *
+ * Values outside the int16_t range are stored as no reading.
+ */
+void SensorHistory::append(TempCenti value) {
+    int16_t stored = value > HISTORY_NONE && value <= INT16_MAX ? (int16_t)value : HISTORY_NONE;
+
+    if (stored == last) {
+        // Same as before: count it in the open repeat code if there is room
+        if (runAt >= 0 && blocks[blockAt(blockCount - 1)].data[runAt] < CODE_REPEAT + REPEAT_MAX) {
+            HistoryBlock& block = blocks[blockAt(blockCount - 1)];
+            block.data[runAt]++;
+            block.samples++;
+        } else {
+            uint8_t* code = reserve(1);
+            *code = CODE_REPEAT + 1;
+            runAt = code - blocks[blockAt(blockCount - 1)].data;
+        }
+    } else if (stored == HISTORY_NONE) {
+        *reserve(1) = CODE_NONE;
+        runAt = -1;
+    } else if (last != HISTORY_NONE && abs(stored - last) <= DELTA_MAX) {
+        *reserve(1) = (uint8_t)(CODE_DELTA_ZERO + stored - last);
+        runAt = -1;
+    } else {
+        uint8_t* code = reserve(3);
+        code[0] = CODE_ABSOLUTE;
+        code[1] = (uint8_t)(stored & 0xFF);
+        code[2] = (uint8_t)((uint16_t)stored >> 8);
+        runAt = -1;
+    }
+    last = stored;
+    end++;
+}
+
+/**
+ * @brief Room for one more sample's code in the newest block
+ *
+ * Starts a new block when the newest one is full, dropping the oldest
+ * block once all HISTORY_BLOCKS are in use.
+ */
+uint8_t* SensorHistory::reserve(int bytes) {
+    if (blockCount == 0 || blocks[blockAt(blockCount - 1)].used + bytes > HISTORY_BLOCK_BYTES) {
+        if (blockCount == HISTORY_BLOCKS) {
+            oldest = (oldest + 1) % HISTORY_BLOCKS;
+            blockCount--;
+        }
+        HistoryBlock& fresh = blocks[blockAt(blockCount)];
+        fresh.first = end;
+        fresh.samples = 0;
+        fresh.base = last;
+        fresh.used = 0;
+        blockCount++;
+        runAt = -1;
+    }
+
+    HistoryBlock& block = blocks[blockAt(blockCount - 1)];
+    uint8_t* code = block.data + block.used;
+    block.used += bytes;
+    block.samples++;
+    return code;
+}
+
+uint32_t SensorHistory::getFirst() const {
+    return blockCount > 0 ? blocks[oldest].first : end;
+}
+
+/**
+ * @brief Encoded bytes in use, without block headers
+ */
+size_t SensorHistory::getBytesUsed() const {
+    size_t bytes = 0;
+    for (int i = 0; i < blockCount; i++) {
+        bytes += blocks[blockAt(i)].used;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Index (from the oldest) of the block holding a sample, 0 if it is older
+ */
+int SensorHistory::findBlock(uint32_t sequence) const {
+    int low = 0;
+    int high = blockCount - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (blocks[blockAt(mid)].first <= sequence) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Decode the code at pos: updates value and returns how many samples have it
+ */
+int SensorHistory::nextRun(const HistoryBlock& block, int& pos, int16_t& value) {
+    uint8_t code = block.data[pos++];
+    if (code <= CODE_DELTA_ZERO + DELTA_MAX) {
+        value = (int16_t)(value + code - CODE_DELTA_ZERO);
+        return 1;
+    }
+    if (code <= CODE_REPEAT + REPEAT_MAX) {
+        return code - CODE_REPEAT;
+    }
+    if (code == CODE_NONE) {
+        value = HISTORY_NONE;
+        return 1;
+    }
+    value = (int16_t)(block.data[pos] | (block.data[pos + 1] << 8));
+    pos += 2;
+    return 1;
+}
+
+/**
+ * @brief Samples from .. to - 1, oldest first, TEMP_INVALID without a reading
+ *
+ * Samples that were already dropped are skipped, so out[0] is sample
+ * max(from, getFirst()).
+ *
+ * @return Number of values written, at most max
+ */
+int SensorHistory::read(uint32_t from, uint32_t to, TempCenti* out, int max) const {
+    uint32_t start = from > getFirst() ? from : getFirst();
+    uint32_t stop = to < end ? to : end;
+    int count = 0;
+
+    for (int i = findBlock(start); i < blockCount && count < max; i++) {
+        const HistoryBlock& block = blocks[blockAt(i)];
+        uint32_t sequence = block.first;
+        int16_t value = block.base;
+        int pos = 0;
+        while (pos < block.used && sequence < stop && count < max) {
+            int run = nextRun(block, pos, value);
+            for (int n = 0; n < run; n++, sequence++) {
+                if (sequence >= start && sequence < stop && count < max) {
+                    out[count++] = toCenti(value);
+                }
+            }
+        }
+        if (sequence >= stop) {
+            break;
+        }
+    }
+    return count;
+}
+
+static void addToBucket(HistoryBucket& bucket, int64_t& sum, int16_t value, uint32_t samples) {
+    if (bucket.samples == 0) {
+        bucket.min = value;
+        bucket.max = value;
+    } else {
+        bucket.min = value < bucket.min ? value : bucket.min;
+        bucket.max = value > bucket.max ? value : bucket.max;
+    }
+    bucket.samples += samples;
+    sum += (int64_t)value * samples;
+}
+
+static void finishBucket(HistoryBucket& bucket, int64_t sum) {
+    if (bucket.samples > 0) {
+        bucket.mean = (TempCenti)(sum / bucket.samples);
+    }
+}
+
+/**
+ * @brief Split from .. to - 1 into equal buckets and summarise each
+ *
+ * A run of unchanged samples is added to a bucket in one step. Buckets
+ * without a retained reading have samples = 0 and TEMP_INVALID values.
+ *
+ * @return buckets, 0 if the range is empty
+ */
+int SensorHistory::downsample(uint32_t from, uint32_t to, int buckets, HistoryBucket* out) const {
+    if (buckets <= 0 || to <= from) {
+        return 0;
+    }
+    for (int b = 0; b < buckets; b++) {
+        out[b].min = TEMP_INVALID;
+        out[b].max = TEMP_INVALID;
+        out[b].mean = TEMP_INVALID;
+        out[b].samples = 0;
+    }
+
+    uint32_t start = from > getFirst() ? from : getFirst();
+    uint32_t stop = to < end ? to : end;
+    uint32_t span = to - from;
+    int bucket = 0;
+    uint32_t bucketEnd = from + (uint32_t)((uint64_t)span / buckets);
+    int64_t sum = 0;
+
+    for (int i = findBlock(start); i < blockCount; i++) {
+        const HistoryBlock& block = blocks[blockAt(i)];
+        uint32_t sequence = block.first;
+        int16_t value = block.base;
+        int pos = 0;
+        while (pos < block.used && sequence < stop) {
+            int run = nextRun(block, pos, value);
+            uint32_t segment = sequence > start ? sequence : start;
+            uint32_t runEnd = sequence + run < stop ? sequence + run : stop;
+            sequence += run;
+
+            // The run may span several buckets
+            while (segment < runEnd) {
+                while (segment >= bucketEnd) {
+                    finishBucket(out[bucket], sum);
+                    bucket++;
+                    sum = 0;
+                    bucketEnd = from + (uint32_t)((uint64_t)span * (bucket + 1) / buckets);
+                }
+                uint32_t segmentEnd = runEnd < bucketEnd ? runEnd : bucketEnd;
+                if (value != HISTORY_NONE) {
+                    addToBucket(out[bucket], sum, value, segmentEnd - segment);
+                }
+                segment = segmentEnd;
+            }
+        }
+        if (sequence >= stop) {
+            break;
+        }
+    }
+    finishBucket(out[bucket], sum);
+    return buckets;
+}
+
+HistoryStore::HistoryStore() {
+    sequence = 0;
+    lastRecord = 0;
+}
+
+/**
+ * @brief Append one sample per sensor slot, TEMP_INVALID for slots without a reading
+ */
+void HistoryStore::record(const TempCenti values[MAX_SENSORS], unsigned long now) {
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        sensors[i].append(values[i]);
+    }
+    sequence++;
+    lastRecord = now;
+}
+
+/**
+ * @brief Forget a slot's samples, e.g. after it was pointed at another entity
+ */
+void HistoryStore::clear(int sensor) {
+    sensors[sensor].clear(sequence);
+}
+
+/**
+ * @brief First sample recorded at or after a millis() time
+ */
+uint32_t HistoryStore::sequenceAt(unsigned long time) const {
+    if ((long)(time - lastRecord) > 0 || sequence == 0) {
+        return sequence;
+    }
+    unsigned long back = (lastRecord - time) / HISTORY_INTERVAL_MS;
+    return back >= sequence - 1 ? 0 : sequence - 1 - back;
+}
+
+/**
+ * @brief Encoded bytes in use over all slots, without block headers
+ */
+size_t HistoryStore::getBytesUsed() const {
+    size_t bytes = 0;
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        bytes += sensors[i].getBytesUsed();
+    }
+    return bytes;
+}
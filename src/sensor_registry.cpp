@@ -0,0 +1,127 @@
+#include "sensor_registry.h"
+
+static void clearReading(SensorReading& reading, uint8_t role) {
+    reading.role = role;
+    reading.valid = false;
+    reading.value = TEMP_INVALID;
+    reading.updatedAt = 0;
+    reading.readingCount = 0;
+}
+
+SensorRegistry::SensorRegistry() {
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        sensors[i].entityId[0] = '\0';
+        clearReading(sensors[i].reading, ROLE_NONE);
+    }
+}
+
+/**
+ * @brief Take over the sensor slots of a (new) configuration
+ *
+ * Slots whose entity did not change keep their last reading, so saving
+ * unrelated settings does not blank the display until the next poll.
+ */
+void SensorRegistry::configure(const Config& config) {
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        const SensorConfig& sensorConfig = config.sensors[i];
+        SensorDescriptor& sensor = sensors[i];
+        uint8_t role = sensorConfig.entity_id[0] != '\0' ? sensorConfig.role : ROLE_NONE;
+
+        if (strcmp(sensor.entityId, sensorConfig.entity_id) != 0) {
+            strncpy(sensor.entityId, sensorConfig.entity_id, ENTITY_ID_MAX - 1);
+            sensor.entityId[ENTITY_ID_MAX - 1] = '\0';
+            // Bump the count so the display picks up the cleared slot
+            uint32_t count = sensor.reading.readingCount;
+            clearReading(sensor.reading, role);
+            sensor.reading.readingCount = count + 1;
+        }
+        sensor.reading.role = role;
+    }
+}
+
+/**
+ * @brief Store a new reading for a slot
+ */
+void SensorRegistry::setValue(int slot, TempCenti value) {
+    if (slot < 0 || slot >= MAX_SENSORS || !isUsed(slot) || value == TEMP_INVALID) {
+        return;
+    }
+    SensorReading& reading = sensors[slot].reading;
+    reading.value = value;
+    reading.valid = true;
+    reading.updatedAt = millis();
+    reading.readingCount++;
+}
+
+/**
+ * @return First slot with this role and a valid reading, else the first
+ *         slot with this role, -1 if none is configured
+ */
+int SensorRegistry::primarySlot(const SensorReading readings[], uint8_t role) {
+    int firstSlot = -1;
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        if (readings[i].role != role) {
+            continue;
+        }
+        if (readings[i].valid) {
+            return i;
+        }
+        if (firstSlot < 0) {
+            firstSlot = i;
+        }
+    }
+    return firstSlot;
+}
+
+int SensorRegistry::findRole(uint8_t role) const {
+    SensorReading readings[MAX_SENSORS];
+    copyReadings(readings);
+    return primarySlot(readings, role);
+}
+
+/**
+ * @return Current value of a role, TEMP_INVALID if it has no valid reading
+ */
+TempCenti SensorRegistry::valueOf(uint8_t role) const {
+    int slot = findRole(role);
+    if (slot < 0 || !sensors[slot].reading.valid) {
+        return TEMP_INVALID;
+    }
+    return sensors[slot].reading.value;
+}
+
+void SensorRegistry::copyReadings(SensorReading out[]) const {
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        out[i] = sensors[i].reading;
+    }
+}
+
+/**
+ * @brief Short role identifier used in /status and the config form
+ */
+const char* SensorRegistry::roleName(uint8_t role) {
+    switch (role) {
+        case ROLE_TANK: return "tank";
+        case ROLE_OUT_PIPE: return "out_pipe";
+        case ROLE_HEATING_IN: return "heating_in";
+        case ROLE_ROOM: return "room";
+        case ROLE_RETURN_PIPE: return "return_pipe";
+        case ROLE_OTHER: return "other";
+        default: return "none";
+    }
+}
+
+/**
+ * @brief Human-readable role name for the web interface
+ */
+const char* SensorRegistry::roleLabel(uint8_t role) {
+    switch (role) {
+        case ROLE_TANK: return "Tank";
+        case ROLE_OUT_PIPE: return "Out Pipe";
+        case ROLE_HEATING_IN: return "Heating In";
+        case ROLE_ROOM: return "Room";
+        case ROLE_RETURN_PIPE: return "Return Pipe";
+        case ROLE_OTHER: return "Other";
+        default: return "Unused";
+    }
+}
@@ -0,0 +1,48 @@
+#include "sensor_snapshot.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+SnapshotBuffer::SnapshotBuffer() : sequence(0) {
+    memset(&data, 0, sizeof(data));
+}
+
+void SnapshotBuffer::publish(const SensorSnapshot& snapshot) {
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+
+    // Odd sequence marks the write in progress
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    memcpy(&data, &snapshot, sizeof(data));
+
+    std::atomic_thread_fence(std::memory_order_release);
+    sequence.store(seq + 2, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copy the latest snapshot
+ *
+ * @return Version of the copied snapshot (increments by one per publish)
+ */
+uint32_t SnapshotBuffer::read(SensorSnapshot& out) const {
+    for (;;) {
+        uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            // Writer was interrupted mid-copy; let it finish
+            taskYIELD();
+            continue;
+        }
+
+        memcpy(&out, &data, sizeof(out));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t after = sequence.load(std::memory_order_relaxed);
+        if (before == after) {
+            return before >> 1;
+        }
+    }
+}
+
+uint32_t SnapshotBuffer::getVersion() const {
+    return sequence.load(std::memory_order_acquire) >> 1;
+}
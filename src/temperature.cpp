@@ -0,0 +1,133 @@
+#include "temperature.h"
+#include <stdio.h>
+
+// Integer part limit keeps value * 100 far from int32 overflow
+static const int32_t TEMP_MAX_WHOLE = 999999;
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Parse a decimal string such as "54.25", "-3.5" or " 21 " into centi-degrees
+ *
+ * Digits beyond the second decimal are rounded (half away from zero).
+ * Exponents, "inf"/"nan" and states like "unavailable" are rejected.
+ *
+ * @param text Input, leading spaces are skipped
+ * @param out Parsed value, only written on success
+ * @param end If given, receives the first unparsed character and trailing
+ *            text is allowed; otherwise only trailing spaces may follow
+ * @return true if a number was parsed
+ */
+bool tempParse(const char* text, TempCenti* out, const char** end) {
+    const char* p = text;
+    while (*p == ' ' || *p == '\t') p++;
+
+    bool negative = false;
+    if (*p == '-' || *p == '+') {
+        negative = *p == '-';
+        p++;
+    }
+    if (!isDigit(*p) && !(*p == '.' && isDigit(p[1]))) {
+        return false;
+    }
+
+    int32_t whole = 0;
+    while (isDigit(*p)) {
+        whole = whole * 10 + (*p - '0');
+        if (whole > TEMP_MAX_WHOLE) {
+            return false;
+        }
+        p++;
+    }
+
+    int32_t frac = 0;
+    int fracDigits = 0;
+    bool roundUp = false;
+    if (*p == '.') {
+        p++;
+        while (isDigit(*p)) {
+            if (fracDigits < 2) {
+                frac = frac * 10 + (*p - '0');
+            } else if (fracDigits == 2) {
+                roundUp = *p >= '5';
+            }
+            fracDigits++;
+            p++;
+        }
+    }
+    if (fracDigits == 1) {
+        frac *= 10;
+    }
+
+    if (end != nullptr) {
+        *end = p;
+    } else {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        if (*p != '\0') {
+            return false;
+        }
+    }
+
+    TempCenti value = whole * 100 + frac + (roundUp ? 1 : 0);
+    *out = negative ? -value : value;
+    return true;
+}
+
+/**
+ * @brief Format centi-degrees with 0, 1 or 2 decimals, rounded half away from zero
+ *
+ * TEMP_INVALID renders as "--". No unit is appended.
+ *
+ * @return Characters written, excluding the terminator
+ */
+size_t tempFormat(TempCenti value, char* buf, size_t size, int decimals) {
+    int n;
+    if (value == TEMP_INVALID) {
+        n = snprintf(buf, size, "--");
+    } else {
+        bool negative = value < 0;
+        uint32_t magnitude = negative ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+        if (decimals <= 0) {
+            uint32_t units = (magnitude + 50) / 100;
+            n = snprintf(buf, size, "%s%lu", negative && units > 0 ? "-" : "", (unsigned long)units);
+        } else if (decimals == 1) {
+            uint32_t tenths = (magnitude + 5) / 10;
+            n = snprintf(buf, size, "%s%lu.%lu", negative && tenths > 0 ? "-" : "",
+                         (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+        } else {
+            n = snprintf(buf, size, "%s%lu.%02lu", negative && magnitude > 0 ? "-" : "",
+                         (unsigned long)(magnitude / 100), (unsigned long)(magnitude % 100));
+        }
+    }
+    if (n < 0) {
+        return 0;
+    }
+    return (size_t)n < size ? (size_t)n : size - 1;
+}
+
+/**
+ * @brief Convert centi-degrees Celsius to centi-degrees Fahrenheit (rounded)
+ */
+TempCenti tempToFahrenheit(TempCenti celsius) {
+    if (celsius == TEMP_INVALID) {
+        return TEMP_INVALID;
+    }
+    int32_t scaled = celsius * 9;
+    return (scaled + (scaled >= 0 ? 2 : -2)) / 5 + 3200;
+}
+
+/**
+ * @brief Convert a float in °C (NVS thresholds) to centi-degrees
+ */
+TempCenti tempFromFloat(float value) {
+    return (TempCenti)(value >= 0.0f ? value * 100.0f + 0.5f : value * 100.0f - 0.5f);
+}
+
+/**
+ * @brief Convert centi-degrees to float °C (NVS thresholds)
+ */
+float tempToFloat(TempCenti value) {
+    return value / 100.0f;
+}
@@ -0,0 +1,32 @@
+#include "trend_history.h"
+
+TrendHistory::TrendHistory() {
+    head = 0;
+    count = 0;
+    added = 0;
+}
+
+/**
+ * @brief Append one sample, TEMP_INVALID for series without a reading
+ *
+ * Values outside the int16_t range are stored as TREND_NONE too.
+ */
+void TrendHistory::add(const TempCenti values[TREND_SERIES]) {
+    TrendSample& sample = samples[head];
+    for (int i = 0; i < TREND_SERIES; i++) {
+        TempCenti value = values[i];
+        sample.values[i] = value > TREND_NONE && value <= INT16_MAX ? (int16_t)value : TREND_NONE;
+    }
+    head = (head + 1) % TREND_SAMPLES;
+    if (count < TREND_SAMPLES) {
+        count++;
+    }
+    added++;
+}
+
+/**
+ * @param age 0 for the newest sample, getCount() - 1 for the oldest
+ */
+const TrendSample& TrendHistory::get(int age) const {
+    return samples[(head - 1 - age + TREND_SAMPLES) % TREND_SAMPLES];
+}
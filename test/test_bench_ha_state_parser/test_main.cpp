@@ -0,0 +1,179 @@
+/**
+ * @brief Streaming HAStateParser against the old String path, on the host
+ *
+ *     pio test -e native_test -f test_bench_ha_state_parser -v
+ *
+ * The old fetchHAEntityState() read the body with http.getString(), which
+ * reserves Content-Length bytes and appends the stream to it, then searched
+ * it with indexOf("\"state\":\"") and substring(). That path is modelled with
+ * std::string; both paths take the body from memory in the same 64 byte
+ * chunks the firmware reads from the socket. Heap is counted by replacing
+ * operator new/delete, so only allocations of the parse itself show up.
+ *
+ * Times are host times; they show the ratio, not the ESP32-C6 figures
+ * (the firmware logs those per fetch).
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include "ha_state_parser.h"
+
+static size_t heapInUse = 0;
+static size_t heapPeak = 0;
+
+void* operator new(size_t size) {
+    size_t* block = (size_t*)malloc(size + sizeof(size_t));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *block = size;
+    heapInUse += size;
+    if (heapInUse > heapPeak) {
+        heapPeak = heapInUse;
+    }
+    return block + 1;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        size_t* block = (size_t*)pointer - 1;
+        heapInUse -= *block;
+        free(block);
+    }
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+const size_t CHUNK = 64;
+const int ITERATIONS = 2000;
+
+/**
+ * @brief An entity body like /api/states returns, padded with attributes to size bytes
+ *
+ * stateFirst puts "state" right after entity_id, as Home Assistant does;
+ * otherwise it comes last, the worst case for the streaming parser.
+ */
+static std::string entityBody(size_t size, bool stateFirst) {
+    std::string body = "{\"entity_id\":\"sensor.tank_temperature\",";
+    if (stateFirst) {
+        body += "\"state\":\"54.25\",";
+    }
+    body += "\"attributes\":{\"unit_of_measurement\":\"\xC2\xB0" "C\",\"device_class\":\"temperature\"";
+    std::string tail = "},\"context\":{\"id\":\"01HXYZ\",\"parent_id\":null,\"user_id\":null}";
+    tail += stateFirst ? "}" : ",\"state\":\"54.25\"}";
+    for (int i = 0; body.size() + tail.size() < size; i++) {
+        char attribute[48];
+        snprintf(attribute, sizeof(attribute), ",\"history_%04d\":\"%s\"", i, "sample value");
+        body += attribute;
+    }
+    return body + tail;
+}
+
+static bool parseStreaming(const std::string& body, char* state, size_t stateSize) {
+    HAStateParser parser;
+    char buf[CHUNK];
+    HAStateParser::Result result = HAStateParser::NEED_MORE;
+    for (size_t offset = 0; offset < body.size() && result == HAStateParser::NEED_MORE; offset += CHUNK) {
+        size_t n = body.size() - offset < CHUNK ? body.size() - offset : CHUNK;
+        memcpy(buf, body.data() + offset, n);
+        result = parser.feed(buf, n, nullptr);
+    }
+    if (result != HAStateParser::DONE) {
+        return false;
+    }
+    snprintf(state, stateSize, "%s", parser.getState());
+    return true;
+}
+
+static bool parseString(const std::string& body, char* state, size_t stateSize) {
+    std::string payload;
+    payload.reserve(body.size());
+    char buf[CHUNK];
+    for (size_t offset = 0; offset < body.size(); offset += CHUNK) {
+        size_t n = body.size() - offset < CHUNK ? body.size() - offset : CHUNK;
+        memcpy(buf, body.data() + offset, n);
+        payload.append(buf, n);
+    }
+    size_t start = payload.find("\"state\":\"");
+    if (start == std::string::npos) {
+        return false;
+    }
+    start += 9;
+    size_t end = payload.find('"', start);
+    if (end == std::string::npos) {
+        return false;
+    }
+    std::string value = payload.substr(start, end - start);
+    snprintf(state, stateSize, "%s", value.c_str());
+    return true;
+}
+
+struct BenchResult {
+    double us;              // Per parse
+    size_t peakHeap;        // Bytes
+};
+
+static BenchResult measure(bool (*parse)(const std::string&, char*, size_t), const std::string& body) {
+    char state[32];
+    heapPeak = heapInUse;
+    size_t base = heapInUse;
+    TEST_ASSERT_TRUE(parse(body, state, sizeof(state)));
+    TEST_ASSERT_EQUAL_STRING("54.25", state);
+    size_t peak = heapPeak - base;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        parse(body, state, sizeof(state));
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    return { us / ITERATIONS, peak };
+}
+
+static void benchmark(size_t size) {
+    char line[160];
+    for (int stateFirst = 1; stateFirst >= 0; stateFirst--) {
+        std::string body = entityBody(size, stateFirst);
+        BenchResult streaming = measure(parseStreaming, body);
+        BenchResult string = measure(parseString, body);
+        snprintf(line, sizeof(line), "%5zu B, state %s: parser %8.2f us %6zu B heap | String %8.2f us %6zu B heap",
+                 body.size(), stateFirst ? "first" : "last ", streaming.us, streaming.peakHeap,
+                 string.us, string.peakHeap);
+        TEST_MESSAGE(line);
+
+        // The parser never allocates; the String path holds the whole body
+        TEST_ASSERT_EQUAL(0, streaming.peakHeap);
+        TEST_ASSERT_GREATER_OR_EQUAL(body.size(), string.peakHeap);
+    }
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_1kb() {
+    benchmark(1024);
+}
+
+void test_8kb() {
+    benchmark(8 * 1024);
+}
+
+void test_32kb() {
+    benchmark(32 * 1024);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_1kb);
+    RUN_TEST(test_8kb);
+    RUN_TEST(test_32kb);
+    return UNITY_END();
+}
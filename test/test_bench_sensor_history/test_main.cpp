@@ -0,0 +1,135 @@
+/**
+ * @brief HistoryStore append and query times, on the host
+ *
+ *     pio test -e native_test -f test_bench_sensor_history -v
+ *
+ * Records a day of synthetic readings for every slot (slow drifts in 0.1°
+ * steps, a draw-off jump every 4 h, a sensor outage, two unused slots) and
+ * times appending, reading it back and downsampling it, then the same
+ * queries on a ring that has wrapped. Correctness of the paths is covered
+ * by test_sensor_history; this only checks the encoded size.
+ *
+ * Times are host times; they show the relative cost, not the ESP32-C6 figures.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "sensor_history.h"
+
+const uint32_t HISTORY_DAY = 24 * 3600000UL / HISTORY_INTERVAL_MS;
+const int BUCKETS = 60;
+
+static HistoryStore store;
+static TempCenti values[HISTORY_DAY];
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+static double microsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Reading of a slot at a sample: slow drifts in 0.1° steps, a jump now and then
+ */
+static TempCenti syntheticReading(int slot, uint32_t sample, uint32_t& seed) {
+    seed = seed * 1103515245 + 12345;
+    if (slot >= 6 || (slot == 5 && sample % 3000 < 200)) {
+        return TEMP_INVALID;                                  // Unused slots, a sensor outage
+    }
+    TempCenti drift = (TempCenti)((sample / (6 + slot)) % 200) * 10;
+    TempCenti jump = (sample % 1440) < 60 ? 1500 : 0;         // Draw-off every 4 h
+    return 2000 + slot * 500 + drift + jump + (TempCenti)((seed >> 16) % 3) * 10;
+}
+
+/**
+ * @brief Append samples first .. first + count - 1 to every slot
+ *
+ * @return Host µs per appended sample
+ */
+static double recordSamples(uint32_t first, uint32_t count) {
+    uint32_t seed = first + 1;
+    TempCenti sample[MAX_SENSORS];
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = first; i < first + count; i++) {
+        for (int slot = 0; slot < MAX_SENSORS; slot++) {
+            sample[slot] = syntheticReading(slot, i, seed);
+        }
+        store.record(sample, (i + 1) * HISTORY_INTERVAL_MS);
+    }
+    return microsSince(start) / (count * MAX_SENSORS);
+}
+
+/**
+ * @brief Time reading the last day and minute buckets of the last hour
+ */
+static void queryTimes(const char* label) {
+    uint32_t end = store.getSequence();
+    uint32_t dayStart = end > HISTORY_DAY ? end - HISTORY_DAY : 0;
+    auto start = std::chrono::steady_clock::now();
+    uint32_t samples = 0;
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        samples += store.get(slot).read(dayStart, end, values, HISTORY_DAY);
+    }
+    double readUs = microsSince(start);
+
+    HistoryBucket buckets[BUCKETS];
+    unsigned long now = end * HISTORY_INTERVAL_MS;
+    uint32_t hourStart = store.sequenceAt(now - 3600000UL);
+    start = std::chrono::steady_clock::now();
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        store.get(slot).downsample(hourStart, end, BUCKETS, buckets);
+    }
+    double hourUs = microsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        store.get(slot).downsample(dayStart, end, BUCKETS, buckets);
+    }
+    double dayUs = microsSince(start);
+
+    char line[160];
+    snprintf(line, sizeof(line), "%s: read %.1f ns per sample, %d buckets of the last hour %.1f us, of the last day %.1f us per slot",
+             label, samples > 0 ? readUs * 1000 / samples : 0.0, BUCKETS, hourUs / MAX_SENSORS, dayUs / MAX_SENSORS);
+    TEST_MESSAGE(line);
+}
+
+void test_one_day() {
+    double appendUs = recordSamples(0, HISTORY_DAY);
+    size_t bytes = store.getBytesUsed();
+    char line[160];
+    snprintf(line, sizeof(line), "%lu samples x %d slots: %lu bytes encoded (%.2f per sample), append %.0f ns",
+             (unsigned long)HISTORY_DAY, MAX_SENSORS, (unsigned long)bytes,
+             (double)bytes / (HISTORY_DAY * MAX_SENSORS), appendUs * 1000);
+    TEST_MESSAGE(line);
+    queryTimes("one day");
+
+    // A day fits in every slot without dropping anything
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        TEST_ASSERT_EQUAL(0, store.get(slot).getFirst());
+    }
+    TEST_ASSERT_LESS_THAN(HISTORY_DAY * MAX_SENSORS, bytes);
+}
+
+void test_wrapped_ring() {
+    // Three more days: the busiest slots drop their oldest blocks
+    double appendUs = recordSamples(store.getSequence(), 3 * HISTORY_DAY);
+    char line[160];
+    snprintf(line, sizeof(line), "four days: append %.0f ns, oldest sample kept by slot 4 is %.1f h old",
+             appendUs * 1000,
+             (double)(store.getSequence() - store.get(4).getFirst()) * HISTORY_INTERVAL_MS / 3600000.0);
+    TEST_MESSAGE(line);
+    queryTimes("wrapped");
+    TEST_ASSERT_TRUE(store.get(4).getFirst() > 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_day);
+    RUN_TEST(test_wrapped_ring);
+    return UNITY_END();
+}
@@ -0,0 +1,147 @@
+/**
+ * @brief ConfigManager load/save on the host: pio test -e native_test -f test_config
+ *
+ * NVS is the in-memory Preferences of emulator/include; each test starts
+ * from an empty namespace and writes keys the way older firmware did.
+ */
+
+#include <unity.h>
+#include <string>
+#include "config.h"
+
+static Preferences nvs;
+
+void setUp() {
+    nvs.begin("water-status", false);
+    nvs.clear();
+}
+
+void tearDown() {
+}
+
+/**
+ * @brief NVS as firmware with the four fixed entity keys left it
+ */
+static void writeLegacyConfig(const char* tank, const char* out, const char* heatIn, const char* room) {
+    nvs.putString("wifi_ssid", "home");
+    nvs.putString("ha_url", "http://ha.local:8123");
+    nvs.putString("ha_token", "token");
+    const char* keys[4] = { "ent_tank", "ent_out", "ent_heat_in", "ent_room" };
+    const char* entities[4] = { tank, out, heatIn, room };
+    for (int i = 0; i < 4; i++) {
+        if (entities[i] != nullptr) {
+            nvs.putString(keys[i], entities[i]);
+        }
+    }
+    nvs.putFloat("min_tank", 55.0f);
+    nvs.putFloat("min_out", 40.0f);
+    nvs.putInt("brightness", 150);
+    nvs.putInt("poll_int", 30);
+}
+
+static std::string entityOfLength(size_t length) {
+    std::string id = "sensor.";
+    id.append(length - id.size(), 'x');
+    return id;
+}
+
+static std::string storedString(const char* key) {
+    char buf[512];
+    return nvs.getString(key, buf, sizeof(buf)) > 0 ? std::string(buf) : std::string("<none>");
+}
+
+void test_migrates_fixed_entity_keys() {
+    writeLegacyConfig("sensor.tank", "sensor.out", "sensor.heat_in", "sensor.room");
+    ConfigManager manager;
+    manager.begin();
+    const Config& config = manager.getConfig();
+
+    const char* expected[4] = { "sensor.tank", "sensor.out", "sensor.heat_in", "sensor.room" };
+    const uint8_t roles[4] = { ROLE_TANK, ROLE_OUT_PIPE, ROLE_HEATING_IN, ROLE_ROOM };
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_STRING(expected[i], config.sensors[i].entity_id);
+        TEST_ASSERT_EQUAL(roles[i], config.sensors[i].role);
+    }
+    for (int i = 4; i < MAX_SENSORS; i++) {
+        TEST_ASSERT_EQUAL(ROLE_NONE, config.sensors[i].role);
+        TEST_ASSERT_EQUAL_STRING("", config.sensors[i].entity_id);
+    }
+
+    TEST_ASSERT_FALSE(nvs.isKey("ent_tank"));
+    TEST_ASSERT_FALSE(nvs.isKey("ent_room"));
+    TEST_ASSERT_EQUAL_STRING("sensor.out", storedString("s1_ent").c_str());
+    TEST_ASSERT_EQUAL(ROLE_HEATING_IN, nvs.getUChar("s2_role", ROLE_NONE));
+}
+
+void test_migration_keeps_settings_not_yet_loaded() {
+    writeLegacyConfig("sensor.tank", "sensor.out", "sensor.heat_in", "sensor.room");
+    ConfigManager manager;
+    manager.begin();
+
+    TEST_ASSERT_TRUE(nvs.getFloat("min_tank", 0) == 55.0f);
+    TEST_ASSERT_TRUE(nvs.getFloat("min_out", 0) == 40.0f);
+    TEST_ASSERT_EQUAL(150, nvs.getInt("brightness", 0));
+    TEST_ASSERT_EQUAL(5500, manager.getConfig().min_tank_temp);
+}
+
+void test_migrates_longest_old_entity_id() {
+    // The old entity fields held 127 characters
+    std::string longest = entityOfLength(ENTITY_ID_MAX - 1);
+    writeLegacyConfig(longest.c_str(), "sensor.out", nullptr, "sensor.room");
+    ConfigManager manager;
+    manager.begin();
+    const Config& config = manager.getConfig();
+
+    TEST_ASSERT_EQUAL_STRING(longest.c_str(), config.sensors[0].entity_id);
+    TEST_ASSERT_FALSE(nvs.isKey("ent_tank"));
+    TEST_ASSERT_EQUAL_STRING(longest.c_str(), storedString("s0_ent").c_str());
+
+    // A missing old key leaves its slot empty but keeps the role
+    TEST_ASSERT_EQUAL_STRING("", config.sensors[2].entity_id);
+    TEST_ASSERT_EQUAL(ROLE_HEATING_IN, config.sensors[2].role);
+}
+
+void test_oversize_entity_id_keeps_old_key() {
+    std::string tooLong = entityOfLength(ENTITY_ID_MAX);
+    writeLegacyConfig(tooLong.c_str(), "sensor.out", "sensor.heat_in", "sensor.room");
+    ConfigManager manager;
+    manager.begin();
+    const Config& config = manager.getConfig();
+
+    TEST_ASSERT_EQUAL_STRING("", config.sensors[0].entity_id);
+    TEST_ASSERT_EQUAL_STRING(tooLong.c_str(), storedString("ent_tank").c_str());
+
+    // The others still migrate
+    TEST_ASSERT_EQUAL_STRING("sensor.out", config.sensors[1].entity_id);
+    TEST_ASSERT_FALSE(nvs.isKey("ent_out"));
+}
+
+void test_slots_load_back_after_save() {
+    writeLegacyConfig("sensor.tank", "sensor.out", "sensor.heat_in", "sensor.room");
+    std::string longest = entityOfLength(ENTITY_ID_MAX - 1);
+    {
+        ConfigManager manager;
+        manager.begin();
+        manager.setSensor(5, ROLE_RETURN_PIPE, longest.c_str());
+        manager.setSensor(1, ROLE_OUT_PIPE, "");
+        manager.save();
+    }
+    ConfigManager manager;
+    manager.begin();
+    const Config& config = manager.getConfig();
+    TEST_ASSERT_EQUAL_STRING(longest.c_str(), config.sensors[5].entity_id);
+    TEST_ASSERT_EQUAL(ROLE_RETURN_PIPE, config.sensors[5].role);
+    TEST_ASSERT_EQUAL_STRING("", config.sensors[1].entity_id);
+    TEST_ASSERT_EQUAL(ROLE_NONE, config.sensors[1].role);
+    TEST_ASSERT_EQUAL_STRING("sensor.room", config.sensors[3].entity_id);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_migrates_fixed_entity_keys);
+    RUN_TEST(test_migration_keeps_settings_not_yet_loaded);
+    RUN_TEST(test_migrates_longest_old_entity_id);
+    RUN_TEST(test_oversize_entity_id_keeps_old_key);
+    RUN_TEST(test_slots_load_back_after_save);
+    return UNITY_END();
+}
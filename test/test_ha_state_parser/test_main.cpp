@@ -0,0 +1,173 @@
+/**
+ * @brief HAStateParser on the host: pio test -e native_test -f test_ha_state_parser
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "ha_state_parser.h"
+
+static HAStateParser parser;
+
+void setUp() {
+    parser.reset();
+}
+
+void tearDown() {
+}
+
+/**
+ * @brief Feed a body in chunks of at most chunk bytes until the parser decides
+ */
+static HAStateParser::Result parseChunked(const char* body, size_t chunk, size_t* consumedTotal = nullptr) {
+    size_t length = strlen(body);
+    size_t offset = 0;
+    HAStateParser::Result result = HAStateParser::NEED_MORE;
+    while (offset < length && result == HAStateParser::NEED_MORE) {
+        size_t n = length - offset < chunk ? length - offset : chunk;
+        size_t consumed = 0;
+        result = parser.feed(body + offset, n, &consumed);
+        offset += consumed;
+    }
+    if (consumedTotal != nullptr) {
+        *consumedTotal = offset;
+    }
+    return result;
+}
+
+static HAStateParser::Result parse(const char* body) {
+    return parseChunked(body, strlen(body));
+}
+
+void test_state_after_entity_id() {
+    TEST_ASSERT_EQUAL(HAStateParser::DONE,
+                      parse("{\"entity_id\":\"sensor.tank\",\"state\":\"54.25\",\"attributes\":{}}"));
+    TEST_ASSERT_EQUAL_STRING("54.25", parser.getState());
+}
+
+void test_whitespace_around_colon() {
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse("{\n  \"entity_id\" : \"sensor.tank\",\n  \"state\" :\t \"-3.5\"\n}"));
+    TEST_ASSERT_EQUAL_STRING("-3.5", parser.getState());
+}
+
+void test_stops_at_end_of_state() {
+    const char* body = "{\"state\":\"38.1\",\"attributes\":{\"unit_of_measurement\":\"C\"}}";
+    size_t consumed = 0;
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parseChunked(body, 64, &consumed));
+    TEST_ASSERT_EQUAL(strchr(body + 10, '"') - body + 1, consumed);
+}
+
+void test_nested_state_keys_are_ignored() {
+    const char* body =
+        "{\"entity_id\":\"sensor.tank\","
+        "\"attributes\":{\"state\":\"nested\",\"inner\":{\"state\":\"deeper\"},\"list\":[{\"state\":\"x\"}]},"
+        "\"context\":{\"id\":\"01H\",\"state\":\"ctx\"},"
+        "\"state\":\"21.63\"}";
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse(body));
+    TEST_ASSERT_EQUAL_STRING("21.63", parser.getState());
+}
+
+void test_state_key_inside_string_value_is_ignored() {
+    const char* body = "{\"friendly_name\":\"\\\"state\\\":\\\"7\\\"\",\"state\":\"8.5\"}";
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse(body));
+    TEST_ASSERT_EQUAL_STRING("8.5", parser.getState());
+}
+
+void test_similar_keys_are_not_state() {
+    TEST_ASSERT_EQUAL(HAStateParser::DONE,
+                      parse("{\"states\":\"1\",\"stat\":\"2\",\"last_state\":\"3\",\"state\":\"4\"}"));
+    TEST_ASSERT_EQUAL_STRING("4", parser.getState());
+}
+
+void test_escaped_quote_in_state() {
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse("{\"state\":\"a\\\"b\\\\c\"}"));
+    TEST_ASSERT_EQUAL_STRING("a\"b\\c", parser.getState());
+}
+
+void test_every_split_point() {
+    const char* body =
+        "{\"entity_id\":\"sensor.out_pipe\",\"attributes\":{\"state\":\"no\",\"q\":\"\\\"}\"},"
+        "\"state\":\"42.75\",\"last_changed\":\"2024-01-01T00:00:00\"}";
+    size_t length = strlen(body);
+    for (size_t split = 1; split < length; split++) {
+        parser.reset();
+        size_t consumed = 0;
+        HAStateParser::Result result = parser.feed(body, split, &consumed);
+        if (result == HAStateParser::NEED_MORE) {
+            TEST_ASSERT_EQUAL(split, consumed);
+            result = parser.feed(body + split, length - split, &consumed);
+        }
+        TEST_ASSERT_EQUAL(HAStateParser::DONE, result);
+        TEST_ASSERT_EQUAL_STRING("42.75", parser.getState());
+    }
+}
+
+void test_byte_by_byte() {
+    const char* body = "{\"entity_id\":\"sensor.room\",\"state\":\"19.9\"}";
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parseChunked(body, 1));
+    TEST_ASSERT_EQUAL_STRING("19.9", parser.getState());
+}
+
+void test_longest_state_fits() {
+    char body[128];
+    char state[HAStateParser::MAX_STATE_LEN + 1];
+    memset(state, '7', HAStateParser::MAX_STATE_LEN);
+    state[HAStateParser::MAX_STATE_LEN] = '\0';
+    snprintf(body, sizeof(body), "{\"state\":\"%s\"}", state);
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse(body));
+    TEST_ASSERT_EQUAL_STRING(state, parser.getState());
+}
+
+void test_oversize_state_fails() {
+    char body[128];
+    char state[HAStateParser::MAX_STATE_LEN + 2];
+    memset(state, '7', HAStateParser::MAX_STATE_LEN + 1);
+    state[HAStateParser::MAX_STATE_LEN + 1] = '\0';
+    snprintf(body, sizeof(body), "{\"state\":\"%s\"}", state);
+    TEST_ASSERT_EQUAL(HAStateParser::FAILED, parse(body));
+}
+
+void test_non_string_state_fails() {
+    TEST_ASSERT_EQUAL(HAStateParser::FAILED, parse("{\"state\":54.25}"));
+    parser.reset();
+    TEST_ASSERT_EQUAL(HAStateParser::FAILED, parse("{\"state\":null}"));
+    parser.reset();
+    TEST_ASSERT_EQUAL(HAStateParser::FAILED, parse("{\"state\":{\"value\":\"1\"}}"));
+}
+
+void test_missing_state_fails() {
+    TEST_ASSERT_EQUAL(HAStateParser::FAILED,
+                      parse("{\"entity_id\":\"sensor.tank\",\"attributes\":{\"state\":\"1\"}}"));
+}
+
+void test_truncated_body_needs_more() {
+    TEST_ASSERT_EQUAL(HAStateParser::NEED_MORE, parse("{\"entity_id\":\"sensor.tank\",\"state\":\"54"));
+}
+
+void test_result_sticks_until_reset() {
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse("{\"state\":\"1\"}"));
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parser.feed('}'));
+    parser.reset();
+    TEST_ASSERT_EQUAL(HAStateParser::NEED_MORE, parser.getResult());
+    TEST_ASSERT_EQUAL(HAStateParser::DONE, parse("{\"state\":\"2\"}"));
+    TEST_ASSERT_EQUAL_STRING("2", parser.getState());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_state_after_entity_id);
+    RUN_TEST(test_whitespace_around_colon);
+    RUN_TEST(test_stops_at_end_of_state);
+    RUN_TEST(test_nested_state_keys_are_ignored);
+    RUN_TEST(test_state_key_inside_string_value_is_ignored);
+    RUN_TEST(test_similar_keys_are_not_state);
+    RUN_TEST(test_escaped_quote_in_state);
+    RUN_TEST(test_every_split_point);
+    RUN_TEST(test_byte_by_byte);
+    RUN_TEST(test_longest_state_fits);
+    RUN_TEST(test_oversize_state_fails);
+    RUN_TEST(test_non_string_state_fails);
+    RUN_TEST(test_missing_state_fails);
+    RUN_TEST(test_truncated_body_needs_more);
+    RUN_TEST(test_result_sticks_until_reset);
+    return UNITY_END();
+}
@@ -0,0 +1,310 @@
+/**
+ * @brief SensorHistory and HistoryStore on the host: pio test -e native_test -f test_sensor_history
+ *
+ * Every test appends to a history and to a plain array of the same values
+ * and checks reads and downsampling against the array.
+ */
+
+#include <unity.h>
+#include <stdlib.h>
+#include "sensor_history.h"
+
+// Enough for several trips round a full ring of one-byte samples
+const int REFERENCE_SIZE = 40000;
+
+static SensorHistory history;
+static TempCenti reference[REFERENCE_SIZE];
+static TempCenti values[REFERENCE_SIZE];
+static int appended = 0;
+
+void setUp() {
+    history.clear(0);
+    appended = 0;
+}
+
+void tearDown() {
+}
+
+static void append(TempCenti value) {
+    history.append(value);
+    // What the history can store: int16_t or no reading
+    reference[appended++] = value >= -32767 && value <= 32767 ? value : TEMP_INVALID;
+}
+
+/**
+ * @brief Samples that change by a small step every time: one byte each
+ */
+static void appendChanging(int count) {
+    for (int i = 0; i < count; i++) {
+        append(4000 + (appended % 2 == 0 ? 10 : -10) + (appended / 100) % 50);
+    }
+}
+
+static void assertReads(uint32_t from, uint32_t to) {
+    uint32_t first = from > history.getFirst() ? from : history.getFirst();
+    uint32_t last = to < history.getEnd() ? to : history.getEnd();
+    int expected = last > first ? (int)(last - first) : 0;
+    int count = history.read(from, to, values, REFERENCE_SIZE);
+    TEST_ASSERT_EQUAL(expected, count);
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(reference[first + i], values[i]);
+    }
+}
+
+static void assertDownsample(uint32_t from, uint32_t to, int buckets) {
+    HistoryBucket out[64];
+    TEST_ASSERT_EQUAL(buckets, history.downsample(from, to, buckets, out));
+    uint32_t span = to - from;
+    for (int b = 0; b < buckets; b++) {
+        uint32_t start = from + (uint32_t)((uint64_t)span * b / buckets);
+        uint32_t end = from + (uint32_t)((uint64_t)span * (b + 1) / buckets);
+        int64_t sum = 0;
+        uint32_t samples = 0;
+        TempCenti min = 0;
+        TempCenti max = 0;
+        for (uint32_t s = start; s < end; s++) {
+            if (s < history.getFirst() || s >= history.getEnd() || reference[s] == TEMP_INVALID) {
+                continue;
+            }
+            min = samples == 0 || reference[s] < min ? reference[s] : min;
+            max = samples == 0 || reference[s] > max ? reference[s] : max;
+            sum += reference[s];
+            samples++;
+        }
+        TEST_ASSERT_EQUAL(samples, out[b].samples);
+        if (samples == 0) {
+            TEST_ASSERT_EQUAL(TEMP_INVALID, out[b].mean);
+            TEST_ASSERT_EQUAL(TEMP_INVALID, out[b].min);
+        } else {
+            TEST_ASSERT_EQUAL(min, out[b].min);
+            TEST_ASSERT_EQUAL(max, out[b].max);
+            TEST_ASSERT_EQUAL((TempCenti)(sum / samples), out[b].mean);
+        }
+    }
+}
+
+void test_empty_history() {
+    TEST_ASSERT_EQUAL(0, history.getFirst());
+    TEST_ASSERT_EQUAL(0, history.getEnd());
+    TEST_ASSERT_EQUAL(0, history.read(0, 100, values, REFERENCE_SIZE));
+    assertDownsample(0, 10, 5);
+    HistoryBucket bucket;
+    TEST_ASSERT_EQUAL(0, history.downsample(5, 5, 1, &bucket));
+}
+
+void test_round_trip_of_every_code() {
+    const TempCenti input[] = {
+        TEMP_INVALID, TEMP_INVALID, 4525, 4525, 4530, 4430, 4530, 4531, 6000, 6000, 6000,
+        -1500, -1400, TEMP_INVALID, 2000, 32767, -32767, 40000, 40000, -40000, 0, 0
+    };
+    for (size_t i = 0; i < sizeof(input) / sizeof(input[0]); i++) {
+        append(input[i]);
+    }
+    TEST_ASSERT_EQUAL(appended, history.getEnd());
+    assertReads(0, appended);
+    assertReads(3, 9);
+    assertDownsample(0, appended, 7);
+}
+
+void test_repeats_saturate_at_50() {
+    append(4000);
+    for (int i = 0; i < 120; i++) {
+        append(4000);
+    }
+    // Absolute value, then repeat codes of 50, 50 and 20
+    TEST_ASSERT_EQUAL(3 + 3, history.getBytesUsed());
+    assertReads(0, appended);
+    assertReads(50, 52);
+    assertDownsample(0, appended, 13);
+
+    // The run closes on a change and a new one starts after it
+    append(4010);
+    append(4010);
+    TEST_ASSERT_EQUAL(3 + 3 + 2, history.getBytesUsed());
+    assertReads(0, appended);
+}
+
+void test_absolute_code_does_not_straddle_blocks() {
+    // 3 byte absolute value and 123 one byte deltas: 126 of 128 bytes
+    append(1000);
+    for (int i = 0; i < 123; i++) {
+        append(reference[appended - 1] + (i % 2 == 0 ? 5 : -3));
+    }
+    TEST_ASSERT_EQUAL(HISTORY_BLOCK_BYTES - 2, history.getBytesUsed());
+
+    // A jump needs 3 bytes: it opens the next block instead of splitting
+    append(9000);
+    TEST_ASSERT_EQUAL(HISTORY_BLOCK_BYTES - 2 + 3, history.getBytesUsed());
+    append(9001);
+    assertReads(0, appended);
+    assertReads(120, appended);
+    assertDownsample(100, appended, 9);
+}
+
+void test_repeat_opens_next_block() {
+    append(1000);
+    for (int i = 0; i < 125; i++) {
+        append(reference[appended - 1] + 1);
+    }
+    TEST_ASSERT_EQUAL(HISTORY_BLOCK_BYTES, history.getBytesUsed());
+
+    // The first code of the new block repeats the last value of the old one
+    for (int i = 0; i < 70; i++) {
+        append(reference[appended - 1]);
+    }
+    TEST_ASSERT_EQUAL(HISTORY_BLOCK_BYTES + 2, history.getBytesUsed());
+    assertReads(0, appended);
+    assertReads(126, 127);
+    assertDownsample(120, appended, 6);
+}
+
+void test_full_ring_drops_oldest_blocks() {
+    // The first sample is a 3 byte absolute value: this fills every block
+    appendChanging(HISTORY_BLOCKS * HISTORY_BLOCK_BYTES - 2);
+    TEST_ASSERT_EQUAL(0, history.getFirst());
+    TEST_ASSERT_EQUAL(HISTORY_BLOCKS * HISTORY_BLOCK_BYTES, history.getBytesUsed());
+
+    appendChanging(1);
+    TEST_ASSERT_TRUE(history.getFirst() > 0);
+    TEST_ASSERT_EQUAL(appended, history.getEnd());
+    TEST_ASSERT_TRUE(history.getBytesUsed() <= (size_t)(HISTORY_BLOCKS * HISTORY_BLOCK_BYTES));
+
+    // Several trips round the ring
+    appendChanging(3 * HISTORY_BLOCKS * HISTORY_BLOCK_BYTES + 77);
+    uint32_t retained = history.getEnd() - history.getFirst();
+    TEST_ASSERT_TRUE(retained > (uint32_t)((HISTORY_BLOCKS - 1) * HISTORY_BLOCK_BYTES - 3));
+    TEST_ASSERT_TRUE(retained <= (uint32_t)(HISTORY_BLOCKS * HISTORY_BLOCK_BYTES));
+    assertReads(history.getFirst(), history.getEnd());
+}
+
+void test_queries_on_wrapped_ring() {
+    appendChanging(2 * HISTORY_BLOCKS * HISTORY_BLOCK_BYTES + 500);
+    uint32_t first = history.getFirst();
+    uint32_t end = history.getEnd();
+
+    // A start in every block (and on block edges) goes through findBlock()
+    for (uint32_t from = first; from < end; from += HISTORY_BLOCK_BYTES / 2 - 1) {
+        assertReads(from, from + 40);
+    }
+    assertReads(end - 1, end);
+    assertReads(end, end + 10);
+    assertDownsample(first, end, 64);
+    assertDownsample(end - 300, end, 7);
+}
+
+void test_queries_before_first_retained_sample() {
+    appendChanging(HISTORY_BLOCKS * HISTORY_BLOCK_BYTES + 1000);
+    uint32_t first = history.getFirst();
+    TEST_ASSERT_TRUE(first > 0);
+
+    // Reads start at the oldest retained sample
+    int count = history.read(0, first + 10, values, REFERENCE_SIZE);
+    TEST_ASSERT_EQUAL(10, count);
+    TEST_ASSERT_EQUAL(reference[first], values[0]);
+    TEST_ASSERT_EQUAL(0, history.read(0, first, values, REFERENCE_SIZE));
+
+    // Buckets over dropped samples are empty, the rest are exact
+    assertDownsample(0, history.getEnd(), 10);
+    assertDownsample(first - 5, first + 5, 10);
+}
+
+void test_read_stops_at_max() {
+    appendChanging(500);
+    TEST_ASSERT_EQUAL(7, history.read(100, 400, values, 7));
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL(reference[100 + i], values[i]);
+    }
+}
+
+void test_downsample_runs_across_buckets() {
+    append(2000);
+    for (int i = 0; i < 199; i++) {
+        append(2000);
+    }
+    append(TEMP_INVALID);
+    for (int i = 0; i < 99; i++) {
+        append(TEMP_INVALID);
+    }
+    append(2500);
+    assertDownsample(0, appended, 30);
+    assertDownsample(10, 250, 64);
+
+    // More buckets than samples: some are empty
+    assertDownsample(195, 205, 23);
+}
+
+void test_clear_mid_stream() {
+    appendChanging(300);
+    history.clear(300);
+    TEST_ASSERT_EQUAL(300, history.getFirst());
+    TEST_ASSERT_EQUAL(300, history.getEnd());
+    TEST_ASSERT_EQUAL(0, history.getBytesUsed());
+    TEST_ASSERT_EQUAL(0, history.read(0, 300, values, REFERENCE_SIZE));
+
+    // New samples continue the sequence, without a delta from the old value
+    appendChanging(50);
+    TEST_ASSERT_EQUAL(300, history.getFirst());
+    assertReads(0, appended);
+    assertDownsample(250, appended, 10);
+}
+
+void test_store_keeps_slots_aligned() {
+    static HistoryStore store;
+    TempCenti sample[MAX_SENSORS];
+    for (int i = 0; i < 100; i++) {
+        for (int slot = 0; slot < MAX_SENSORS; slot++) {
+            sample[slot] = 1000 * slot + i;
+        }
+        store.record(sample, (i + 1) * HISTORY_INTERVAL_MS);
+    }
+    store.clear(2);
+    TEST_ASSERT_EQUAL(100, store.get(2).getFirst());
+    TEST_ASSERT_EQUAL(100, store.get(2).getEnd());
+
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        sample[slot] = 5000 + slot;
+    }
+    store.record(sample, 101 * HISTORY_INTERVAL_MS);
+    TEST_ASSERT_EQUAL(101, store.getSequence());
+    for (int slot = 0; slot < MAX_SENSORS; slot++) {
+        TEST_ASSERT_EQUAL(101, store.get(slot).getEnd());
+        TEST_ASSERT_EQUAL(1, store.get(slot).read(100, 101, values, 1));
+        TEST_ASSERT_EQUAL(5000 + slot, values[0]);
+    }
+    TEST_ASSERT_EQUAL(0, store.get(1).getFirst());
+    TEST_ASSERT_EQUAL(1, store.get(1).read(50, 51, values, 1));
+    TEST_ASSERT_EQUAL(1050, values[0]);
+}
+
+void test_store_maps_times_to_samples() {
+    static HistoryStore store;
+    TempCenti sample[MAX_SENSORS] = { 0 };
+    TEST_ASSERT_EQUAL(0, store.sequenceAt(12345));
+    for (int i = 0; i < 10; i++) {
+        store.record(sample, 50000 + i * HISTORY_INTERVAL_MS);
+    }
+    unsigned long newest = 50000 + 9 * HISTORY_INTERVAL_MS;
+    TEST_ASSERT_EQUAL(9, store.sequenceAt(newest));
+    TEST_ASSERT_EQUAL(9, store.sequenceAt(newest - HISTORY_INTERVAL_MS + 1));
+    TEST_ASSERT_EQUAL(8, store.sequenceAt(newest - HISTORY_INTERVAL_MS));
+    TEST_ASSERT_EQUAL(10, store.sequenceAt(newest + 1));
+    TEST_ASSERT_EQUAL(0, store.sequenceAt(0));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_history);
+    RUN_TEST(test_round_trip_of_every_code);
+    RUN_TEST(test_repeats_saturate_at_50);
+    RUN_TEST(test_absolute_code_does_not_straddle_blocks);
+    RUN_TEST(test_repeat_opens_next_block);
+    RUN_TEST(test_full_ring_drops_oldest_blocks);
+    RUN_TEST(test_queries_on_wrapped_ring);
+    RUN_TEST(test_queries_before_first_retained_sample);
+    RUN_TEST(test_read_stops_at_max);
+    RUN_TEST(test_downsample_runs_across_buckets);
+    RUN_TEST(test_clear_mid_stream);
+    RUN_TEST(test_store_keeps_slots_aligned);
+    RUN_TEST(test_store_maps_times_to_samples);
+    return UNITY_END();
+}
@@ -0,0 +1,171 @@
+"""
+Build step: turn data/*.png into compressed flash resources.
+
+Runs before every PlatformIO build (extra_scripts = pre:tools/build_assets.py)
+and can also be run by hand: python3 tools/build_assets.py
+
+Generates
+- include/asset_ids.h     AssetId enum, one ASSET_<NAME> per image
+- src/asset_data.cpp      all encoded images in one PROGMEM blob plus the
+                          manifest (name, dimensions, format, offset, size,
+                          checksum) read by include/assets.h
+
+Encoded images are cached in .pio/assets, keyed by the SHA-256 of the PNG
+and the encoder version, so unchanged images are not re-encoded. Generated
+files are only rewritten when their content changes, so an unchanged data/
+directory does not trigger a recompile.
+"""
+
+import hashlib
+import json
+import os
+import re
+import sys
+
+ENCODER_VERSION = 1
+FORMAT_RGB565_RLE = "ASSET_FORMAT_RGB565_RLE"
+HEADER_NOTE = "// Generated by tools/build_assets.py from data/*.png - do not edit"
+
+try:
+    Import("env")  # noqa: F821 (provided by SCons inside PlatformIO)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+sys.path.insert(0, os.path.join(PROJECT_DIR, "tools"))
+import rle_image  # noqa: E402
+
+DATA_DIR = os.path.join(PROJECT_DIR, "data")
+CACHE_DIR = os.path.join(PROJECT_DIR, ".pio", "assets")
+CACHE_INDEX = os.path.join(CACHE_DIR, "index.json")
+IDS_HEADER = os.path.join(PROJECT_DIR, "include", "asset_ids.h")
+DATA_SOURCE = os.path.join(PROJECT_DIR, "src", "asset_data.cpp")
+
+
+def asset_id(name):
+    return "ASSET_" + re.sub(r"[^A-Za-z0-9]+", "_", name).upper()
+
+
+def load_cache():
+    try:
+        with open(CACHE_INDEX) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def encode_asset(path, cache):
+    """Return the manifest entry and encoded bytes of one PNG, cached."""
+    name = os.path.splitext(os.path.basename(path))[0]
+    with open(path, "rb") as f:
+        digest = hashlib.sha256(f.read() + b"rle%d" % ENCODER_VERSION).hexdigest()
+
+    blob_path = os.path.join(CACHE_DIR, digest + ".rle")
+    entry = cache.get(name)
+    if entry and entry.get("digest") == digest and os.path.exists(blob_path):
+        with open(blob_path, "rb") as f:
+            return entry, f.read()
+
+    width, height, data, checksum = rle_image.convert(path)
+    print("Assets: encoded %s (%dx%d, %d -> %d bytes)" % (name, width, height, width * height * 2, len(data)))
+    with open(blob_path, "wb") as f:
+        f.write(data)
+    entry = {"digest": digest, "name": name, "width": width, "height": height, "checksum": checksum}
+    cache[name] = entry
+    return entry, data
+
+
+def write_if_changed(path, content):
+    try:
+        with open(path) as f:
+            if f.read() == content:
+                return
+    except OSError:
+        pass
+    with open(path, "w") as f:
+        f.write(content)
+    print("Assets: wrote %s" % os.path.relpath(path, PROJECT_DIR))
+
+
+def render_ids(entries):
+    lines = [
+        HEADER_NOTE,
+        "",
+        "#ifndef ASSET_IDS_H",
+        "#define ASSET_IDS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum AssetId : uint8_t {",
+    ]
+    for index, entry in enumerate(entries):
+        lines.append("    %s = %d," % (asset_id(entry["name"]), index))
+    lines += [
+        "    ASSET_COUNT = %d" % len(entries),
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def render_data(entries, blobs):
+    lines = [
+        HEADER_NOTE,
+        "",
+        '#include "assets.h"',
+        "",
+        "const uint8_t assetData[] PROGMEM = {",
+    ]
+    offset = 0
+    for entry, data in zip(entries, blobs):
+        entry["offset"] = offset
+        entry["size"] = len(data)
+        lines.append("    // %s: %dx%d RGB565 RLE, %d bytes" % (entry["name"], entry["width"], entry["height"], len(data)))
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        offset += len(data)
+    if not blobs:
+        lines.append("    0")
+    lines += [
+        "};",
+        "",
+        "const AssetInfo assetManifest[] = {",
+    ]
+    for entry in entries:
+        lines.append('    { "%s", %d, %d, %s, %d, %d, 0x%08X },' % (
+            entry["name"], entry["width"], entry["height"], FORMAT_RGB565_RLE,
+            entry["offset"], entry["size"], entry["checksum"]))
+    if not entries:
+        lines.append('    { "", 0, 0, 0, 0, 0, 0 }')
+    lines += [
+        "};",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def build_assets():
+    os.makedirs(CACHE_DIR, exist_ok=True)
+    cache = load_cache()
+
+    paths = sorted(os.path.join(DATA_DIR, f) for f in os.listdir(DATA_DIR) if f.lower().endswith(".png"))
+    entries = []
+    blobs = []
+    for path in paths:
+        entry, data = encode_asset(path, cache)
+        entries.append(dict(entry))
+        blobs.append(data)
+
+    # Drop images that left data/ from the index
+    names = set(entry["name"] for entry in entries)
+    cache = dict((name, entry) for name, entry in cache.items() if name in names)
+    with open(CACHE_INDEX, "w") as f:
+        json.dump(cache, f, indent=1, sort_keys=True)
+
+    write_if_changed(IDS_HEADER, render_ids(entries))
+    write_if_changed(DATA_SOURCE, render_data(entries, blobs))
+
+
+build_assets()
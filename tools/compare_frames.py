@@ -0,0 +1,131 @@
+"""
+Compare the display emulator's frames with the reference frames in the repo.
+
+    pio run -e native && .pio/build/native/program out/
+    python3 tools/compare_frames.py out/                      # exit 1 on any difference
+    python3 tools/compare_frames.py out/ --diff diff/         # also write diff images
+    python3 tools/compare_frames.py out/ --update             # accept out/ as the new references
+
+Every PNG in emulator/reference/ must have a captured frame of the same name
+and size with identical pixels; a captured frame without a reference (a new
+scenario step) also fails until it is accepted with --update. Diff images
+show the reference dimmed, with differing pixels in magenta.
+
+References are written with zlib compression (the emulator's own PNGs are
+uncompressed), so they stay small in the repo. Only the Python standard
+library is used.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+import rle_image
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+REFERENCE_DIR = os.path.join(PROJECT_DIR, "emulator", "reference")
+
+
+def write_png(path, width, height, rows):
+    """Write rows of (r, g, b) tuples as a compressed 8-bit RGB PNG."""
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)
+        for pixel in row:
+            raw.extend(pixel)
+
+    def chunk(chunk_type, data):
+        body = chunk_type + data
+        return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body))
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def png_names(directory):
+    return sorted(name for name in os.listdir(directory) if name.endswith(".png"))
+
+
+def compare(captured_dir, reference_dir, diff_dir):
+    """Print one line per frame; return the number of frames that differ."""
+    failures = 0
+    for name in png_names(reference_dir):
+        path = os.path.join(captured_dir, name)
+        if not os.path.exists(path):
+            print("%-24s missing" % name)
+            failures += 1
+            continue
+        width, height, expected = rle_image.read_png(os.path.join(reference_dir, name))
+        captured_width, captured_height, actual = rle_image.read_png(path)
+        if (captured_width, captured_height) != (width, height):
+            print("%-24s size %dx%d, reference %dx%d" % (name, captured_width, captured_height, width, height))
+            failures += 1
+            continue
+
+        differing = 0
+        box = [width, height, -1, -1]
+        for y in range(height):
+            if actual[y] == expected[y]:
+                continue
+            for x in range(width):
+                if actual[y][x] != expected[y][x]:
+                    differing += 1
+                    box = [min(box[0], x), min(box[1], y), max(box[2], x), max(box[3], y)]
+        if differing == 0:
+            print("%-24s ok" % name)
+            continue
+
+        failures += 1
+        print("%-24s %d pixels differ in (%d,%d)-(%d,%d)" % (name, differing, *box))
+        if diff_dir is not None:
+            os.makedirs(diff_dir, exist_ok=True)
+            rows = [[(255, 0, 255) if actual[y][x] != expected[y][x] else
+                     tuple(c // 3 for c in expected[y][x]) for x in range(width)] for y in range(height)]
+            write_png(os.path.join(diff_dir, name), width, height, rows)
+
+    for name in png_names(captured_dir):
+        if not os.path.exists(os.path.join(reference_dir, name)):
+            print("%-24s no reference (accept with --update)" % name)
+            failures += 1
+    return failures
+
+
+def update(captured_dir, reference_dir):
+    os.makedirs(reference_dir, exist_ok=True)
+    captured = png_names(captured_dir)
+    for name in png_names(reference_dir):
+        if name not in captured:
+            os.remove(os.path.join(reference_dir, name))
+            print("%-24s removed" % name)
+    for name in captured:
+        width, height, rows = rle_image.read_png(os.path.join(captured_dir, name))
+        write_png(os.path.join(reference_dir, name), width, height, rows)
+        print("%-24s updated" % name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare emulator frames with the reference frames")
+    parser.add_argument("captured", help="output directory of the emulator run")
+    parser.add_argument("--reference", default=REFERENCE_DIR, help="reference frames (default: emulator/reference)")
+    parser.add_argument("--diff", help="write a diff image per differing frame to this directory")
+    parser.add_argument("--update", action="store_true", help="replace the references with the captured frames")
+    options = parser.parse_args()
+
+    if options.update:
+        update(options.captured, options.reference)
+        return 0
+    failures = compare(options.captured, options.reference, options.diff)
+    if failures:
+        print("%d frame(s) differ from the references" % failures)
+        return 1
+    print("all frames match the references")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,355 @@
+"""
+Local stand-in for the parts of the Home Assistant REST API the firmware uses.
+
+    python3 tools/mock_ha.py --latency 40 --device 192.168.1.50
+
+Point the device's Home Assistant URL at http://<this host>:8123 (any token
+works) and set Update mode to Polling. The server answers:
+
+- GET /api/                  API check of the config page
+- GET /api/states            entity list of the config page
+- GET /api/states/<id>       one entity (per-entity poll mode)
+- POST /api/template         states('<id>') lists (batch poll mode) and the
+                             temperature sensor list of the config page
+
+Any entity id gets a reading that drifts slowly with time. Every response
+waits --latency ms first, which stands in for Home Assistant's own work and
+the network, so a poll costs one such delay per round trip. Entity bodies
+are padded with attributes to --body-bytes, like real entities with history
+attributes.
+
+The server groups the requests of one device that arrive less than
+--poll-gap seconds apart into a poll and prints its request count, bytes and
+wall time as the server sees them. With --device it also reads the device's
+/status once a second and prints each new poll with the device's own pollMs,
+which includes connection setup. On Ctrl-C, or once both poll modes have
+--polls polls, it prints the device latency per poll mode, so switching Fetch
+mode in the web UI during one run gives the batched vs per-entity comparison.
+
+With --tls the server speaks HTTPS with a self-signed certificate (made
+with the openssl command line tool on first use, kept in --cert-dir) and
+prints its SHA-256 fingerprint to paste as the device's certificate pin.
+Every TLS handshake is logged with its server-side time and whether the
+client resumed a session. --close ends every connection after one response,
+so every request needs a new handshake, and --full-every N makes every Nth
+connection a full handshake by starting a new TLS context, which forgets all
+sessions and tickets. With --device it also prints the device's own
+handshake counts, average times and heap use from /status. On Ctrl-C it
+prints both summaries.
+
+Only the Python standard library (and for --tls the openssl tool) is used.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import math
+import re
+import ssl
+import statistics
+import subprocess
+import sys
+import threading
+import time
+import urllib.request
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+DEFAULT_ENTITIES = [
+    "sensor.tank_temperature",
+    "sensor.out_pipe_temperature",
+    "sensor.heating_inlet_temperature",
+    "sensor.room_temperature",
+]
+
+POLL_MODES = ("batch", "per-entity")    # pollMode values of /status
+STATES_CALL = re.compile(r"states\('([^']+)'\)")
+
+
+def reading(entity_id, now):
+    """Value of an entity: a per-entity level plus a slow drift, 0.01° steps."""
+    level = 20 + zlib.crc32(entity_id.encode()) % 40
+    return "%.2f" % (level + 3 * math.sin(now / 600.0 + level))
+
+
+def entity_json(entity_id, now, body_bytes):
+    entity = {
+        "entity_id": entity_id,
+        "state": reading(entity_id, now),
+        "attributes": {
+            "unit_of_measurement": "°C",
+            "device_class": "temperature",
+            "friendly_name": entity_id.split(".", 1)[-1].replace("_", " ").title(),
+        },
+        "last_changed": "2024-01-01T00:00:00+00:00",
+        "context": {"id": "01HMOCK", "parent_id": None, "user_id": None},
+    }
+    body = json.dumps(entity)
+    i = 0
+    while len(body) < body_bytes:
+        entity["attributes"]["history_%04d" % i] = "sample value"
+        body = json.dumps(entity)
+        i += 1
+    return body
+
+
+class PollLog:
+    """Groups each client's requests into polls and prints them when they end."""
+
+    def __init__(self, gap):
+        self.gap = gap
+        self.lock = threading.Lock()
+        self.open = {}
+
+    def add(self, client, started, finished, sent):
+        with self.lock:
+            poll = self.open.get(client)
+            if poll is None:
+                poll = self.open[client] = {"start": started, "requests": 0, "bytes": 0}
+            poll["requests"] += 1
+            poll["bytes"] += sent
+            poll["end"] = finished
+
+    def flush(self, now):
+        with self.lock:
+            for client, poll in list(self.open.items()):
+                if now - poll["end"] >= self.gap:
+                    del self.open[client]
+                    print("server: poll from %s: %d requests, %d bytes, %.0f ms"
+                          % (client, poll["requests"], poll["bytes"],
+                             (poll["end"] - poll["start"]) * 1000), flush=True)
+
+
+class TlsServer:
+    """Runs the server side of every connection's TLS handshake and times it."""
+
+    def __init__(self, cert, key, full_every):
+        self.cert = cert
+        self.key = key
+        self.full_every = full_every
+        self.lock = threading.Lock()
+        self.connections = 0
+        self.context = self.new_context()
+        self.times = {"full": [], "resumed": []}
+
+    def new_context(self):
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(self.cert, self.key)
+        return context
+
+    def wrap(self, sock, client):
+        with self.lock:
+            self.connections += 1
+            if self.full_every and self.connections > 1 and (self.connections - 1) % self.full_every == 0:
+                self.context = self.new_context()
+            context = self.context
+        sock.settimeout(10)
+        tls = context.wrap_socket(sock, server_side=True, do_handshake_on_connect=False)
+        started = time.monotonic()
+        tls.do_handshake()
+        ms = (time.monotonic() - started) * 1000
+        kind = "resumed" if tls.session_reused else "full"
+        with self.lock:
+            self.times[kind].append(ms)
+        print("server: %s TLS handshake from %s in %.0f ms (%s, %s)"
+              % (kind, client, ms, tls.version(), tls.cipher()[0]), flush=True)
+        return tls
+
+
+def make_certificate(cert_dir, host):
+    """Self-signed RSA 2048 certificate for host; returns (cert, key, SHA-256 pin)."""
+    cert = os.path.join(cert_dir, "cert.pem")
+    key = os.path.join(cert_dir, "key.pem")
+    if not (os.path.exists(cert) and os.path.exists(key)):
+        os.makedirs(cert_dir, exist_ok=True)
+        alt_name = ("IP:" if host[0].isdigit() else "DNS:") + host
+        subprocess.run(["openssl", "req", "-x509", "-newkey", "rsa:2048", "-nodes", "-days", "3650",
+                        "-keyout", key, "-out", cert, "-subj", "/CN=" + host,
+                        "-addext", "subjectAltName=" + alt_name],
+                       check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    with open(cert) as f:
+        der = ssl.PEM_cert_to_DER_cert(f.read())
+    digest = hashlib.sha256(der).hexdigest().upper()
+    return cert, key, ":".join(digest[i:i + 2] for i in range(0, len(digest), 2))
+
+
+class Server(ThreadingHTTPServer):
+    daemon_threads = True
+
+    def handle_error(self, request, client_address):
+        print("server: connection from %s failed: %s" % (client_address[0], sys.exc_info()[1]), flush=True)
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"       # Keep-alive, as the firmware reuses connections
+    disable_nagle_algorithm = True      # Headers and body go out as separate writes
+    options = None
+    polls = None
+    tls = None
+
+    def setup(self):
+        if self.tls is not None:
+            self.request = self.tls.wrap(self.request, self.client_address[0])
+        super().setup()
+
+    def log_message(self, format, *args):
+        pass
+
+    def reply(self, code, body, content_type="application/json"):
+        data = body.encode()
+        time.sleep(self.options.latency / 1000.0)
+        self.send_response(code)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(data)))
+        if self.options.close:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+        self.wfile.write(data)
+        return len(data)
+
+    def handle_request(self, route):
+        started = time.monotonic()
+        if not self.headers.get("Authorization", "").startswith("Bearer "):
+            sent = self.reply(401, '{"message":"401: Unauthorized"}')
+        else:
+            sent = route()
+        self.polls.add(self.client_address[0], started, time.monotonic(), sent)
+
+    def do_GET(self):
+        self.handle_request(self.get)
+
+    def do_POST(self):
+        self.body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        self.handle_request(self.post)
+
+    def get(self):
+        now = time.time()
+        if self.path == "/api/":
+            return self.reply(200, '{"message":"API running."}')
+        if self.path == "/api/states":
+            return self.reply(200, "[" + ",".join(entity_json(e, now, 0) for e in self.options.entities) + "]")
+        if self.path.startswith("/api/states/"):
+            entity_id = self.path[len("/api/states/"):]
+            return self.reply(200, entity_json(entity_id, now, self.options.body_bytes))
+        return self.reply(404, '{"message":"Not found"}')
+
+    def post(self):
+        try:
+            template = json.loads(self.body)["template"]
+        except (ValueError, KeyError):
+            return self.reply(400, '{"message":"Invalid JSON"}')
+        if self.path != "/api/template":
+            return self.reply(404, '{"message":"Not found"}')
+
+        now = time.time()
+        if "selectattr" in template:
+            # Temperature sensor list of the config page
+            sensors = [{"id": e, "name": e.split(".", 1)[-1].replace("_", " ").title(),
+                        "state": reading(e, now), "unit": "°C"} for e in self.options.entities]
+            return self.reply(200, json.dumps(sensors), "text/plain")
+        values = [reading(e, now) for e in STATES_CALL.findall(template)]
+        return self.reply(200, "[" + ", ".join(values) + "]", "text/plain")
+
+
+def watch_device(device, polls_per_mode, results, last_status, stop):
+    """Record the device's pollMs for every new poll, by poll mode, and follow its TLS counters."""
+    last_count = None
+    last_handshakes = None
+    while not stop.is_set():
+        try:
+            with urllib.request.urlopen("http://%s/status" % device, timeout=5) as response:
+                status = json.loads(response.read())
+        except (OSError, ValueError) as error:
+            print("device: %s" % error, flush=True)
+            stop.wait(1)
+            continue
+
+        count = status.get("pollCount", 0)
+        if last_count is not None and count > last_count:
+            mode = status.get("pollMode", "?")
+            results.setdefault(mode, []).append(status.get("pollMs", 0))
+            missed = count - last_count - 1
+            print("device: %s poll %d ms (avg since boot %d ms, %d requests)%s"
+                  % (mode, status.get("pollMs", 0), status.get("pollAvgMs", 0),
+                     status.get("haRequests", 0),
+                     ", %d polls missed" % missed if missed > 0 else ""), flush=True)
+            if polls_per_mode and all(len(results.get(m, [])) >= polls_per_mode for m in POLL_MODES):
+                stop.set()
+        last_count = count
+
+        handshakes = status.get("tlsFull", 0) + status.get("tlsResumed", 0)
+        if last_handshakes is not None and handshakes > last_handshakes:
+            print("device: %s" % tls_line(status), flush=True)
+        last_handshakes = handshakes
+        last_status.update(status)
+        stop.wait(1)
+
+
+def tls_line(status):
+    return ("TLS full %d, avg %d ms, heap %d B; resumed %d, avg %d ms, heap %d B; lowest free heap %d B"
+            % (status.get("tlsFull", 0), status.get("tlsFullAvgMs", 0), status.get("tlsFullHeap", 0),
+               status.get("tlsResumed", 0), status.get("tlsResumedAvgMs", 0), status.get("tlsResumedHeap", 0),
+               status.get("heapMinFree", 0)))
+
+
+def summary(title, results):
+    print()
+    print("%-18s %5s %8s %8s %8s %8s" % (title, "count", "mean ms", "median", "min", "max"))
+    for name, times in sorted(results.items()):
+        if times:
+            print("%-18s %5d %8.0f %8.0f %8.0f %8.0f"
+                  % (name, len(times), statistics.mean(times), statistics.median(times), min(times), max(times)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Mock Home Assistant for poll latency measurements")
+    parser.add_argument("--port", type=int, default=8123)
+    parser.add_argument("--latency", type=float, default=20, help="delay before every response, ms")
+    parser.add_argument("--body-bytes", type=int, default=1024, help="size of /api/states/<id> bodies")
+    parser.add_argument("--poll-gap", type=float, default=1.0, help="idle seconds that end a poll")
+    parser.add_argument("--entities", nargs="+", default=DEFAULT_ENTITIES, help="entities the config page lists")
+    parser.add_argument("--device", help="device address; prints its pollMs per poll")
+    parser.add_argument("--polls", type=int, default=0, help="stop once both poll modes have this many device polls")
+    parser.add_argument("--close", action="store_true", help="close every connection after one response")
+    parser.add_argument("--tls", action="store_true", help="serve HTTPS with a self-signed certificate")
+    parser.add_argument("--host", default="localhost", help="certificate name, e.g. this host's IP address")
+    parser.add_argument("--cert-dir", default=".pio/mock_ha", help="where the certificate and key are kept")
+    parser.add_argument("--full-every", type=int, default=0,
+                        help="with --tls, make every Nth connection a full handshake")
+    options = parser.parse_args()
+
+    Handler.options = options
+    Handler.polls = PollLog(options.poll_gap)
+    if options.tls:
+        cert, key, pin = make_certificate(options.cert_dir, options.host)
+        Handler.tls = TlsServer(cert, key, options.full_every)
+        print("certificate %s, SHA-256 %s" % (cert, pin), flush=True)
+    server = Server(("", options.port), Handler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    print("mock Home Assistant on %s port %d, %.0f ms latency, %d byte entity bodies"
+          % ("https" if options.tls else "http", options.port, options.latency, options.body_bytes), flush=True)
+
+    results = {}
+    last_status = {}
+    stop = threading.Event()
+    if options.device:
+        threading.Thread(target=watch_device, args=(options.device, options.polls, results, last_status, stop),
+                         daemon=True).start()
+    try:
+        while not stop.wait(0.2):
+            Handler.polls.flush(time.monotonic())
+    except KeyboardInterrupt:
+        pass
+    Handler.polls.flush(float("inf"))
+    if results:
+        summary("device poll mode", results)
+    if Handler.tls is not None:
+        summary("server handshake", Handler.tls.times)
+        if last_status:
+            print("device " + tls_line(last_status))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
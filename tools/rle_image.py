@@ -0,0 +1,175 @@
+"""
+Encode PNG images as run-length encoded RGB565 (used by build_assets.py).
+
+The output is read by RleDecoder (include/rle_image.h):
+
+- Pixels are RGB565 with bytes swapped, i.e. the byte order the panel
+  expects and LovyanGFX sprites store. Alpha is ignored.
+- Each row is encoded on its own, so no token spans two rows.
+- A token starts with one header byte:
+    0x00-0x7F  literal: (h + 1) pixels follow, 2 bytes each
+    0x80-0xFF  run: one pixel follows, repeated (h & 0x7F) + 1 times
+- Pixel bytes are the little-endian bytes of the swapped value, so a
+  decoded row can be copied straight into a uint16_t buffer.
+
+Only the Python standard library is used, so the module also runs inside
+the PlatformIO build environment.
+"""
+
+import struct
+import zlib
+
+MAX_TOKEN = 128
+
+
+def read_png(path):
+    """Decode an 8-bit, non-interlaced PNG into rows of (r, g, b) tuples."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos = 8
+    idat = b""
+    palette = None
+    width = height = color_type = None
+    while pos < len(data):
+        length, = struct.unpack(">I", data[pos:pos + 4])
+        chunk_type = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if chunk_type == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+            if depth != 8 or interlace != 0:
+                raise ValueError("%s: only 8-bit non-interlaced PNGs are supported" % path)
+        elif chunk_type == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif chunk_type == b"IDAT":
+            idat += chunk
+        elif chunk_type == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None:
+        raise ValueError("%s: unsupported PNG colour type %s" % (path, color_type))
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    i = 0
+    for _ in range(height):
+        filter_type = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if filter_type == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filter_type == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filter_type == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + predictor) & 0xFF
+        prev = line
+
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 3:
+                pixels.append(palette[px[0]])
+            elif color_type in (0, 4):
+                pixels.append((px[0], px[0], px[0]))
+            else:
+                pixels.append((px[0], px[1], px[2]))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def to_rgb565_swapped(r, g, b):
+    value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((value & 0xFF) << 8) | (value >> 8)
+
+
+def encode_row(row):
+    """RLE-encode one row of swapped RGB565 values."""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_TOKEN]
+            del literal[:MAX_TOKEN]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                out.extend(struct.pack("<H", value))
+
+    x = 0
+    while x < len(row):
+        run = 1
+        while x + run < len(row) and row[x + run] == row[x] and run < MAX_TOKEN:
+            run += 1
+        # A run of 2 only pays off when it does not split a literal
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out += struct.pack("<H", row[x])
+            x += run
+        else:
+            literal.append(row[x])
+            x += 1
+    flush_literal()
+    return bytes(out)
+
+
+def encode_image(rows):
+    return b"".join(encode_row(row) for row in rows)
+
+
+def decode_image(data, width, height):
+    """Reference decoder, used to check every encoding before it is written."""
+    pixels = []
+    pos = 0
+    for _ in range(height):
+        count = 0
+        while count < width:
+            header = data[pos]
+            pos += 1
+            n = (header & 0x7F) + 1
+            if header & 0x80:
+                value, = struct.unpack("<H", data[pos:pos + 2])
+                pos += 2
+                pixels += [value] * n
+            else:
+                pixels += list(struct.unpack("<%dH" % n, data[pos:pos + 2 * n]))
+                pos += 2 * n
+            count += n
+        if count != width:
+            raise ValueError("token crosses a row boundary")
+    return pixels
+
+
+def checksum(pixels):
+    """FNV-1a over the little-endian pixel bytes (matches the firmware)."""
+    h = 2166136261
+    for value in pixels:
+        for byte in (value & 0xFF, value >> 8):
+            h = ((h ^ byte) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def convert(png_path):
+    """Return (width, height, encoded bytes, checksum) for a PNG."""
+    width, height, rows = read_png(png_path)
+    pixel_rows = [[to_rgb565_swapped(*px) for px in row] for row in rows]
+    pixels = [value for row in pixel_rows for value in row]
+    data = encode_image(pixel_rows)
+    if decode_image(data, width, height) != pixels:
+        raise RuntimeError("%s: RLE round trip mismatch" % png_path)
+    return width, height, data, checksum(pixels)